@@ -1,5 +1,6 @@
 DEFINES+=CONFIG_RDM_ENABLE_SELF_TEST
 DEFINES+=CONFIG_RDM_ENABLE_MANUFACTURER_PIDS
+DEFINES+=ENABLE_RDM_QUEUED_MSG
 
 DEFINES+=RDM_DEVICE_PRODUCT_CATEGORY=E120_PRODUCT_CATEGORY_FIXTURE
 DEFINES+=RDM_DEVICE_PRODUCT_DETAIL=E120_PRODUCT_DETAIL_LED
@@ -7,6 +8,9 @@ DEFINES+=RDM_DEVICE_PRODUCT_DETAIL=E120_PRODUCT_DETAIL_LED
 DEFINES+=CONFIG_DMXNODE_PIXEL_MAX_PORTS=1
 DEFINES+=OUTPUT_DMX_PIXEL 
 
+DEFINES+=CONFIG_DMX_RX_DMA
+
 DEFINES+=DISPLAY_UDF
+DEFINES+=CONFIG_I2C_ASYNC
 
 DEFINES+=DISABLE_FS
@@ -138,6 +138,7 @@ int main() // NOLINT
     for (;;) {
         watchdog::Feed();
         rdm_responder.Run();
+        pixeldmx.Run();
 #if !defined(NO_EMAC)
         network::Run();
 #endif
@@ -49,6 +49,13 @@ enum class Conversion {
     kOneShot,
     kContinuous ///< Default
 };
+
+enum class Status {
+    kIdle,    ///< No conversion started
+    kBusy,    ///< Conversion in progress
+    kReady,   ///< Result available
+    kTimeOut  ///< The RDY bit did not clear within twice the conversion time
+};
 } // namespace adc::mcp3424
 
 class MCP3424 : I2c {
@@ -68,10 +75,63 @@ class MCP3424 : I2c {
 
     uint32_t GetRaw(uint32_t channel);
     double GetVoltage(uint32_t channel);
+    /**
+     * Integer alternative for GetVoltage()
+     * @return Voltage in micro Volt, 0 on a read timeout
+     */
+    uint32_t GetMicroVolt(uint32_t channel);
+    uint32_t ToMicroVolt(uint32_t raw) const;
+
+    /**
+     * Non-blocking acquisition.
+     * StartConversion() writes the configuration and returns,
+     * Poll() does a single read and returns kReady once the RDY bit is cleared.
+     */
+    void StartConversion(uint32_t channel);
+    adc::mcp3424::Status Poll(uint32_t& raw);
+
+    /**
+     * Non-blocking round robin over the channels in the mask, to be called from the superloop.
+     * A conversion that times out is dropped, its channel keeps the previous result.
+     * @return true when a new result is available, see GetLastChannel() and GetResult().
+     */
+    bool Run();
+
+    void SetChannelMask(uint8_t channel_mask) { channel_mask_ = static_cast<uint8_t>(channel_mask & 0x0F); }
+    uint8_t GetChannelMask() const { return channel_mask_; }
+    uint32_t GetLastChannel() const { return last_channel_; }
+    uint32_t GetLastRaw(uint32_t channel) const { return last_raw_[channel & 0x03]; }
+
+    /**
+     * Takes the result of the channel, so that several readers can share one Run() loop.
+     * @return false when there is no new result since the previous call for this channel
+     */
+    bool GetResult(uint32_t channel, uint32_t& raw) {
+        const auto kBit = static_cast<uint8_t>(1U << (channel & 0x03));
+
+        if ((result_mask_ & kBit) == 0) {
+            return false;
+        }
+
+        result_mask_ = static_cast<uint8_t>(result_mask_ & ~kBit);
+        raw = last_raw_[channel & 0x03];
+        return true;
+    }
+
+   private:
+    uint32_t GetBytes() const;
+    uint32_t Convert(const char* buffer) const;
 
    private:
     bool is_connected_{false};
-    uint8_t config_;
+    uint8_t config_{0};
+    uint8_t channel_mask_{0x0F};
+    uint8_t result_mask_{0};
+    adc::mcp3424::Status status_{adc::mcp3424::Status::kIdle};
+    uint32_t conversion_channel_{0};
+    uint32_t last_channel_{0};
+    uint32_t conversion_start_millis_{0};
+    uint32_t last_raw_[4]{};
     double lsb_;
 };
 
@@ -31,24 +31,118 @@
 
 namespace sensor::thermistor {
 // https://www.adafruit.com/product/372
-inline constexpr auto kThermistorNominal = 10000U; // 10K Ohm
-inline constexpr auto kTemperatureNominal = 25.0f; // 25 degrees Celcius
-inline constexpr auto kBcoefficient = 3950U;       // The beta coefficient of the thermistor (usually 3000-4000)
+struct Adafruit372 {
+    static constexpr auto kThermistorNominal = 10000U; // 10K Ohm
+    static constexpr auto kTemperatureNominal = 25.0f; // 25 degrees Celcius
+    static constexpr auto kBcoefficient = 3950U;       // The beta coefficient of the thermistor (usually 3000-4000)
+};
+
+inline constexpr auto kThermistorNominal = Adafruit372::kThermistorNominal;
+inline constexpr auto kTemperatureNominal = Adafruit372::kTemperatureNominal;
+inline constexpr auto kBcoefficient = Adafruit372::kBcoefficient;
 inline constexpr int16_t kRangeMin = -55;
 inline constexpr int16_t kRangeMax = 125;
 inline constexpr char kDescription[] = "Ambient Temperature";
 
-inline float Temperature(uint32_t resistor) {
+/**
+ * Floating point reference, the firmware uses TemperatureDeci()
+ */
+template <typename Model = Adafruit372> inline float Temperature(uint32_t resistor) {
     // https://en.wikipedia.org/wiki/Steinhart–Hart_equation
     // https://learn.adafruit.com/thermistor/using-a-thermistor
-    float steinhart = static_cast<float>(resistor) / kThermistorNominal; // (R/Ro)
-    steinhart = logf(steinhart);                                         // ln(R/Ro)
-    steinhart /= kBcoefficient;                                          // 1/B * ln(R/Ro)
-    steinhart += (1.0f / (kTemperatureNominal + 273.15f));               // + (1/To)
-    steinhart = (1.0f / steinhart);                                      // Invert
-    steinhart -= 273.15f;                                                // convert absolute temp to C
+    float steinhart = static_cast<float>(resistor) / Model::kThermistorNominal; // (R/Ro)
+    steinhart = logf(steinhart);                                                // ln(R/Ro)
+    steinhart /= Model::kBcoefficient;                                          // 1/B * ln(R/Ro)
+    steinhart += (1.0f / (Model::kTemperatureNominal + 273.15f));               // + (1/To)
+    steinhart = (1.0f / steinhart);                                             // Invert
+    steinhart -= 273.15f;                                                       // convert absolute temp to C
     return steinhart;
 }
+
+namespace internal {
+/**
+ * Compile time only, for building the resistance table
+ */
+constexpr double Exp(double x) {
+    uint32_t halvings = 0;
+
+    while ((x > 0.5) || (x < -0.5)) {
+        x /= 2;
+        halvings++;
+    }
+
+    double term = 1;
+    double sum = 1;
+
+    for (uint32_t n = 1; n < 20; n++) {
+        term *= x / n;
+        sum += term;
+    }
+
+    while (halvings-- != 0) {
+        sum *= sum;
+    }
+
+    return sum;
+}
+} // namespace internal
+
+/**
+ * Thermistor resistance every kStep degrees Celcius from kRangeMin to kRangeMax, computed at compile time with the Beta equation.
+ * With a 2 degrees step, linear interpolation stays within 0.1 degree of Temperature() for -40..125 degrees Celcius.
+ */
+template <typename Model, int32_t kStep = 2> struct Table {
+    static_assert(((kRangeMax - kRangeMin) % kStep) == 0, "The range must be a multiple of kStep");
+
+    static constexpr uint32_t kEntries = static_cast<uint32_t>((kRangeMax - kRangeMin) / kStep) + 1;
+
+    uint32_t resistor[kEntries];
+
+    constexpr Table() : resistor{} {
+        constexpr auto kT0 = static_cast<double>(Model::kTemperatureNominal) + 273.15;
+
+        for (uint32_t i = 0; i < kEntries; i++) {
+            const auto kT = static_cast<double>(kRangeMin + static_cast<int32_t>(i) * kStep) + 273.15;
+            resistor[i] = static_cast<uint32_t>(Model::kThermistorNominal * internal::Exp(Model::kBcoefficient * (1.0 / kT - 1.0 / kT0)) + 0.5);
+        }
+    }
+};
+
+/**
+ * @param resistor Thermistor resistance in Ohm
+ * @return Temperature in 0.1 degree Celcius, clamped to kRangeMin..kRangeMax
+ */
+template <typename Model = Adafruit372, int32_t kStep = 2> inline int32_t TemperatureDeci(uint32_t resistor) {
+    static constexpr Table<Model, kStep> kTable;
+    constexpr auto kLast = Table<Model, kStep>::kEntries - 1;
+
+    if (resistor >= kTable.resistor[0]) {
+        return kRangeMin * 10;
+    }
+
+    if (resistor <= kTable.resistor[kLast]) {
+        return kRangeMax * 10;
+    }
+
+    // The resistance decreases with the temperature
+    uint32_t low = 0;
+    uint32_t high = kLast;
+
+    while ((high - low) > 1) {
+        const auto kMiddle = (low + high) / 2;
+
+        if (kTable.resistor[kMiddle] >= resistor) {
+            low = kMiddle;
+        } else {
+            high = kMiddle;
+        }
+    }
+
+    const auto kSpan = kTable.resistor[low] - kTable.resistor[high];
+    const auto kFraction = ((kTable.resistor[low] - resistor) * static_cast<uint32_t>(kStep * 10) + kSpan / 2) / kSpan;
+
+    return (kRangeMin + static_cast<int32_t>(low) * kStep) * 10 + static_cast<int32_t>(kFraction);
+}
 } // namespace sensor::thermistor
 
 #endif // THERMISTOR_H_
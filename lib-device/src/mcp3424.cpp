@@ -30,6 +30,7 @@
 
 #include "mcp3424.h"
 #include "i2c.h"
+#include "timing.h"
 #include "firmware/debug/debug_debug.h"
 
 namespace adc::mcp3424 {
@@ -50,12 +51,19 @@ static constexpr uint8_t CONVERSION(Conversion conversion) {
 static constexpr uint8_t CHANNEL(uint32_t channel) {
     return (channel & 0x03) << 5;
 }
+
+static constexpr uint8_t kReady = (1U << 7); ///< Write: start a one-shot conversion, read: 0 when the result is new
+
+/**
+ * Conversion time in milliseconds for 240, 60, 15 and 3.75 SPS
+ */
+static constexpr uint32_t kConversionMillis[] = {5, 17, 67, 267};
 } // namespace adc::mcp3424
 
 MCP3424::MCP3424(uint8_t address) : I2c(address == 0 ? adc::mcp3424::kI2CAddress : address) {
     DEBUG_ENTRY();
     DEBUG_PRINTF("address=%x", address);
-    is_connected_ = IsConnected();
+    is_connected_ = I2c::IsConnected();
 
     if (is_connected_) {
         SetGain(adc::mcp3424::Gain::kPgaX1);
@@ -111,40 +119,15 @@ adc::mcp3424::Conversion MCP3424::GetConversion() const {
     return static_cast<adc::mcp3424::Conversion>((config_ >> 4) & 0x01);
 }
 
-uint32_t MCP3424::GetRaw(uint32_t channel) {
-    config_ &= static_cast<uint8_t>(~((0x03) << 5));
-    config_ |= adc::mcp3424::CHANNEL(channel);
-
-    uint32_t bytes = 3;
-
+uint32_t MCP3424::GetBytes() const {
     if ((config_ & RESOLUTION(adc::mcp3424::Resolution::kSample18Bits)) == RESOLUTION(adc::mcp3424::Resolution::kSample18Bits)) {
-        bytes = 4;
+        return 4;
     }
 
-    char buffer[4] = {0, 0, 0, 0};
-    int32_t timeout = 8000;
-	
-	Setup();
-
-    while (true) {
-        Write(config_, false);
-        Read(buffer, bytes, false);
-
-        if (bytes == 4) {
-            if ((buffer[3] >> 7) == 0) {
-                break;
-            }
-        } else {
-            if ((buffer[2] >> 7) == 0) {
-                break;
-            }
-        }
-
-        if (timeout-- == 0) {
-            return UINT32_MAX;
-        }
-    }
+    return 3;
+}
 
+uint32_t MCP3424::Convert(const char* buffer) const {
     switch (static_cast<adc::mcp3424::Resolution>((config_ >> 2) & 0x03)) {
         case adc::mcp3424::Resolution::kSample12Bits:
             return static_cast<uint32_t>(((buffer[0] & 0x0f) << 8) | buffer[1]);
@@ -169,7 +152,131 @@ uint32_t MCP3424::GetRaw(uint32_t channel) {
     return UINT32_MAX;
 }
 
+uint32_t MCP3424::GetRaw(uint32_t channel) {
+    status_ = adc::mcp3424::Status::kIdle; // Run() restarts its conversion
+
+    config_ &= static_cast<uint8_t>(~((0x03) << 5));
+    config_ |= adc::mcp3424::CHANNEL(channel);
+
+    const auto kBytes = GetBytes();
+
+    char buffer[4] = {0, 0, 0, 0};
+    int32_t timeout = 8000;
+	
+	Setup();
+
+    while (true) {
+        Write(config_, false);
+        Read(buffer, kBytes, false);
+
+        if ((buffer[kBytes - 1] & adc::mcp3424::kReady) == 0) {
+            break;
+        }
+
+        if (timeout-- == 0) {
+            return UINT32_MAX;
+        }
+    }
+
+    return Convert(buffer);
+}
+
+void MCP3424::StartConversion(uint32_t channel) {
+    config_ &= static_cast<uint8_t>(~((0x03) << 5));
+    config_ |= adc::mcp3424::CHANNEL(channel);
+
+    conversion_channel_ = channel & 0x03;
+
+    Write(static_cast<uint8_t>(config_ | adc::mcp3424::kReady), true);
+
+    conversion_start_millis_ = timing::Millis();
+    status_ = adc::mcp3424::Status::kBusy;
+}
+
+adc::mcp3424::Status MCP3424::Poll(uint32_t& raw) {
+    if (status_ != adc::mcp3424::Status::kBusy) {
+        return status_;
+    }
+
+    const auto kBytes = GetBytes();
+    char buffer[4] = {0, 0, 0, 0};
+
+    Read(buffer, kBytes, true);
+
+    if ((buffer[kBytes - 1] & adc::mcp3424::kReady) == 0) {
+        raw = Convert(buffer);
+        status_ = adc::mcp3424::Status::kReady;
+        return status_;
+    }
+
+    const auto kTimeOut = 2 * adc::mcp3424::kConversionMillis[(config_ >> 2) & 0x03];
+
+    if ((timing::Millis() - conversion_start_millis_) > kTimeOut) {
+        status_ = adc::mcp3424::Status::kTimeOut;
+    }
+
+    return status_;
+}
+
+bool MCP3424::Run() {
+    if (channel_mask_ == 0) {
+        return false;
+    }
+
+    if (status_ == adc::mcp3424::Status::kBusy) {
+        uint32_t raw;
+
+        const auto kStatus = Poll(raw);
+
+        if (kStatus == adc::mcp3424::Status::kBusy) {
+            return false;
+        }
+
+        const auto kIsReady = (kStatus == adc::mcp3424::Status::kReady);
+
+        if (kIsReady) {
+            last_raw_[conversion_channel_] = raw;
+            last_channel_ = conversion_channel_;
+            result_mask_ = static_cast<uint8_t>(result_mask_ | (1U << conversion_channel_));
+        }
+
+        status_ = adc::mcp3424::Status::kIdle;
+
+        // Start the next conversion right away, the result is collected on a later call
+        auto channel = conversion_channel_;
+
+        do {
+            channel = (channel + 1) & 0x03;
+        } while ((channel_mask_ & (1U << channel)) == 0);
+
+        StartConversion(channel);
+        return kIsReady;
+    }
+
+    auto channel = conversion_channel_;
+
+    while ((channel_mask_ & (1U << channel)) == 0) {
+        channel = (channel + 1) & 0x03;
+    }
+
+    StartConversion(channel);
+    return false;
+}
+
 double MCP3424::GetVoltage(uint32_t channel) {
     const auto kVout = static_cast<double>(GetRaw(channel)) * 2 * lsb_;
     return kVout;
 }
+
+uint32_t MCP3424::GetMicroVolt(uint32_t channel) {
+    return ToMicroVolt(GetRaw(channel));
+}
+
+uint32_t MCP3424::ToMicroVolt(uint32_t raw) const {
+    if (raw == UINT32_MAX) {
+        return 0;
+    }
+
+    // LSB = 1 mV / 4^resolution, see SetResolution(), the raw value is at most 18 bits
+    return (raw * 1000U) >> (2U * static_cast<uint32_t>(GetResolution()));
+}
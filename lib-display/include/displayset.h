@@ -66,6 +66,11 @@ class DisplaySet
 
     virtual void PrintInfo() {}
 
+    /**
+     * Called from the superloop, drivers with a framebuffer flush pending updates here.
+     */
+    virtual void Run() {}
+
    protected:
     uint32_t cols_;
     uint32_t rows_;
@@ -297,6 +297,12 @@ class Display {
     uint32_t GetSleepTimeout() const { return sleep_timeout_ / 1000U / 60U; }
 
     void Run() {
+        if (lcd_display_ == nullptr) {
+            return;
+        }
+
+        lcd_display_->Run();
+
         if (sleep_timeout_ == 0) {
             return;
         }
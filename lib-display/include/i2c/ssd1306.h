@@ -45,10 +45,8 @@ class Ssd1306 final : public DisplaySet {
     explicit Ssd1306(OledPanel);
     Ssd1306(uint8_t, OledPanel);
     ~Ssd1306() override {
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
         delete[] shadow_ram_;
         shadow_ram_ = nullptr;
-#endif
     }
 
     bool Start() override;
@@ -72,6 +70,9 @@ class Ssd1306 final : public DisplaySet {
 
     void PrintInfo() override;
 
+    void Run() override;
+    void Flush();
+
     bool IsSH1106() { return have_sh1106_; }
 
     static Ssd1306* Get() { return s_this; }
@@ -82,6 +83,28 @@ class Ssd1306 final : public DisplaySet {
     void SendCommand(uint8_t);
     void SendData(const uint8_t* data, uint32_t length);
 
+    void ClearGddram();
+    uint32_t RenderRow(uint32_t row, uint8_t* data, uint8_t& first);
+    void ColumnRowCommands(uint8_t column, uint8_t row, uint8_t* commands) const;
+#if defined(CONFIG_I2C_ASYNC)
+    void FlushRowAsync();
+#endif
+    void Store(int c);
+    void MarkDirty(uint32_t index);
+    void MarkAllDirty();
+    void FlushIfNotDeferred() {
+        if (!IsDeferred()) {
+            Flush();
+        }
+    }
+    bool IsDeferred() const {
+#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
+        return is_deferred_ && (cursor_mode_ == display::cursor::kOff);
+#else
+        return is_deferred_;
+#endif
+    }
+
     void SetCursorOn();
     void SetCursorOff();
     void SetCursorBlinkOn();
@@ -90,13 +113,25 @@ class Ssd1306 final : public DisplaySet {
     void DumpShadowRam();
 
    private:
+    static constexpr uint32_t kMaxRows = 8;
+
     I2c i2c_;
     OledPanel oled_panel_{OledPanel::k128x648Rows};
     bool have_sh1106_{false};
     uint32_t pages_;
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
+    /**
+     * The shadow RAM is the framebuffer, GDDRAM is only written by Flush().
+     * Per row the dirty character columns are kept as [first, last], empty when first > last.
+     */
     char* shadow_ram_{nullptr};
     uint32_t shadow_ram_index_{0};
+    uint8_t dirty_first_[kMaxRows];
+    uint8_t dirty_last_[kMaxRows];
+    uint32_t flush_millis_{0};
+    bool is_dirty_{false};
+    bool is_deferred_{false};
+#if defined(CONFIG_I2C_ASYNC)
+    uint32_t flush_row_{kMaxRows}; ///< The next row of the frame being flushed asynchronously, kMaxRows when idle
 #endif
 #if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
     uint32_t cursor_mode_{display::cursor::kOff};
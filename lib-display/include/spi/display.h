@@ -167,8 +167,18 @@ class Display : public LcdDriver {
             nLength = cols_;
         }
 
-        for (uint32_t i = 0; i < nLength; i++) {
-            PutChar(pData[i]);
+        DrawString(cursor_x_, cursor_y_, pData, nLength, s_pFONT, kColorBackground, kColorForeground);
+
+        cursor_x_ += nLength * s_pFONT->kWidth;
+
+        if (cursor_x_ >= GetWidth()) {
+            cursor_x_ = 0;
+
+            cursor_y_ += s_pFONT->kHeight;
+
+            if (cursor_y_ >= GetHeight()) {
+                cursor_y_ = 0;
+            }
         }
     }
 
@@ -29,6 +29,7 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cassert>
+#include <algorithm>
 
 #include "spi/lcd_font.h"
 #include "spi/spilcd.h"
@@ -54,14 +55,13 @@ class Paint : public SpiLcd {
 
         FillFramebuffer(colour);
 
-        ClearCS();
-        SetDC();
+        BeginData();
 
         for (uint32_t i = 0; i < config::kHeight / kFrameBufferRows; i++) {
-            WriteDataContinue(reinterpret_cast<uint8_t*>(s_frame_buffer), sizeof(s_frame_buffer));
+            WriteDataAsync(reinterpret_cast<uint8_t*>(s_frame_buffer[0]), sizeof(s_frame_buffer[0]));
         }
 
-        SetCS();
+        EndData();
     }
 
     void Fill(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1, uint16_t colour) {
@@ -78,26 +78,18 @@ class Paint : public SpiLcd {
         FillFramebuffer(colour);
 
         auto pixels = (1 + (y1 - y0)) * (1 + (x1 - x0));
-        const auto kBufferSize = sizeof(s_frame_buffer) / sizeof(s_frame_buffer[0]);
 
-        if (pixels > kBufferSize) {
-            WriteDataStart(reinterpret_cast<uint8_t*>(s_frame_buffer), sizeof(s_frame_buffer));
+        BeginData();
 
-            pixels = pixels - kBufferSize;
+        // The same buffer is sent repeatedly, it is not modified while a transfer is active
+        while (pixels > kStripPixels) {
+            WriteDataAsync(reinterpret_cast<uint8_t*>(s_frame_buffer[0]), sizeof(s_frame_buffer[0]));
+            pixels = pixels - kStripPixels;
+        }
 
-            while (pixels > kBufferSize) {
-                WriteDataContinue(reinterpret_cast<uint8_t*>(s_frame_buffer), sizeof(s_frame_buffer));
-                pixels = pixels - kBufferSize;
-            }
+        WriteDataAsync(reinterpret_cast<uint8_t*>(s_frame_buffer[0]), pixels * 2);
 
-            if (pixels > 0) {
-                WriteDataEnd(reinterpret_cast<uint8_t*>(s_frame_buffer), pixels * 2);
-            } else {
-                SetCS();
-            }
-        } else {
-            WriteData(reinterpret_cast<uint8_t*>(s_frame_buffer), pixels * 2);
-        }
+        EndData();
     }
 
     void DrawPixel(uint32_t x, uint32_t y, uint16_t colour) {
@@ -114,58 +106,61 @@ class Paint : public SpiLcd {
         colour_fore_ground = __builtin_bswap16(colour_fore_ground);
         colour_background = __builtin_bswap16(colour_background);
 
-        const auto kCharOffset = (c - ' ') * font->kHeight;
-        const auto* ptr = &font->table[kCharOffset];
+        auto* buffer = s_frame_buffer[0];
 
-        //	    DEBUG_PRINTF("w=%u, h=%u, nCharOffset=%u", font->kWidth , font->kHeight, nCharOffset);
+        for (uint32_t page = 0; page < font->kHeight; page++) {
+            buffer = RenderGlyphLine(buffer, font, c, page, colour_background, colour_fore_ground);
+        }
 
-        uint32_t index = 0;
+        BeginData();
+        WriteDataAsync(reinterpret_cast<uint8_t*>(s_frame_buffer[0]), static_cast<uint32_t>(buffer - s_frame_buffer[0]) * 2);
+        EndData();
+    }
 
-        if (font->kWidth == 8) {
-            for (auto page = 0; page < font->kHeight; page++) {
-                auto line = *ptr++;
+    /**
+     * Draws the text as one address window, in strips of kFrameBufferRows lines.
+     * A strip is rendered while the previous strip is being transferred.
+     */
+    void DrawString(uint32_t x0, uint32_t y0, const char* text, uint32_t length, sFONT* font, uint16_t colour_background, uint16_t colour_fore_ground) {
+        if ((x0 >= width_) || ((y0 + font->kHeight) > height_) || (length == 0)) {
+            return;
+        }
 
-                for (auto column = 0; column < font->kWidth; column++) {
-                    if ((line & 0x80) != 0) {
-                        s_frame_buffer[index++] = colour_fore_ground;
-                    } else {
-                        s_frame_buffer[index++] = colour_background;
-                    }
+        const auto kMaxLength = (width_ - x0) / font->kWidth;
 
-                    line = line << 1;
-                }
-            }
-        } else if (font->kWidth < 16) {
-            for (auto page = 0; page < font->kHeight; page++) {
-                auto line = *ptr++;
+        if (length > kMaxLength) {
+            length = kMaxLength;
+        }
 
-                for (auto column = 0; column < font->kWidth; column++) {
-                    if ((line & 0x8000) != 0) {
-                        s_frame_buffer[index++] = colour_fore_ground;
-                    } else {
-                        s_frame_buffer[index++] = colour_background;
-                    }
+        if (length == 0) {
+            return;
+        }
 
-                    line = line << 1;
-                }
-            }
-        } else {
-            for (auto page = 0; page < font->kHeight; page++) {
-                auto line = *ptr++;
+        SetAddressWindow(x0, y0, x0 + length * font->kWidth - 1, y0 + font->kHeight - 1);
 
-                for (auto column = 0; column < font->kWidth; column++) {
-                    if ((line & 0x1) != 0) {
-                        s_frame_buffer[index++] = colour_fore_ground;
-                    } else {
-                        s_frame_buffer[index++] = colour_background;
-                    }
+        colour_fore_ground = __builtin_bswap16(colour_fore_ground);
+        colour_background = __builtin_bswap16(colour_background);
+
+        BeginData();
+
+        uint32_t strip = 0;
+        uint32_t page = 0;
 
-                    line = line >> 1;
+        while (page < font->kHeight) {
+            auto* buffer = s_frame_buffer[strip];
+            const auto kPageEnd = std::min(static_cast<uint32_t>(font->kHeight), page + kFrameBufferRows);
+
+            for (; page < kPageEnd; page++) {
+                for (uint32_t i = 0; i < length; i++) {
+                    buffer = RenderGlyphLine(buffer, font, text[i], page, colour_background, colour_fore_ground);
                 }
             }
+
+            WriteDataAsync(reinterpret_cast<uint8_t*>(s_frame_buffer[strip]), static_cast<uint32_t>(buffer - s_frame_buffer[strip]) * 2);
+            strip ^= 1;
         }
 
-        WriteData(reinterpret_cast<uint8_t*>(s_frame_buffer), index * 2);
+        EndData();
     }
 
     /**
@@ -219,11 +214,39 @@ class Paint : public SpiLcd {
     void FillFramebuffer(uint16_t colour) {
         colour = __builtin_bswap16(colour);
 
-        for (uint32_t i = 0; i < sizeof(s_frame_buffer) / sizeof(s_frame_buffer[0]); i++) {
-            s_frame_buffer[i] = colour;
+        for (uint32_t i = 0; i < kStripPixels; i++) {
+            s_frame_buffer[0][i] = colour;
         }
     }
 
+    /**
+     * Renders one line of a glyph, the colours are already byte swapped.
+     * @return Pointer to the next pixel in the buffer.
+     */
+    static uint16_t* RenderGlyphLine(uint16_t* buffer, const sFONT* font, char c, uint32_t page, uint16_t colour_background, uint16_t colour_fore_ground) {
+        const auto kCharOffset = static_cast<uint32_t>(c - ' ') * font->kHeight;
+        auto line = static_cast<uint32_t>(font->table[kCharOffset + page]);
+
+        if (font->kWidth == 8) {
+            for (uint32_t column = 0; column < 8; column++) {
+                *buffer++ = ((line & 0x80) != 0) ? colour_fore_ground : colour_background;
+                line = line << 1;
+            }
+        } else if (font->kWidth < 16) {
+            for (uint32_t column = 0; column < font->kWidth; column++) {
+                *buffer++ = ((line & 0x8000) != 0) ? colour_fore_ground : colour_background;
+                line = line << 1;
+            }
+        } else {
+            for (uint32_t column = 0; column < font->kWidth; column++) {
+                *buffer++ = ((line & 0x1) != 0) ? colour_fore_ground : colour_background;
+                line = line >> 1;
+            }
+        }
+
+        return buffer;
+    }
+
    protected:
     uint32_t width_{config::kWidth};
     uint32_t height_{config::kHeight};
@@ -235,7 +258,12 @@ class Paint : public SpiLcd {
     static constexpr uint32_t kFrameBufferRows = SPI_LCD_kFrameBufferRows;
 #endif
 
-    static inline uint16_t s_frame_buffer[config::kWidth * kFrameBufferRows];
+    static constexpr uint32_t kStripPixels = config::kWidth * kFrameBufferRows;
+
+    /**
+     * Two line strips, one is rendered while the other is transferred.
+     */
+    static inline uint16_t s_frame_buffer[2][kStripPixels] __attribute__((aligned(4)));
 };
 
 #endif // SPI_PAINT_H_
@@ -82,6 +82,7 @@ class SpiLcd {
     void ClearDC() { gpio::Clr(SPI_LCD_DC_GPIO); }
 
     void WriteCommand(uint8_t data) {
+        WaitData();
         ClearCS();
         ClearDC();
         spi::Writenb(reinterpret_cast<char*>(&data), 1);
@@ -89,6 +90,7 @@ class SpiLcd {
     }
 
     void WriteData(const uint8_t* data, uint32_t length) {
+        WaitData();
         ClearCS();
         SetDC();
         spi::Writenb(reinterpret_cast<const char*>(data), length);
@@ -102,6 +104,7 @@ class SpiLcd {
     }
 
     void WriteDataByte(uint8_t data) {
+        WaitData();
         ClearCS();
         SetDC();
         spi::Writenb(reinterpret_cast<char*>(&data), 1);
@@ -109,29 +112,54 @@ class SpiLcd {
     }
 
     void WriteDataWord(uint16_t data) {
+        WaitData();
         ClearCS();
         SetDC();
         spi::Write(data);
         SetCS();
     }
 
-    void WriteDataStart(uint8_t* data, uint32_t length) {
+    /**
+     * Streaming data transfer: BeginData(), one or more WriteDataAsync(), EndData().
+     * With SPI DMA, WriteDataAsync() returns as soon as the transfer has started.
+     * The buffer must not be modified until the next WriteDataAsync(), WaitData() or EndData() returns.
+     */
+    void BeginData() {
+        WaitData();
         ClearCS();
         SetDC();
-        spi::Writenb(reinterpret_cast<char*>(data), length);
     }
 
-    void WriteDataContinue(uint8_t* data, uint32_t length) { 
-		spi::Writenb(reinterpret_cast<char*>(data), length); 
-	}
+    void WriteDataAsync(const uint8_t* data, uint32_t length) {
+#if defined(SPI_DMAx)
+        WaitData();
+        spi::DmaWrite(data, length);
+        is_dma_active_ = true;
+#else
+        spi::Writenb(reinterpret_cast<const char*>(data), length);
+#endif
+    }
 
-    void WriteDataEnd(uint8_t* data, uint32_t length) {
-        spi::Writenb(reinterpret_cast<char*>(data), length);
+    void WaitData() {
+#if defined(SPI_DMAx)
+        if (is_dma_active_) {
+            while (spi::DmaIsActive()) {
+            }
+            is_dma_active_ = false;
+        }
+#endif
+    }
+
+    void EndData() {
+        WaitData();
         SetCS();
     }
 
    private:
     uint32_t cs_;
+#if defined(SPI_DMAx)
+    bool is_dma_active_{false};
+#endif
 };
 
 #endif // SPI_SPILCD_H_
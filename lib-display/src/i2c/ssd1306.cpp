@@ -34,10 +34,16 @@
 
 #include "i2c/ssd1306.h"
 #include "i2c.h"
+#include "timing.h"
 #include "firmware/debug/debug_debug.h"
 
 namespace ssd1306 {
 static constexpr auto kLcdWidth = 128;
+#if defined(CONFIG_DISPLAY_FLUSH_INTERVAL_MS)
+static constexpr uint32_t kFlushIntervalMillis = CONFIG_DISPLAY_FLUSH_INTERVAL_MS;
+#else
+static constexpr uint32_t kFlushIntervalMillis = 40;
+#endif
 namespace mode {
 static constexpr auto kCommand = 0x00;
 static constexpr auto kData = 0x40;
@@ -316,7 +322,7 @@ bool Ssd1306::Start() {
 
     CheckSH1106();
 
-    Ssd1306::Cls();
+    ClearGddram();
 
     SendCommand(ssd1306::cmd::kDisplayOn);
 	
@@ -324,7 +330,10 @@ bool Ssd1306::Start() {
     return true;
 }
 
-void Ssd1306::Cls() {
+/**
+ * Clears the complete GDDRAM, including the columns not covered by the font and the SH1106 extra columns.
+ */
+void Ssd1306::ClearGddram() {
     uint32_t column_add = 0;
 
     if (have_sh1106_) {
@@ -338,70 +347,249 @@ void Ssd1306::Cls() {
         SendData(reinterpret_cast<const uint8_t*>(&s_clear_buffer), (column_add + ssd1306::kLcdWidth + 1));
     }
 
-    SendCommand(ssd1306::cmd::kSetLowcolumn | (column_add & 0XF));
-    SendCommand(static_cast<uint8_t>(ssd1306::cmd::kSetHighcolumn | (column_add)));
-    SendCommand(ssd1306::cmd::kSetStartpage);
-
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
     shadow_ram_index_ = 0;
     memset(shadow_ram_, ' ', ssd1306::oled::font8x6::kCols * rows_);
-#endif
+
+    for (uint32_t row = 0; row < kMaxRows; row++) {
+        dirty_first_[row] = UINT8_MAX;
+        dirty_last_[row] = 0;
+    }
+
+    is_dirty_ = false;
 }
 
-void Ssd1306::PutChar(int c) {
-    int i;
+void Ssd1306::Cls() {
+    shadow_ram_index_ = 0;
+
+    for (uint32_t i = 0; i < ssd1306::oled::font8x6::kCols * rows_; i++) {
+        Store(' ');
+    }
+
+    shadow_ram_index_ = 0;
+
+    FlushIfNotDeferred();
+}
+
+void Ssd1306::Store(int c) {
+    if (__builtin_expect((shadow_ram_index_ >= ssd1306::oled::font8x6::kCols * rows_), 0)) {
+        return;
+    }
 
     if (c < 32 || c > 127) {
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
         c = 32;
+    }
+
+    if (shadow_ram_[shadow_ram_index_] != static_cast<char>(c)) {
+        shadow_ram_[shadow_ram_index_] = static_cast<char>(c);
+        MarkDirty(shadow_ram_index_);
+    }
+
+    shadow_ram_index_++;
+}
+
+void Ssd1306::MarkDirty(uint32_t index) {
+    const auto kRow = index / ssd1306::oled::font8x6::kCols;
+    const auto kColumn = static_cast<uint8_t>(index - kRow * ssd1306::oled::font8x6::kCols);
+
+    if (kColumn < dirty_first_[kRow]) {
+        dirty_first_[kRow] = kColumn;
+    }
+
+    if (kColumn > dirty_last_[kRow]) {
+        dirty_last_[kRow] = kColumn;
+    }
+
+    is_dirty_ = true;
+}
+
+void Ssd1306::MarkAllDirty() {
+    for (uint32_t row = 0; row < rows_; row++) {
+        dirty_first_[row] = 0;
+        dirty_last_[row] = ssd1306::oled::font8x6::kCols - 1;
+    }
+
+    is_dirty_ = true;
+}
+
+/**
+ * Renders the dirty span of the row as a data transfer and marks the row clean.
+ * @return the transfer length, 0 when the row is clean
+ */
+uint32_t Ssd1306::RenderRow(uint32_t row, uint8_t* data, uint8_t& first) {
+    const uint32_t kFirst = dirty_first_[row];
+    const uint32_t kLast = dirty_last_[row];
+
+    if (kFirst > kLast) {
+        return 0;
+    }
+
+    data[0] = ssd1306::mode::kData;
+
+    const auto* shadow_ram = &shadow_ram_[row * ssd1306::oled::font8x6::kCols];
+    auto* p = &data[1];
+
+    for (uint32_t column = kFirst; column <= kLast; column++) {
+        const auto* base = kOledFont8x6 + 1 + (ssd1306::oled::font8x6::kCharW + 1) * (shadow_ram[column] - 32);
+        memcpy(p, base, ssd1306::oled::font8x6::kCharW);
+        p += ssd1306::oled::font8x6::kCharW;
+    }
+
+    dirty_first_[row] = UINT8_MAX;
+    dirty_last_[row] = 0;
+
+    first = static_cast<uint8_t>(kFirst);
+    return static_cast<uint32_t>(p - data);
+}
+
+/**
+ * Sends the dirty span of each row as a single data transfer.
+ */
+void Ssd1306::Flush() {
+    if (!is_dirty_) {
+        return;
+    }
+
+    uint8_t data[1 + ssd1306::oled::font8x6::kCols * ssd1306::oled::font8x6::kCharW] __attribute__((aligned(4)));
+
+    for (uint32_t row = 0; row < rows_; row++) {
+        uint8_t first;
+        const auto kLength = RenderRow(row, data, first);
+
+        if (kLength == 0) {
+            continue;
+        }
+
+        SetColumnRow(first, static_cast<uint8_t>(row));
+        SendData(data, kLength);
+    }
+
+    is_dirty_ = false;
+}
+
+#if defined(CONFIG_I2C_ASYNC)
+static i2c::Transaction s_commands_transaction;
+static i2c::Transaction s_data_transaction;
+static uint8_t s_async_commands[4];
+static uint8_t s_async_data[1 + ssd1306::oled::font8x6::kCols * ssd1306::oled::font8x6::kCharW] __attribute__((aligned(4)));
+
+/**
+ * Submits the next dirty row of the frame, one row is in flight at a time.
+ * The blocking API waits for the queue to drain, so it can still be used in between.
+ */
+void Ssd1306::FlushRowAsync() {
+    i2c::AsyncRun();
+
+    if (!i2c::AsyncIsIdle()) {
+        return;
+    }
+
+    while (flush_row_ < rows_) {
+        const auto kRow = flush_row_++;
+        uint8_t first;
+        const auto kLength = RenderRow(kRow, s_async_data, first);
+
+        if (kLength == 0) {
+            continue;
+        }
+
+        ColumnRowCommands(first, static_cast<uint8_t>(kRow), s_async_commands);
+
+        s_commands_transaction = {s_async_commands, sizeof(s_async_commands), nullptr, 0, nullptr, nullptr, i2c_.GetAddress(), GD32_I2C_OK, false};
+        s_data_transaction = {s_async_data, kLength, nullptr, 0, nullptr, nullptr, i2c_.GetAddress(), GD32_I2C_OK, false};
+
+        // The baud rate is shared with the other devices on the bus
+        i2c_.Setup();
+
+        if (!i2c::AsyncSubmit(s_commands_transaction) || !i2c::AsyncSubmit(s_data_transaction)) {
+            // Queue full, the row is sent again on a next call
+            flush_row_ = kRow;
+            dirty_first_[kRow] = first;
+            dirty_last_[kRow] = static_cast<uint8_t>(first + (kLength - 1) / ssd1306::oled::font8x6::kCharW - 1);
+        }
+
+        return;
+    }
+
+    flush_row_ = kMaxRows;
+}
 #endif
-        i = 0;
-    } else {
-        i = c - 32;
+
+void Ssd1306::Run() {
+    is_deferred_ = true;
+
+#if defined(CONFIG_I2C_ASYNC)
+    if (flush_row_ < rows_) {
+        FlushRowAsync();
+        return;
     }
+#endif
 
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
-    shadow_ram_[shadow_ram_index_++] = static_cast<char>(c);
+    if (!is_dirty_) {
+        return;
+    }
+
+    const auto kMillis = timing::Millis();
+
+    if ((kMillis - flush_millis_) < ssd1306::kFlushIntervalMillis) {
+        return;
+    }
+
+    flush_millis_ = kMillis;
+
+#if defined(CONFIG_I2C_ASYNC)
+    // Rows marked dirty while the frame is sent are picked up by this frame or the next one
+    is_dirty_ = false;
+    flush_row_ = 0;
+    FlushRowAsync();
+#else
+    Flush();
 #endif
-    const uint8_t* base = kOledFont8x6 + (ssd1306::oled::font8x6::kCharW + 1) * i;
-    SendData(base, ssd1306::oled::font8x6::kCharW + 1);
+}
+
+void Ssd1306::PutChar(int c) {
+    Store(c);
+    FlushIfNotDeferred();
 }
 
 void Ssd1306::PutString(const char* string) {
     const char* p = string;
 
     while (*p != '\0') {
-        Ssd1306::PutChar(static_cast<int>(*p));
+        Store(static_cast<int>(*p));
         p++;
     }
 
     if (clear_end_of_line_) {
         clear_end_of_line_ = false;
         for (auto i = static_cast<uint32_t>(p - string); i < cols_; i++) {
-            Ssd1306::PutChar(' ');
+            Store(' ');
         }
     }
+
+    FlushIfNotDeferred();
 }
 
 /**
  * line [1..4]
  */
 void Ssd1306::ClearLine(uint32_t line) {
-    if (__builtin_expect((!(line <= rows_)), 0)) {
+    if (__builtin_expect((!((line != 0) && (line <= rows_))), 0)) {
         return;
     }
 
     Ssd1306::SetCursorPos(0, static_cast<uint8_t>(line - 1));
-    SendData(reinterpret_cast<const uint8_t*>(&s_clear_buffer), ssd1306::kLcdWidth + 1);
+
+    for (uint32_t i = 0; i < ssd1306::oled::font8x6::kCols; i++) {
+        Store(' ');
+    }
+
     Ssd1306::SetCursorPos(0, static_cast<uint8_t>(line - 1));
 
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
-    memset(&shadow_ram_[shadow_ram_index_], ' ', ssd1306::oled::font8x6::kCols);
-#endif
+    FlushIfNotDeferred();
 }
 
 void Ssd1306::TextLine(uint32_t line, const char* data, uint32_t length) {
-    if (__builtin_expect((!(line <= rows_)), 0)) {
+    if (__builtin_expect((!((line != 0) && (line <= rows_))), 0)) {
         return;
     }
 
@@ -417,15 +605,17 @@ void Ssd1306::Text(const char* data, uint32_t length) {
     uint32_t i;
 
     for (i = 0; i < length; i++) {
-        Ssd1306::PutChar(data[i]);
+        Store(data[i]);
     }
 
     if (clear_end_of_line_) {
         clear_end_of_line_ = false;
         for (; i < cols_; i++) {
-            Ssd1306::PutChar(' ');
+            Store(' ');
         }
     }
+
+    FlushIfNotDeferred();
 }
 
 /**
@@ -436,19 +626,8 @@ void Ssd1306::SetCursorPos(uint32_t column, uint32_t row) {
         return;
     }
 
-    column = static_cast<uint8_t>(column * ssd1306::oled::font8x6::kCharW);
+    shadow_ram_index_ = (row * ssd1306::oled::font8x6::kCols) + column;
 
-    if (have_sh1106_) {
-        column = static_cast<uint8_t>(column + 4);
-    }
-
-    SendCommand(ssd1306::cmd::kSetLowcolumn | (column & 0XF));
-    SendCommand(static_cast<uint8_t>(ssd1306::cmd::kSetHighcolumn | (column >> 4)));
-    SendCommand(static_cast<uint8_t>(ssd1306::cmd::kSetStartpage | row));
-
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
-    shadow_ram_index_ = static_cast<uint16_t>((row * ssd1306::oled::font8x6::kCols) + (column / ssd1306::oled::font8x6::kCharW));
-#endif
 #if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
     if (cursor_mode_ == display::cursor::kOn) {
         SetCursorOff();
@@ -483,14 +662,8 @@ void Ssd1306::SetFlipVertically(bool do_flip_vertically) {
     }
 
 #if defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
-    for (uint32_t i = 0; i < rows_; i++) {
-        Ssd1306::SetCursorPos(0, static_cast<uint8_t>(i));
-        for (uint32_t j = 0; j < ssd1306::oled::font8x6::kCols; j++) {
-            const auto kN = shadow_ram_[i * ssd1306::oled::font8x6::kCols + j] - 32;
-            const uint8_t* base = kOledFont8x6 + (ssd1306::oled::font8x6::kCharW + 1) * kN;
-            SendData(base, ssd1306::oled::font8x6::kCharW + 1);
-        }
-    }
+    MarkAllDirty();
+    FlushIfNotDeferred();
 #endif
 }
 
@@ -513,11 +686,16 @@ void Ssd1306::InitMembers() {
 
     pages_ = (oled_panel_ == OledPanel::k128x648Rows ? 8 : 4);
 
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
+    assert(rows_ <= kMaxRows);
+
     shadow_ram_ = new char[ssd1306::oled::font8x6::kCols * rows_];
     assert(shadow_ram_ != nullptr);
     memset(shadow_ram_, ' ', ssd1306::oled::font8x6::kCols * rows_);
-#endif
+
+    for (uint32_t row = 0; row < kMaxRows; row++) {
+        dirty_first_[row] = UINT8_MAX;
+        dirty_last_[row] = 0;
+    }
 }
 
 void Ssd1306::SendCommand(uint8_t cmd) {
@@ -558,11 +736,13 @@ void Ssd1306::SetCursor([[maybe_unused]] uint32_t cursor_mode) {
 
 void Ssd1306::SetCursorOn() {
 #if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
+    Flush();
+
     cursor_on_column_ = static_cast<uint8_t>(shadow_ram_index_ % ssd1306::oled::font8x6::kCols);
     cursor_on_row_ = static_cast<uint8_t>(shadow_ram_index_ / ssd1306::oled::font8x6::kCols);
     cursor_on_char_ = static_cast<uint8_t>(shadow_ram_[shadow_ram_index_] - 32);
 
-    const auto* base = const_cast<uint8_t*>(kOledFont8x6) + 1 + (ssd1306::oled::font8x6::kCharW + 1) * cursor_on_char_;
+    const auto* base = kOledFont8x6 + 1 + (ssd1306::oled::font8x6::kCharW + 1) * cursor_on_char_;
 
     uint8_t data[ssd1306::oled::font8x6::kCharW + 1];
     data[0] = 0x40;
@@ -572,18 +752,20 @@ void Ssd1306::SetCursorOn() {
         base++;
     }
 
-    SendData(data, ssd1306::oled::font8x6::kCharW + 1);
     SetColumnRow(cursor_on_column_, cursor_on_row_);
+    SendData(data, ssd1306::oled::font8x6::kCharW + 1);
 #endif
 }
 
 void Ssd1306::SetCursorBlinkOn() {
 #if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
+    Flush();
+
     cursor_on_column_ = static_cast<uint8_t>(shadow_ram_index_ % ssd1306::oled::font8x6::kCols);
     cursor_on_row_ = static_cast<uint8_t>(shadow_ram_index_ / ssd1306::oled::font8x6::kCols);
     cursor_on_char_ = static_cast<uint8_t>(shadow_ram_[shadow_ram_index_] - 32);
 
-    const uint8_t* base = const_cast<uint8_t*>(kOledFont8x6) + 1 + (ssd1306::oled::font8x6::kCharW + 1) * cursor_on_char_;
+    const uint8_t* base = kOledFont8x6 + 1 + (ssd1306::oled::font8x6::kCharW + 1) * cursor_on_char_;
 
     uint8_t data[ssd1306::oled::font8x6::kCharW + 1];
     data[0] = 0x40;
@@ -593,45 +775,47 @@ void Ssd1306::SetCursorBlinkOn() {
         base++;
     }
 
-    SendData(data, static_cast<uint32_t>(ssd1306::oled::font8x6::kCharW + 1));
     SetColumnRow(cursor_on_column_, cursor_on_row_);
+    SendData(data, static_cast<uint32_t>(ssd1306::oled::font8x6::kCharW + 1));
 #endif
 }
 
+/**
+ * The cursor cell is redrawn from the shadow RAM.
+ */
 void Ssd1306::SetCursorOff() {
 #if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
-    const auto kCol = static_cast<uint8_t>(shadow_ram_index_ % ssd1306::oled::font8x6::kCols);
-    const auto kRow = static_cast<uint8_t>(shadow_ram_index_ / ssd1306::oled::font8x6::kCols);
-
-    SetColumnRow(cursor_on_column_, cursor_on_row_);
-
-    const uint8_t* base = kOledFont8x6 + (ssd1306::oled::font8x6::kCharW + 1) * cursor_on_char_;
-
-    SendData(base, (ssd1306::oled::font8x6::kCharW + 1));
-    SetColumnRow(kCol, kRow);
+    MarkDirty(static_cast<uint32_t>(cursor_on_row_ * ssd1306::oled::font8x6::kCols + cursor_on_column_));
+    Flush();
 #endif
 }
 
-void Ssd1306::SetColumnRow([[maybe_unused]] uint8_t column, [[maybe_unused]] uint8_t row) {
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
+void Ssd1306::ColumnRowCommands(uint8_t column, uint8_t row, uint8_t* commands) const {
     auto column_add = static_cast<uint8_t>(column * ssd1306::oled::font8x6::kCharW);
 
     if (have_sh1106_) {
         column_add = static_cast<uint8_t>(column_add + 4);
     }
 
-    SendCommand(ssd1306::cmd::kSetLowcolumn | (column_add & 0xF));
-    SendCommand(ssd1306::cmd::kSetHighcolumn | static_cast<uint8_t>(column_add >> 4));
-    SendCommand(ssd1306::cmd::kSetStartpage | row);
-#endif
+    commands[0] = ssd1306::mode::kCommand;
+    commands[1] = static_cast<uint8_t>(ssd1306::cmd::kSetLowcolumn | (column_add & 0xF));
+    commands[2] = static_cast<uint8_t>(ssd1306::cmd::kSetHighcolumn | (column_add >> 4));
+    commands[3] = static_cast<uint8_t>(ssd1306::cmd::kSetStartpage | row);
+}
+
+/**
+ * Sets the GDDRAM address with a single command transfer.
+ */
+void Ssd1306::SetColumnRow(uint8_t column, uint8_t row) {
+    uint8_t commands[4];
+    ColumnRowCommands(column, row, commands);
+    SendData(commands, sizeof(commands));
 }
 
 void Ssd1306::DumpShadowRam() {
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
 #ifndef NDEBUG
     for (uint32_t i = 0; i < rows_; i++) {
         printf("%d: [%.*s]\n", i, ssd1306::oled::font8x6::kCols, &shadow_ram_[i * ssd1306::oled::font8x6::kCols]);
     }
 #endif
-#endif
 }
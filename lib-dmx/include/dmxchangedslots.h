@@ -0,0 +1,110 @@
+/**
+ * @file dmxchangedslots.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef DMXCHANGEDSLOTS_H_
+#define DMXCHANGEDSLOTS_H_
+
+#include <cstdint>
+
+#include "dmxconst.h"
+
+namespace dmx {
+struct SlotRange {
+    uint32_t first; ///< First changed slot, 1..512
+    uint32_t last;  ///< Last changed slot, inclusive
+};
+
+struct ChangedSlots {
+    static constexpr uint32_t kWords = dmx::kChannelsMax / 32;
+
+    uint32_t dirty[kWords]; ///< Bit n is set when slot n + 1 has changed
+    uint32_t first;         ///< First changed slot, 0 when no slot has changed
+    uint32_t last;          ///< Last changed slot, 0 when no slot has changed
+
+    bool IsChanged(uint32_t slot) const {
+        const auto kBit = slot - 1;
+        return (kBit < dmx::kChannelsMax) && ((dirty[kBit >> 5] & (1U << (kBit & 31))) != 0);
+    }
+
+    /**
+     * Iterates the runs of consecutive changed slots.
+     * @param slot Start the search at this slot. On return it is the slot following the range.
+     * @param range The next run of changed slots.
+     * @return false when there are no more changed slots.
+     */
+    bool NextRange(uint32_t& slot, SlotRange& range) const {
+        if ((first == 0) || (slot > last)) {
+            return false;
+        }
+
+        const auto kBegin = FindBit<true>(((slot > first) ? slot : first) - 1);
+
+        if (kBegin >= last) {
+            return false;
+        }
+
+        const auto kEnd = FindBit<false>(kBegin);
+
+        range.first = kBegin + 1;
+        range.last = kEnd;
+        slot = kEnd + 1;
+
+        return true;
+    }
+
+    /**
+     * The changed slots as a range of the data without the START Code, bounded by length.
+     * @return false when no slot within the length has changed.
+     */
+    bool GetDataRange(uint32_t length, uint32_t& offset, uint32_t& count) const {
+        if ((first == 0) || (first > length)) {
+            return false;
+        }
+
+        offset = first - 1;
+        count = ((last < length) ? last : length) - offset;
+
+        return true;
+    }
+
+   private:
+    template <bool is_set> uint32_t FindBit(uint32_t bit) const {
+        while (bit < dmx::kChannelsMax) {
+            auto word = is_set ? dirty[bit >> 5] : ~dirty[bit >> 5];
+            word &= (UINT32_MAX << (bit & 31));
+
+            if (word != 0) {
+                return (bit & ~31U) + static_cast<uint32_t>(__builtin_ctz(word));
+            }
+
+            bit = (bit & ~31U) + 32;
+        }
+
+        return dmx::kChannelsMax;
+    }
+};
+} // namespace dmx
+
+#endif // DMXCHANGEDSLOTS_H_
@@ -38,6 +38,8 @@ enum class OutputStyle {
 
 enum class SendStyle { kDirect, kSync };
 
+enum class RdmReceiveStatus { kIdle, kPending, kReceived, kTimeOut };
+
 inline constexpr uint32_t kStartCode = 0; ///< The start code for DMX512 data. This is often referred to as NSC for "Null Start Code".
 inline constexpr uint32_t kChannelsMin = 2;
 inline constexpr uint32_t kChannelsMax = 512;
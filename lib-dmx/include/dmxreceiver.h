@@ -30,6 +30,7 @@
 
 #include "dmx.h" // IWYU pragma: keep
 #include "dmxnode_outputtype.h"
+#include "dmxnodedata.h"
 #include "board_statusled.h"
 
 class DMXReceiver : Dmx {
@@ -62,7 +63,7 @@ class DMXReceiver : Dmx {
             return nullptr;
         }
 
-        const auto* dmx_available = Dmx::GetDmxAvailable(0);
+        const auto* dmx_available = Dmx::GetDmxChangedSlots(0, changed_slots_);
 
         if (__builtin_expect((dmx_available != nullptr), 0)) {
             const auto* dmx_statistics = reinterpret_cast<const struct Data*>(dmx_available);
@@ -100,10 +101,47 @@ class DMXReceiver : Dmx {
 
     const uint8_t* GetDmxCurrentData(uint32_t port_index) { return Dmx::GetDmxCurrentData(port_index); }
 
+    /**
+     * The slots changed with the data returned by the last Run
+     */
+    const dmx::ChangedSlots& GetChangedSlots() const { return changed_slots_; }
+
+    /**
+     * Merges the data returned by the last Run into a source of the port.
+     * Only the changed slots are copied and merged, a change of the packet length merges all slots.
+     */
+    void MergeSourceA(uint32_t port_index, const uint8_t* data, uint32_t length, dmxnode::MergeMode merge_mode) {
+        uint32_t offset, count;
+
+        if (GetMergeRange(port_index, length, offset, count)) {
+            dmxnode::Data::MergeSourceA(port_index, data, length, merge_mode, offset, count);
+        }
+    }
+
+    void MergeSourceB(uint32_t port_index, const uint8_t* data, uint32_t length, dmxnode::MergeMode merge_mode) {
+        uint32_t offset, count;
+
+        if (GetMergeRange(port_index, length, offset, count)) {
+            dmxnode::Data::MergeSourceB(port_index, data, length, merge_mode, offset, count);
+        }
+    }
+
     void Print() { printf(" Output %s\n", disable_output_ ? "disabled" : "enabled"); }
 
+   private:
+    bool GetMergeRange(uint32_t port_index, uint32_t length, uint32_t& offset, uint32_t& count) const {
+        if (dmxnode::Data::GetLength(port_index) != length) {
+            offset = 0;
+            count = length;
+            return true;
+        }
+
+        return changed_slots_.GetDataRange(length, offset, count);
+    }
+
    private:
     DmxNodeOutputType* dmx_node_output_type_{nullptr};
+    dmx::ChangedSlots changed_slots_{};
     bool is_active_{false};
     bool disable_output_{false};
 };
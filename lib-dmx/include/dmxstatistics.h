@@ -33,6 +33,7 @@ struct TotalStatistics {
     struct Dmx {
         uint32_t sent;
         uint32_t received;
+        uint32_t transmit_timeout;
     } dmx;
 
     struct Rdm {
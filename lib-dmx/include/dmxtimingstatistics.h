@@ -0,0 +1,99 @@
+/**
+ * @file dmxtimingstatistics.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef DMXTIMINGSTATISTICS_H_
+#define DMXTIMINGSTATISTICS_H_
+
+#include <cstdint>
+
+namespace dmx {
+/**
+ * Measured transmit timing in microseconds.
+ * The buckets count the deviation from the configured value:
+ * bucket[0] is an exact match, bucket[n] is a deviation of 2^(n-1) .. 2^n - 1 us.
+ * The last bucket also counts all larger deviations.
+ */
+struct TimingHistogram {
+    static constexpr uint32_t kBuckets = 16;
+
+    uint32_t bucket[kBuckets];
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+
+    void Reset() {
+        for (auto& b : bucket) {
+            b = 0;
+        }
+        count = 0;
+        min = UINT32_MAX;
+        max = 0;
+        sum = 0;
+    }
+
+    void Add(uint32_t measured, uint32_t configured) {
+        const auto kDeviation = (measured > configured) ? (measured - configured) : (configured - measured);
+        bucket[BucketIndex(kDeviation)]++;
+        count++;
+        sum += measured;
+
+        if (measured < min) {
+            min = measured;
+        }
+
+        if (measured > max) {
+            max = measured;
+        }
+    }
+
+    uint32_t Min() const { return (count == 0) ? 0 : min; }
+
+    uint32_t Mean() const { return (count == 0) ? 0 : static_cast<uint32_t>(sum / count); }
+
+    static constexpr uint32_t BucketIndex(uint32_t deviation) {
+        if (deviation == 0) {
+            return 0;
+        }
+
+        const auto kIndex = 32U - static_cast<uint32_t>(__builtin_clz(deviation));
+        return (kIndex < kBuckets) ? kIndex : kBuckets - 1;
+    }
+};
+
+struct TimingStatistics {
+    TimingHistogram break_time;
+    TimingHistogram mab_time;
+    TimingHistogram period; ///< Break to break, OutputStyle::kConstant only
+};
+
+static_assert(TimingHistogram::BucketIndex(0) == 0);
+static_assert(TimingHistogram::BucketIndex(1) == 1);
+static_assert(TimingHistogram::BucketIndex(3) == 2);
+static_assert(TimingHistogram::BucketIndex(4) == 3);
+static_assert(TimingHistogram::BucketIndex(UINT32_MAX) == TimingHistogram::kBuckets - 1);
+} // namespace dmx
+
+#endif // DMXTIMINGSTATISTICS_H_
@@ -31,6 +31,8 @@
 #include "dmxconst.h"
 #include "dmx/dmx_config.h"
 #include "dmxstatistics.h"
+#include "dmxtimingstatistics.h"
+#include "dmxchangedslots.h"
 
 struct Statistics {
     uint32_t slots_in_packet;
@@ -57,6 +59,7 @@ class Dmx {
     void ClearData(uint32_t port_index);
 
     volatile dmx::TotalStatistics& GetTotalStatistics(uint32_t port_index);
+    const dmx::TimingStatistics& GetTimingStatistics(uint32_t port_index) const;
 
     // DMX Transmit
     void SetTransmitBreakTime(uint32_t break_time);
@@ -77,6 +80,19 @@ class Dmx {
     template <dmx::SendStyle dmxSendStyle> 
     void SetTransmitDataWithoutSC(uint32_t port_index, const uint8_t* data, uint32_t length);
 
+    /**
+     * Zero-copy transmit: render directly into the inactive transmit buffer.
+     * The buffer is not picked up for transmission until it is committed, every acquire must be followed by a commit.
+     * @return The transmit buffer, [0] is set to the START Code and may be overwritten, slots at [1..512]
+     */
+    uint8_t* AcquireTransmitBuffer(uint32_t port_index);
+
+    /**
+     * @param length The number of slots rendered, without the START Code
+     */
+    template <dmx::SendStyle dmxSendStyle> 
+    void CommitTransmitBuffer(uint32_t port_index, uint32_t length);
+
     void Sync();
 
     void SetOutputStyle(uint32_t port_index, dmx::OutputStyle output_style);
@@ -89,6 +105,11 @@ class Dmx {
     const uint8_t* GetDmxAvailable(uint32_t port_index);
     const uint8_t* GetDmxChanged(uint32_t port_index);
     const uint8_t* GetDmxCurrentData(uint32_t port_index);
+    /**
+     * Same as GetDmxAvailable, and returns the slots changed since the previous call.
+     * The changed slots are shared with GetDmxChanged, use only one of both per port.
+     */
+    const uint8_t* GetDmxChangedSlots(uint32_t port_index, dmx::ChangedSlots& changed_slots);
 
     uint32_t GetDmxUpdatesPerSecond(uint32_t port_index);
 
@@ -98,7 +119,17 @@ class Dmx {
 
     // RDM Receive
     const uint8_t* RdmReceive(uint32_t port_index);
-    const uint8_t* RdmReceiveTimeOut(uint32_t port_index, uint16_t time_out);
+    /**
+     * Non-blocking RDM receive with timeout (us).
+     * The timeout starts at the data direction turnaround after the RDM request has been sent.
+     */
+    void RdmReceiveStart(uint32_t port_index, uint16_t time_out);
+    /**
+     * @return kReceived or kTimeOut once per RdmReceiveStart, kPending while waiting.
+     * The callback, when set, is called from here on completion, with nullptr on timeout.
+     */
+    dmx::RdmReceiveStatus RdmReceivePoll(uint32_t port_index, const uint8_t*& rdm_data);
+    void SetRdmReceiveCallback(void (*callback)(uint32_t port_index, const uint8_t* rdm_data)) { rdm_receive_callback_ = callback; }
 
     static Dmx* Get() { return s_this; }
 
@@ -109,6 +140,8 @@ class Dmx {
     template <uint32_t portIndex, bool hasStartCode, dmx::SendStyle dmxSendStyle> 
     void SetSendDataInternal(const uint8_t* data, uint32_t length);
 
+    void TransmitBufferCommit(uint32_t port_index, uint32_t length);
+
     template <uint32_t portIndex> 
     void RdmSendDataInternal(const uint8_t* data, uint32_t length);
 
@@ -124,6 +157,7 @@ class Dmx {
     uint16_t transmit_slots_{dmx::kChannelsMax};
     dmx::Direction port_direction_[dmx::config::max::kPorts];
     bool has_continuos_output_{false};
+    void (*rdm_receive_callback_)(uint32_t port_index, const uint8_t* rdm_data){nullptr};
 
     inline static Dmx* s_this;
 };
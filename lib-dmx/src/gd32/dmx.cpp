@@ -44,6 +44,7 @@
 #include "e120.h"
 #include "rdmconst.h"
 #include "rdm_e120.h"
+#include "rdmchecksum.h"
 #include "timing.h"
 #include "gd32.h"
 #include "gd32_dma.h"
@@ -62,6 +63,10 @@ extern struct HwTimersSeconds gv_seconds;
 namespace dmx {
 static constexpr auto kDmxSlotsCompleteFlag = 0x8000U;
 static constexpr auto kRdmSlotsCompleteFlag = 0x4000U;
+static constexpr uint32_t kTransmitCompletePollTime = 44; ///< us, one slot
+static constexpr uint32_t kTransmitCompleteRetriesMax = 8;
+static constexpr uint32_t kTimerCompareMin = 4;          ///< us
+static constexpr uint32_t kCyclesPerUs = (MCU_CLOCK_FREQ / 1000000U);
 
 enum class TxRxState { 
   kIdle, 
@@ -77,6 +82,7 @@ enum class TxRxState {
 
 enum class RdmTxState { 
   kIdle, 
+  kInter,
   kBreak,
   kMab,
   kData,
@@ -99,12 +105,14 @@ struct DmxTxPacket {
     uint32_t write_index;
     uint32_t read_index;
     bool data_pending;
+    volatile bool acquired; // The write buffer is being rendered, do not pick it up for transmission
 };
 
 struct DmxTxData {
     DmxTxPacket dmx;
     OutputStyle output_style ALIGNED;
     volatile TxRxState state;
+    uint32_t transmit_complete_retries;
 };
 
 struct RdmTxDataPacket {
@@ -119,12 +127,19 @@ struct RdmTxPacket {
 struct RdmTxData {
     RdmTxPacket rdm;
     volatile RdmTxState state;
+    bool discovery_response;
+};
+
+struct RdmReceiveTimeOut {
+    volatile RdmReceiveStatus status;
+    uint16_t time_out;
 };
 
 struct DmxTransmit {
     uint32_t break_time;
     uint32_t mab_time;
     uint32_t inter_time;
+    uint32_t period;
 };
 
 struct RxDmxPackets {
@@ -136,6 +151,7 @@ struct RxDmxPackets {
 struct RxDmxData {
     uint8_t data[dmx::buffer::kSize] ALIGNED; // multiple of uint32_t
     uint32_t slots_in_packet;
+    uint32_t dirty[dmx::ChangedSlots::kWords]; // Bit n is set when slot n + 1 has changed
 };
 
 #if defined(CONFIG_DMX_DOUBLE_INPUT_BUFFER)
@@ -151,7 +167,7 @@ struct RxData {
 #else
         volatile RxDmxData current;
 #endif
-        RxDmxData previous;
+        uint32_t previous_slots_in_packet;
     } dmx ALIGNED;
     struct Rdm {
         volatile uint8_t data[sizeof(struct TRdmMessage)] ALIGNED;
@@ -166,6 +182,8 @@ struct DirGpio {
 };
 } // namespace dmx
 
+static_assert(offsetof(dmx::RxDmxData, slots_in_packet) == offsetof(struct Data, statistics.slots_in_packet));
+
 static constexpr dmx::DirGpio kDirGpio[DMX_MAX_PORTS] = {
     {dmx::config::kDirPort0GpioPort, dmx::config::kDirPort0GpioPin},
 #if DMX_MAX_PORTS >= 2
@@ -208,6 +226,59 @@ static dmx::DmxTxData s_DmxTxBuffer[dmx::config::max::kPorts] ALIGNED SECTION_DM
 static dmx::DmxTransmit s_dmx_transmit;
 // RDM TX
 static dmx::RdmTxData s_RdmTxBuffer[dmx::config::max::kPorts] ALIGNED SECTION_DMA_BUFFER;
+// RDM RX timeout
+static dmx::RdmReceiveTimeOut s_rdm_receive[dmx::config::max::kPorts];
+
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+// DMX TX timing
+struct TxTimestamp {
+    uint32_t break_start;
+    uint32_t mab_start;
+    bool has_break;
+};
+
+static dmx::TimingStatistics s_timing_statistics[dmx::config::max::kPorts];
+static TxTimestamp s_tx_timestamp[dmx::config::max::kPorts];
+
+template <uint32_t portIndex> 
+inline void TimingBreakStart() {
+    const auto kNow = DWT->CYCCNT;
+    auto& timestamp = s_tx_timestamp[portIndex];
+
+    if (timestamp.has_break && (s_DmxTxBuffer[portIndex].output_style == dmx::OutputStyle::kConstant)) {
+        s_timing_statistics[portIndex].period.Add((kNow - timestamp.break_start) / dmx::kCyclesPerUs, s_dmx_transmit.period);
+    }
+
+    timestamp.break_start = kNow;
+    timestamp.has_break = true;
+}
+
+template <uint32_t portIndex> 
+inline void TimingMabStart() {
+    const auto kNow = DWT->CYCCNT;
+    auto& timestamp = s_tx_timestamp[portIndex];
+
+    s_timing_statistics[portIndex].break_time.Add((kNow - timestamp.break_start) / dmx::kCyclesPerUs, s_dmx_transmit.break_time);
+    timestamp.mab_start = kNow;
+}
+
+template <uint32_t portIndex> 
+inline void TimingFirstSlot() {
+    const auto kNow = DWT->CYCCNT;
+
+    s_timing_statistics[portIndex].mab_time.Add((kNow - s_tx_timestamp[portIndex].mab_start) / dmx::kCyclesPerUs, s_dmx_transmit.mab_time);
+}
+
+// The next BREAK does not close a period, the output has stopped or changed style
+inline void TimingRestart(uint32_t port_index) {
+    s_tx_timestamp[port_index].has_break = false;
+}
+#else
+template <uint32_t portIndex> inline void TimingBreakStart() {}
+template <uint32_t portIndex> inline void TimingMabStart() {}
+template <uint32_t portIndex> inline void TimingFirstSlot() {}
+inline void TimingRestart([[maybe_unused]] uint32_t port_index) {}
+#endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
 
 #if defined(CONFIG_DMX_DOUBLE_INPUT_BUFFER)
 // The active DMX data buffer for writes
@@ -226,8 +297,20 @@ volatile dmx::RxDmxData& GetReadDmxDataBuffer(uint32_t port_index) {
     return sv_rx_buffer[port_index].dmx.buffer_a;
 }
 
-// Swap the active buffer for writing
+/*
+ * Swap the active buffer for writing.
+ * The dirty bitmap moves with its buffer. Changes not yet taken from the previous read buffer are carried over,
+ * the new write buffer starts clean as it is compared against the new read buffer.
+ */
 void SwapActiveDmxDataBuffer(uint32_t port_index) {
+    auto& completed = GetWriteDmxDataBuffer(port_index);
+    auto& next = GetReadDmxDataBuffer(port_index);
+
+    for (uint32_t i = 0; i < dmx::ChangedSlots::kWords; i++) {
+        completed.dirty[i] = completed.dirty[i] | next.dirty[i];
+        next.dirty[i] = 0;
+    }
+
     if (sv_rx_buffer[port_index].dmx.active == dmx::ActiveBuffer::kA) {
         sv_rx_buffer[port_index].dmx.active = dmx::ActiveBuffer::kB;
     } else {
@@ -236,112 +319,118 @@ void SwapActiveDmxDataBuffer(uint32_t port_index) {
 }
 #endif
 
-template <uint32_t uart, uint32_t port_index> 
-void IrqHandlerDmxRdmInput() {
-	auto& rx_buffer = sv_rx_buffer[port_index];
+/*
+ * The DMX/RDM receive state machine is split into the three events a USART reports:
+ * an IDLE frame, a frame error (BREAK) and a received slot.
+ * Both the per-slot interrupt path and the DMA path are feeding these.
+ */
+
+template <uint32_t port_index> 
+inline void RxSlotChanged(uint32_t slot) {
+    const auto kBit = slot - 1;
 #if defined(CONFIG_DMX_DOUBLE_INPUT_BUFFER)
-    auto& dmx_data_buffer = GetWriteDmxDataBuffer(port_index);
+    auto& dirty = GetWriteDmxDataBuffer(port_index).dirty;
 #else
+    auto& dirty = sv_rx_buffer[port_index].dmx.current.dirty;
 #endif
+    dirty[kBit >> 5] |= (1U << (kBit & 31));
+}
 
-    const auto kIsFlagIdleFrame = (USART_REG_VAL(uart, USART_FLAG_IDLE) & BIT(USART_BIT_POS(USART_FLAG_IDLE))) == BIT(USART_BIT_POS(USART_FLAG_IDLE));
-    /*
-     * Software can clear this bit by reading the USART_STAT and USART_DATA registers one by one.
-     */
-    if (kIsFlagIdleFrame) {
-        static_cast<void>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+template <uint32_t port_index> 
+inline void RxIdleFrame() {
+    auto& rx_buffer = sv_rx_buffer[port_index];
 
 #if defined(CONFIG_DMX_DOUBLE_INPUT_BUFFER)
-        switch (rx_buffer.state) {
-            case dmx::TxRxState::kDmxBreak:
-                break;
-            case dmx::TxRxState::kDmxData: {
-                dmx_data_buffer.slots_in_packet |= dmx::kDmxSlotsCompleteFlag;
-                break;
-            }
-            case dmx::TxRxState::kRdmdisc: {
-                rx_buffer.state = dmx::TxRxState::kIdle;
-                rx_buffer.rdm.index |= dmx::kRdmSlotsCompleteFlag;
-                break;
-            }
-            default: {
-                rx_buffer.state = dmx::TxRxState::kIdle;
-                break;
-            }
-        }
+    auto& dmx_data_buffer = GetWriteDmxDataBuffer(port_index);
 
-        return;
-#else
-        if (rx_buffer.state == dmx::TxRxState::kDmxData) {
+    switch (rx_buffer.state) {
+        case dmx::TxRxState::kDmxBreak:
+            break;
+        case dmx::TxRxState::kDmxData: {
+            dmx_data_buffer.slots_in_packet |= dmx::kDmxSlotsCompleteFlag;
+            break;
+        }
+        case dmx::TxRxState::kRdmdisc: {
             rx_buffer.state = dmx::TxRxState::kIdle;
-            rx_buffer.dmx.current.slots_in_packet |= 0x8000;
-
-            return;
+            rx_buffer.rdm.index |= dmx::kRdmSlotsCompleteFlag;
+            break;
         }
-
-        if (rx_buffer.state == dmx::TxRxState::kRdmdisc) {
+        default: {
             rx_buffer.state = dmx::TxRxState::kIdle;
-            rx_buffer.rdm.index |= 0x4000;
-
-            return;
+            break;
         }
+    }
+#else
+    if (rx_buffer.state == dmx::TxRxState::kDmxData) {
+        rx_buffer.state = dmx::TxRxState::kIdle;
+        rx_buffer.dmx.current.slots_in_packet |= 0x8000;
 
         return;
-#endif
     }
 
-    const auto kIsFlagFrameError = (USART_REG_VAL(uart, USART_FLAG_FERR) & BIT(USART_BIT_POS(USART_FLAG_FERR))) == BIT(USART_BIT_POS(USART_FLAG_FERR));
-    /*
-     * Software can clear this bit by reading the USART_STAT and USART_DATA registers one by one.
-     */
-    if (kIsFlagFrameError) {
-        static_cast<void>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+    if (rx_buffer.state == dmx::TxRxState::kRdmdisc) {
+        rx_buffer.state = dmx::TxRxState::kIdle;
+        rx_buffer.rdm.index |= 0x4000;
+
+        return;
+    }
+#endif
+}
+
+template <uint32_t port_index> 
+inline void RxFrameError() {
+    auto& rx_buffer = sv_rx_buffer[port_index];
 
 #if defined(CONFIG_DMX_DOUBLE_INPUT_BUFFER)
-        switch (rx_buffer.state) {
-            case dmx::TxRxState::kRdmdisc:
-            case dmx::TxRxState::kIdle: {
-                break;
-            }
-            case dmx::TxRxState::kDmxData: {
-                if (!(dmx_data_buffer.slots_in_packet & dmx::kDmxSlotsCompleteFlag)) {
-                    return;
-                }
-                break;
-            }
-            case dmx::TxRxState::kRdmData: {
-                if (!(rx_buffer.rdm.index & dmx::kRdmSlotsCompleteFlag)) {
-                    return;
-                }
-                break;
+    auto& dmx_data_buffer = GetWriteDmxDataBuffer(port_index);
+
+    switch (rx_buffer.state) {
+        case dmx::TxRxState::kRdmdisc:
+        case dmx::TxRxState::kIdle: {
+            break;
+        }
+        case dmx::TxRxState::kDmxData: {
+            if (!(dmx_data_buffer.slots_in_packet & dmx::kDmxSlotsCompleteFlag)) {
+                return;
             }
-            default: {
-                rx_buffer.state = dmx::TxRxState::kIdle;
+            break;
+        }
+        case dmx::TxRxState::kRdmData: {
+            if (!(rx_buffer.rdm.index & dmx::kRdmSlotsCompleteFlag)) {
                 return;
             }
+            break;
         }
-
-        rx_buffer.state = dmx::TxRxState::kDmxBreak;
-        SwapActiveDmxDataBuffer(port_index);
-#else
-        if (rx_buffer.state == dmx::TxRxState::kIdle) {
-            rx_buffer.state = dmx::TxRxState::kDmxBreak;
+        default: {
+            rx_buffer.state = dmx::TxRxState::kIdle;
+            return;
         }
+    }
 
-        return;
-#endif
+    rx_buffer.state = dmx::TxRxState::kDmxBreak;
+    SwapActiveDmxDataBuffer(port_index);
+#else
+    if (rx_buffer.state == dmx::TxRxState::kIdle) {
+        rx_buffer.state = dmx::TxRxState::kDmxBreak;
     }
+#endif
+}
 
-    const auto kData = static_cast<uint8_t>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+template <uint32_t port_index> 
+inline void RxSlot(uint8_t data) {
+    auto& rx_buffer = sv_rx_buffer[port_index];
+#if defined(CONFIG_DMX_DOUBLE_INPUT_BUFFER)
+    auto& dmx_data_buffer = GetWriteDmxDataBuffer(port_index);
+#endif
 
     switch (rx_buffer.state) {
         case dmx::TxRxState::kIdle:
             rx_buffer.state = dmx::TxRxState::kRdmdisc;
-            rx_buffer.rdm.data[0] = kData;
+            rx_buffer.rdm.data[0] = data;
             rx_buffer.rdm.index = 1;
             break;
         case dmx::TxRxState::kDmxBreak:
-            switch (kData) {
+            switch (data) {
                 case dmx::kStartCode:
 #if defined(CONFIG_DMX_DOUBLE_INPUT_BUFFER)
                     dmx_data_buffer.data[0] = dmx::kStartCode;
@@ -372,7 +461,14 @@ void IrqHandlerDmxRdmInput() {
         case dmx::TxRxState::kDmxData: {
 #if defined(CONFIG_DMX_DOUBLE_INPUT_BUFFER)
             dmx_data_buffer.slots_in_packet &= ~dmx::kDmxSlotsCompleteFlag;
-            dmx_data_buffer.data[dmx_data_buffer.slots_in_packet++] = kData;
+            const auto kIndex = dmx_data_buffer.slots_in_packet;
+
+            if (GetReadDmxDataBuffer(port_index).data[kIndex] != data) {
+                RxSlotChanged<port_index>(kIndex);
+            }
+
+            dmx_data_buffer.data[kIndex] = data;
+            dmx_data_buffer.slots_in_packet = kIndex + 1;
 
             if (dmx_data_buffer.slots_in_packet > dmx::kChannelsMax) {
                 dmx_data_buffer.slots_in_packet |= dmx::kDmxSlotsCompleteFlag;
@@ -382,7 +478,12 @@ void IrqHandlerDmxRdmInput() {
             }
 #else
             auto index = rx_buffer.dmx.current.slots_in_packet;
-            rx_buffer.dmx.current.data[index] = kData;
+
+            if (rx_buffer.dmx.current.data[index] != data) {
+                RxSlotChanged<port_index>(index);
+            }
+
+            rx_buffer.dmx.current.data[index] = data;
             index++;
             rx_buffer.dmx.current.slots_in_packet = index;
 
@@ -396,7 +497,7 @@ void IrqHandlerDmxRdmInput() {
         } break;
         case dmx::TxRxState::kRdmData: {
             auto index = rx_buffer.rdm.index;
-            rx_buffer.rdm.data[index] = kData;
+            rx_buffer.rdm.data[index] = data;
             index++;
             rx_buffer.rdm.index = index;
 
@@ -410,14 +511,14 @@ void IrqHandlerDmxRdmInput() {
         } break;
         case dmx::TxRxState::kRdmChecksumh: {
             auto index = rx_buffer.rdm.index;
-            rx_buffer.rdm.data[index] = kData;
+            rx_buffer.rdm.data[index] = data;
             index++;
             rx_buffer.rdm.index = index;
             rx_buffer.state = dmx::TxRxState::kRdmChecksuml;
         } break;
         case dmx::TxRxState::kRdmChecksuml: {
             auto index = rx_buffer.rdm.index;
-            rx_buffer.rdm.data[index] = kData;
+            rx_buffer.rdm.data[index] = data;
             index |= 0x4000;
             rx_buffer.rdm.index = index;
             rx_buffer.state = dmx::TxRxState::kIdle;
@@ -427,7 +528,7 @@ void IrqHandlerDmxRdmInput() {
             auto index = rx_buffer.rdm.index;
 
             if (index < 24) {
-                rx_buffer.rdm.data[index] = kData;
+                rx_buffer.rdm.data[index] = data;
                 index++;
                 rx_buffer.rdm.index = index;
             }
@@ -444,6 +545,193 @@ void IrqHandlerDmxRdmInput() {
     }
 }
 
+#if !defined(CONFIG_DMX_RX_DMA)
+template <uint32_t uart, uint32_t port_index> 
+void IrqHandlerDmxRdmInput() {
+    const auto kIsFlagIdleFrame = (USART_REG_VAL(uart, USART_FLAG_IDLE) & BIT(USART_BIT_POS(USART_FLAG_IDLE))) == BIT(USART_BIT_POS(USART_FLAG_IDLE));
+    /*
+     * Software can clear this bit by reading the USART_STAT and USART_DATA registers one by one.
+     */
+    if (kIsFlagIdleFrame) {
+        static_cast<void>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+        RxIdleFrame<port_index>();
+        return;
+    }
+
+    const auto kIsFlagFrameError = (USART_REG_VAL(uart, USART_FLAG_FERR) & BIT(USART_BIT_POS(USART_FLAG_FERR))) == BIT(USART_BIT_POS(USART_FLAG_FERR));
+    /*
+     * Software can clear this bit by reading the USART_STAT and USART_DATA registers one by one.
+     */
+    if (kIsFlagFrameError) {
+        static_cast<void>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+        RxFrameError<port_index>();
+        return;
+    }
+
+    RxSlot<port_index>(static_cast<uint8_t>(GET_BITS(USART_RDATA(uart), 0U, 8U)));
+}
+#else
+/*
+ * DMA receive
+ * The RX DMA channel is running in circular mode into a ring buffer.
+ * The USART interrupts only for an IDLE frame and for a frame error (BREAK).
+ * The DMA half/full transfer interrupts make sure the ring buffer cannot overrun.
+ * In between, the received slots are handed over in bulk to the state machine.
+ */
+namespace dmx {
+inline constexpr uint32_t kRxRingSize = 256;
+static_assert((kRxRingSize & (kRxRingSize - 1)) == 0, "kRxRingSize must be a power of 2");
+
+struct RxDma {
+    uint8_t ring[kRxRingSize] ALIGNED;
+    volatile uint32_t tail;
+};
+} // namespace dmx
+
+static dmx::RxDma s_rx_dma[dmx::config::max::kPorts] ALIGNED SECTION_DMA_BUFFER;
+
+inline uint32_t RxDmaHead(uint32_t dma_periph, dma_channel_enum channelx) {
+    return (dmx::kRxRingSize - DMA_CHCNT(dma_periph, channelx)) & (dmx::kRxRingSize - 1);
+}
+
+template <uint32_t port_index> 
+void RxDmaDrain(uint32_t head) {
+    auto& rx_dma = s_rx_dma[port_index];
+    auto& rx_buffer = sv_rx_buffer[port_index];
+    auto tail = rx_dma.tail;
+
+    while (tail != head) {
+        if (rx_buffer.state == dmx::TxRxState::kDmxData) {
+            // Fast path: DMX slots are copied in bulk, as far as the ring buffer is contiguous.
+#if defined(CONFIG_DMX_DOUBLE_INPUT_BUFFER)
+            auto& dmx_data_buffer = GetWriteDmxDataBuffer(port_index);
+            const auto& previous = GetReadDmxDataBuffer(port_index).data;
+#else
+            auto& dmx_data_buffer = rx_buffer.dmx.current;
+            const auto& previous = dmx_data_buffer.data;
+#endif
+            auto slots_in_packet = dmx_data_buffer.slots_in_packet & ~dmx::kDmxSlotsCompleteFlag;
+            const auto kContiguous = ((head > tail) ? head : dmx::kRxRingSize) - tail;
+            const auto kLength = std::min(kContiguous, (dmx::kChannelsMax + 1) - slots_in_packet);
+
+            for (uint32_t i = 0; i < kLength; i++) {
+                const auto kData = rx_dma.ring[tail + i];
+
+                if (previous[slots_in_packet] != kData) {
+                    RxSlotChanged<port_index>(slots_in_packet);
+                }
+
+                dmx_data_buffer.data[slots_in_packet++] = kData;
+            }
+
+            if (slots_in_packet > dmx::kChannelsMax) {
+                slots_in_packet |= dmx::kDmxSlotsCompleteFlag;
+                rx_buffer.state = dmx::TxRxState::kIdle;
+            }
+
+            dmx_data_buffer.slots_in_packet = slots_in_packet;
+            tail = (tail + kLength) & (dmx::kRxRingSize - 1);
+            continue;
+        }
+
+        RxSlot<port_index>(rx_dma.ring[tail]);
+        tail = (tail + 1) & (dmx::kRxRingSize - 1);
+    }
+
+    rx_dma.tail = tail;
+}
+
+template <uint32_t uart, uint32_t port_index> 
+void IrqHandlerDmxRdmInput() {
+    constexpr auto kDmaPeriph = DmxUartToRxDma(uart);
+    constexpr auto kDmaChannel = DmxUartToRxDmaChannel(uart);
+
+    const auto kIsFlagIdleFrame = (USART_REG_VAL(uart, USART_FLAG_IDLE) & BIT(USART_BIT_POS(USART_FLAG_IDLE))) == BIT(USART_BIT_POS(USART_FLAG_IDLE));
+
+    if (kIsFlagIdleFrame) {
+        static_cast<void>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+        RxDmaDrain<port_index>(RxDmaHead(kDmaPeriph, kDmaChannel));
+        RxIdleFrame<port_index>();
+        return;
+    }
+
+    const auto kIsFlagFrameError = (USART_REG_VAL(uart, USART_FLAG_FERR) & BIT(USART_BIT_POS(USART_FLAG_FERR))) == BIT(USART_BIT_POS(USART_FLAG_FERR));
+
+    if (kIsFlagFrameError) {
+        /*
+         * The BREAK slot is transferred by the DMA as well, the DMA count tells where it is.
+         * The count is read before RBNE: when RBNE is still set, the BREAK slot is not in the ring yet.
+         * USART_DATA is never read while RBNE is set, the slot belongs to the DMA.
+         */
+        auto head = RxDmaHead(kDmaPeriph, kDmaChannel);
+
+        if (Gd32UsartFlagGet<USART_FLAG_RBNE>(uart)) {
+            // The DMA read of USART_DATA completes the FERR clear sequence
+            RxDmaDrain<port_index>(head);
+        } else {
+            // The next slot is at least MAB + 44 us away, reading USART_DATA only clears FERR
+            static_cast<void>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+            head = (RxDmaHead(kDmaPeriph, kDmaChannel) - 1) & (dmx::kRxRingSize - 1);
+            // All slots before the BREAK slot belong to the previous packet
+            RxDmaDrain<port_index>(head);
+        }
+
+        RxFrameError<port_index>();
+        // Skip the BREAK slot
+        s_rx_dma[port_index].tail = (head + 1) & (dmx::kRxRingSize - 1);
+        return;
+    }
+
+    // Noise or overrun error
+    static_cast<void>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+}
+
+template <uint32_t uart, uint32_t port_index> 
+void IrqHandlerDmxRdmInputDma() {
+    constexpr auto kDmaPeriph = DmxUartToRxDma(uart);
+    constexpr auto kDmaChannel = DmxUartToRxDmaChannel(uart);
+
+    Gd32DmaInterruptFlagClear<kDmaPeriph, kDmaChannel, DMA_INT_FLAG_G>();
+
+    auto head = RxDmaHead(kDmaPeriph, kDmaChannel);
+
+    // A pending BREAK slot is left for the frame error interrupt
+    if (Gd32UsartFlagGet<USART_FLAG_FERR>(uart)) {
+        head = (head - 1) & (dmx::kRxRingSize - 1);
+    }
+
+    RxDmaDrain<port_index>(head);
+}
+
+static void RxDmaStart(uint32_t uart, uint32_t port_index) {
+    const auto kDmaPeriph = DmxUartToRxDma(uart);
+    const auto kDmaChannel = DmxUartToRxDmaChannel(uart);
+
+    auto dma_chctl = DMA_CHCTL(kDmaPeriph, kDmaChannel);
+    dma_chctl &= ~DMA_CHXCTL_CHEN;
+    DMA_CHCTL(kDmaPeriph, kDmaChannel) = dma_chctl;
+    DMA_INTC(kDmaPeriph) |= DMA_FLAG_ADD(DMA_INT_FLAG_G, kDmaChannel);
+
+    s_rx_dma[port_index].tail = 0;
+
+    DMA_CHMADDR(kDmaPeriph, kDmaChannel) = reinterpret_cast<uint32_t>(s_rx_dma[port_index].ring);
+    DMA_CHCNT(kDmaPeriph, kDmaChannel) = dmx::kRxRingSize & DMA_CHXCNT_CNT;
+    dma_chctl |= DMA_CHXCTL_CHEN | DMA_INT_FTF | DMA_INT_HTF;
+    DMA_CHCTL(kDmaPeriph, kDmaChannel) = dma_chctl;
+
+    USART_CTL2(uart) |= USART_RECEIVE_DMA_ENABLE;
+}
+
+static void RxDmaStop(uint32_t uart) {
+    const auto kDmaPeriph = DmxUartToRxDma(uart);
+    const auto kDmaChannel = DmxUartToRxDmaChannel(uart);
+
+    USART_CTL2(uart) &= ~USART_RECEIVE_DMA_ENABLE;
+    DMA_CHCTL(kDmaPeriph, kDmaChannel) &= ~(DMA_CHXCTL_CHEN | DMA_INT_FTF | DMA_INT_HTF);
+    DMA_INTC(kDmaPeriph) |= DMA_FLAG_ADD(DMA_INT_FLAG_G, kDmaChannel);
+}
+#endif // !defined(CONFIG_DMX_RX_DMA)
+
 template <uint32_t UsartPeripheral, uint32_t DmaController, dma_channel_enum DmaChannel> 
 void DmaStartTx(const uint8_t* data, uint32_t length) {
     auto dma_chctl = DMA_CHCTL(DmaController, DmaChannel);
@@ -466,7 +754,7 @@ template <uint32_t UsartPeripheral, uint32_t DmaController, dma_channel_enum Dma
 void DmaRestartDmxTx(TxBufferType& tx_buffer) {
     auto& dmx = tx_buffer.dmx;
 
-    if (dmx.read_index != dmx.write_index) {
+    if ((dmx.read_index != dmx.write_index) && !dmx.acquired) {
         dmx.read_index ^= 1;
     }
 
@@ -488,6 +776,115 @@ void DmaStartRdmTx(TxBufferType& tx_buffer) {
 #define DMA_START_RDM_TX(PORT_INDEX, USARTx, DMAx, CHx) \
     DmaStartRdmTx<USARTx, DMAx, CHx>(s_RdmTxBuffer[PORT_INDEX])
 
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+template <uint32_t portIndex> 
+inline void RdmSentCount() {
+    auto& sent = sv_total_statistics[portIndex].rdm.sent;
+
+    if (s_RdmTxBuffer[portIndex].discovery_response) {
+        sent.discovery_response = sent.discovery_response + 1;
+    } else {
+        sent.classes = sent.classes + 1;
+    }
+}
+#endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+
+static void TimerCompareSet(uint32_t uart, uint32_t ticks) {
+    switch (uart) {
+// TIMER 1
+#if defined(DMX_USE_USART0)
+        case USART0:
+            TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + ticks;
+            break;
+#endif
+#if defined(DMX_USE_USART1)
+        case USART1:
+            TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + ticks;
+            break;
+#endif
+#if defined(DMX_USE_USART2)
+        case USART2:
+            TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + ticks;
+            break;
+#endif
+#if defined(DMX_USE_UART3)
+        case UART3:
+            TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + ticks;
+            break;
+#endif
+// TIMER 4
+#if defined(DMX_USE_UART4)
+        case UART4:
+            TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + ticks;
+            break;
+#endif
+#if defined(DMX_USE_USART5)
+        case USART5:
+            TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + ticks;
+            break;
+#endif
+#if defined(DMX_USE_UART6)
+        case UART6:
+            TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + ticks;
+            break;
+#endif
+#if defined(DMX_USE_UART7)
+        case UART7:
+            TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + ticks;
+            break;
+#endif
+        default:
+            [[unlikely]] assert(false);
+            break;
+    }
+}
+
+/**
+ * The RDM receive timeout uses the port's TIMER compare channel when no DMX/RDM output is running.
+ * It must be checked before the output state machine, which arms it at the data direction turnaround.
+ */
+template <uint32_t portIndex> 
+inline void RdmReceiveTimeOutArm() {
+    if (s_rdm_receive[portIndex].status == dmx::RdmReceiveStatus::kPending) {
+        TimerCompareSet(DmxPortToUart(portIndex), s_rdm_receive[portIndex].time_out);
+    }
+}
+
+template <uint32_t portIndex> 
+inline void RdmReceiveTimeOutCheck() {
+    if ((s_rdm_receive[portIndex].status == dmx::RdmReceiveStatus::kPending) && (s_DmxTxBuffer[portIndex].state == dmx::TxRxState::kIdle) &&
+        (s_RdmTxBuffer[portIndex].state == dmx::RdmTxState::kIdle)) {
+        s_rdm_receive[portIndex].status = dmx::RdmReceiveStatus::kTimeOut;
+    }
+}
+
+/**
+ * The break must not start before the last slot has been shifted out, for DMX and for RDM.
+ * When USART_FLAG_TC is not yet set, the TIMER compare is re-armed for one slot time.
+ * A USART that never completes is counted as a transmit timeout and the break is forced.
+ */
+template <uint32_t portIndex, uint32_t nUart> 
+static bool IsDmxOutputBreakReady() {
+    auto& tx_buffer = s_DmxTxBuffer[portIndex];
+
+    if (Gd32UsartFlagGet<USART_FLAG_TC>(nUart)) [[likely]] {
+        tx_buffer.transmit_complete_retries = 0;
+        return true;
+    }
+
+    if (++tx_buffer.transmit_complete_retries < dmx::kTransmitCompleteRetriesMax) {
+        TimerCompareSet(nUart, dmx::kTransmitCompletePollTime);
+        return false;
+    }
+
+    tx_buffer.transmit_complete_retries = 0;
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+    const auto kTimeout = sv_total_statistics[portIndex].dmx.transmit_timeout + 1;
+    sv_total_statistics[portIndex].dmx.transmit_timeout = kTimeout;
+#endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+    return true;
+}
+
 extern "C" {
 #if !defined(CONFIG_DMX_TRANSMIT_ONLY)
 #if defined(DMX_USE_USART0)
@@ -537,19 +934,56 @@ void UART7_IRQHandler() {
     IrqHandlerDmxRdmInput<UART7, dmx::config::kUart7Port>();
 }
 #endif // defined(DMX_USE_UART7)
+
+#if defined(CONFIG_DMX_RX_DMA)
+#if defined(DMX_USE_USART0)
+static_assert(USART0_RX_DMA_CHx == DMA_CH4);
+void DMA0_Channel4_IRQHandler() {
+    IrqHandlerDmxRdmInputDma<USART0, dmx::config::kUsart0Port>();
+}
+#endif // defined(DMX_USE_USART0)
+
+#if defined(DMX_USE_USART1)
+static_assert(USART1_RX_DMA_CHx == DMA_CH5);
+void DMA0_Channel5_IRQHandler() {
+    IrqHandlerDmxRdmInputDma<USART1, dmx::config::kUsart1Port>();
+}
+#endif // defined(DMX_USE_USART1)
+
+#if defined(DMX_USE_USART2)
+static_assert(USART2_RX_DMA_CHx == DMA_CH2);
+void DMA0_Channel2_IRQHandler() {
+    IrqHandlerDmxRdmInputDma<USART2, dmx::config::kUsart2Port>();
+}
+#endif // defined(DMX_USE_USART2)
+
+#if defined(DMX_USE_UART3)
+static_assert(UART3_RX_DMA_CHx == DMA_CH2);
+void DMA1_Channel2_IRQHandler() {
+    IrqHandlerDmxRdmInputDma<UART3, dmx::config::kUart3Port>();
+}
+#endif // defined(DMX_USE_UART3)
+#endif // defined(CONFIG_DMX_RX_DMA)
 #endif // !defined(CONFIG_DMX_TRANSMIT_ONLY)
 
 void TIMER1_IRQHandler() {
 // USART 0
 #if defined(DMX_USE_USART0)
     if ((TIMER_INTF(TIMER1) & TIMER_INT_FLAG_CH0) == TIMER_INT_FLAG_CH0) {
+        RdmReceiveTimeOutCheck<dmx::config::kUsart0Port>();
+
         if (s_DmxTxBuffer[dmx::config::kUsart0Port].state != dmx::TxRxState::kIdle) [[likely]] {
             switch (s_DmxTxBuffer[dmx::config::kUsart0Port].state) {
                 case dmx::TxRxState::kDmxInter:
                     [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUsart0Port, USART0>()) [[unlikely]] {
+                            break;
+                        }
+
                         Gd32GpioModeOutput<USART0_GPIOx, USART0_TX_GPIO_PINx>();
                         GPIO_BC(USART0_GPIOx) = USART0_TX_GPIO_PINx;
                         s_DmxTxBuffer[dmx::config::kUsart0Port].state = dmx::TxRxState::kDmxBreak;
+                        TimingBreakStart<dmx::config::kUsart0Port>();
                         TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
                     }
                     break;
@@ -558,12 +992,14 @@ void TIMER1_IRQHandler() {
                     [[likely]] {
                         Gd32GpioModeAf<USART0_GPIOx, USART0_TX_GPIO_PINx, USART0>();
                         s_DmxTxBuffer[dmx::config::kUsart0Port].state = dmx::TxRxState::kDmxMab;
+                        TimingMabStart<dmx::config::kUsart0Port>();
                         TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.mab_time;
                     }
                     break;
 
                 case dmx::TxRxState::kDmxMab:
                     [[likely]] {
+                        TimingFirstSlot<dmx::config::kUsart0Port>();
                         DMA_RESTART_DMX_TX(dmx::config::kUsart0Port, USART0, USART0_DMAx, USART0_TX_DMA_CHx);
                     }
                     break;
@@ -573,6 +1009,19 @@ void TIMER1_IRQHandler() {
             }
         } else if (s_RdmTxBuffer[dmx::config::kUsart0Port].state != dmx::RdmTxState::kIdle) {
             switch (s_RdmTxBuffer[dmx::config::kUsart0Port].state) {
+                case dmx::RdmTxState::kInter:
+                    [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUsart0Port, USART0>()) [[unlikely]] {
+                            break;
+                        }
+
+                        Gd32GpioModeOutput<USART0_GPIOx, USART0_TX_GPIO_PINx>();
+                        GPIO_BC(USART0_GPIOx) = USART0_TX_GPIO_PINx;
+                        s_RdmTxBuffer[dmx::config::kUsart0Port].state = dmx::RdmTxState::kBreak;
+                        TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + rdm::transmit::kBreakTimeTypical;
+                    }
+                    break;
+
                 case dmx::RdmTxState::kBreak:
                     [[likely]] {
                         Gd32GpioModeAf<USART0_GPIOx, USART0_TX_GPIO_PINx, USART0>();
@@ -583,6 +1032,10 @@ void TIMER1_IRQHandler() {
 
                 case dmx::RdmTxState::kMab:
                     [[likely]] {
+                        if (s_RdmTxBuffer[dmx::config::kUsart0Port].discovery_response) {
+                            Dmx::Get()->SetPortDirection<dmx::config::kUsart0Port, dmx::Direction::kOutput, false>();
+                        }
+
                         DMA_START_RDM_TX(dmx::config::kUsart0Port, USART0, USART0_DMAx, USART0_TX_DMA_CHx);
                     }
                     break;
@@ -591,10 +1044,10 @@ void TIMER1_IRQHandler() {
                     s_RdmTxBuffer[dmx::config::kUsart0Port].state = dmx::RdmTxState::kIdle;
                     sv_port_state[dmx::config::kUsart0Port] = dmx::PortState::kIdle;
                     Dmx::Get()->SetPortDirection<dmx::config::kUsart0Port, dmx::Direction::kInput, true>();
+                    RdmReceiveTimeOutArm<dmx::config::kUsart0Port>();
 
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
-                    const auto kSent = sv_total_statistics[dmx::config::kUsart0Port].rdm.sent.classes + 1;
-                    sv_total_statistics[dmx::config::kUsart0Port].rdm.sent.classes = kSent;
+                    RdmSentCount<dmx::config::kUsart0Port>();
 #endif //! defined(CONFIG_DMX_DISABLE_STATISTICS)
                 } break;
 
@@ -610,13 +1063,20 @@ void TIMER1_IRQHandler() {
 // USART 1
 #if defined(DMX_USE_USART1)
     if ((TIMER_INTF(TIMER1) & TIMER_INT_FLAG_CH1) == TIMER_INT_FLAG_CH1) {
+        RdmReceiveTimeOutCheck<dmx::config::kUsart1Port>();
+
         if (s_DmxTxBuffer[dmx::config::kUsart1Port].state != dmx::TxRxState::kIdle) [[likely]] {
             switch (s_DmxTxBuffer[dmx::config::kUsart1Port].state) {
                 case dmx::TxRxState::kDmxInter:
                     [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUsart1Port, USART1>()) [[unlikely]] {
+                            break;
+                        }
+
                         Gd32GpioModeOutput<USART1_GPIOx, USART1_TX_GPIO_PINx>();
                         GPIO_BC(USART1_GPIOx) = USART1_TX_GPIO_PINx;
                         s_DmxTxBuffer[dmx::config::kUsart1Port].state = dmx::TxRxState::kDmxBreak;
+                        TimingBreakStart<dmx::config::kUsart1Port>();
                         TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
                     }
                     break;
@@ -625,12 +1085,14 @@ void TIMER1_IRQHandler() {
                     [[likely]] {
                         Gd32GpioModeAf<USART1_GPIOx, USART1_TX_GPIO_PINx, USART1>();
                         s_DmxTxBuffer[dmx::config::kUsart1Port].state = dmx::TxRxState::kDmxMab;
+                        TimingMabStart<dmx::config::kUsart1Port>();
                         TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.mab_time;
                     }
                     break;
 
                 case dmx::TxRxState::kDmxMab:
                     [[likely]] {
+                        TimingFirstSlot<dmx::config::kUsart1Port>();
                         DMA_RESTART_DMX_TX(dmx::config::kUsart1Port, USART1, USART1_DMAx, USART1_TX_DMA_CHx);
                     }
 
@@ -640,6 +1102,19 @@ void TIMER1_IRQHandler() {
             }
         } else if (s_RdmTxBuffer[dmx::config::kUsart1Port].state != dmx::RdmTxState::kIdle) {
             switch (s_RdmTxBuffer[dmx::config::kUsart1Port].state) {
+                case dmx::RdmTxState::kInter:
+                    [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUsart1Port, USART1>()) [[unlikely]] {
+                            break;
+                        }
+
+                        Gd32GpioModeOutput<USART1_GPIOx, USART1_TX_GPIO_PINx>();
+                        GPIO_BC(USART1_GPIOx) = USART1_TX_GPIO_PINx;
+                        s_RdmTxBuffer[dmx::config::kUsart1Port].state = dmx::RdmTxState::kBreak;
+                        TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + rdm::transmit::kBreakTimeTypical;
+                    }
+                    break;
+
                 case dmx::RdmTxState::kBreak:
                     [[likely]] {
                         Gd32GpioModeAf<USART1_GPIOx, USART1_TX_GPIO_PINx, USART1>();
@@ -650,6 +1125,10 @@ void TIMER1_IRQHandler() {
 
                 case dmx::RdmTxState::kMab:
                     [[likely]] {
+                        if (s_RdmTxBuffer[dmx::config::kUsart1Port].discovery_response) {
+                            Dmx::Get()->SetPortDirection<dmx::config::kUsart1Port, dmx::Direction::kOutput, false>();
+                        }
+
                         DMA_START_RDM_TX(dmx::config::kUsart1Port, USART1, USART1_DMAx, USART1_TX_DMA_CHx);
                     }
                     break;
@@ -658,10 +1137,10 @@ void TIMER1_IRQHandler() {
                     s_RdmTxBuffer[dmx::config::kUsart1Port].state = dmx::RdmTxState::kIdle;
                     sv_port_state[dmx::config::kUsart1Port] = dmx::PortState::kIdle;
                     Dmx::Get()->SetPortDirection<dmx::config::kUsart1Port, dmx::Direction::kInput, true>();
+                    RdmReceiveTimeOutArm<dmx::config::kUsart1Port>();
 
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
-                    const auto kSent = sv_total_statistics[dmx::config::kUsart1Port].rdm.sent.classes + 1;
-                    sv_total_statistics[dmx::config::kUsart1Port].rdm.sent.classes = kSent;
+                    RdmSentCount<dmx::config::kUsart1Port>();
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
                 } break;
 
@@ -679,13 +1158,20 @@ void TIMER1_IRQHandler() {
 // USART 2
 #if defined(DMX_USE_USART2)
     if ((TIMER_INTF(TIMER1) & TIMER_INT_FLAG_CH2) == TIMER_INT_FLAG_CH2) {
+        RdmReceiveTimeOutCheck<dmx::config::kUsart2Port>();
+
         if (s_DmxTxBuffer[dmx::config::kUsart2Port].state != dmx::TxRxState::kIdle) [[likely]] {
             switch (s_DmxTxBuffer[dmx::config::kUsart2Port].state) {
                 case dmx::TxRxState::kDmxInter:
                     [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUsart2Port, USART2>()) [[unlikely]] {
+                            break;
+                        }
+
                         Gd32GpioModeOutput<USART2_GPIOx, USART2_TX_GPIO_PINx>();
                         GPIO_BC(USART2_GPIOx) = USART2_TX_GPIO_PINx;
                         s_DmxTxBuffer[dmx::config::kUsart2Port].state = dmx::TxRxState::kDmxBreak;
+                        TimingBreakStart<dmx::config::kUsart2Port>();
                         TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
                     }
                     break;
@@ -694,12 +1180,14 @@ void TIMER1_IRQHandler() {
                     [[likely]] {
                         Gd32GpioModeAf<USART2_GPIOx, USART2_TX_GPIO_PINx, USART2>();
                         s_DmxTxBuffer[dmx::config::kUsart2Port].state = dmx::TxRxState::kDmxMab;
+                        TimingMabStart<dmx::config::kUsart2Port>();
                         TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.mab_time;
                     }
                     break;
 
                 case dmx::TxRxState::kDmxMab:
                     [[likely]] {
+                        TimingFirstSlot<dmx::config::kUsart2Port>();
                         DMA_RESTART_DMX_TX(dmx::config::kUsart2Port, USART2, USART2_DMAx, USART2_TX_DMA_CHx);
                     }
                     break;
@@ -710,6 +1198,19 @@ void TIMER1_IRQHandler() {
             }
         } else if (s_RdmTxBuffer[dmx::config::kUsart2Port].state != dmx::RdmTxState::kIdle) {
             switch (s_RdmTxBuffer[dmx::config::kUsart2Port].state) {
+                case dmx::RdmTxState::kInter:
+                    [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUsart2Port, USART2>()) [[unlikely]] {
+                            break;
+                        }
+
+                        Gd32GpioModeOutput<USART2_GPIOx, USART2_TX_GPIO_PINx>();
+                        GPIO_BC(USART2_GPIOx) = USART2_TX_GPIO_PINx;
+                        s_RdmTxBuffer[dmx::config::kUsart2Port].state = dmx::RdmTxState::kBreak;
+                        TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + rdm::transmit::kBreakTimeTypical;
+                    }
+                    break;
+
                 case dmx::RdmTxState::kBreak:
                     [[likely]] {
                         Gd32GpioModeAf<USART2_GPIOx, USART2_TX_GPIO_PINx, USART2>();
@@ -720,6 +1221,10 @@ void TIMER1_IRQHandler() {
 
                 case dmx::RdmTxState::kMab:
                     [[likely]] {
+                        if (s_RdmTxBuffer[dmx::config::kUsart2Port].discovery_response) {
+                            Dmx::Get()->SetPortDirection<dmx::config::kUsart2Port, dmx::Direction::kOutput, false>();
+                        }
+
                         DMA_START_RDM_TX(dmx::config::kUsart2Port, USART2, USART2_DMAx, USART2_TX_DMA_CHx);
                     }
                     break;
@@ -728,10 +1233,10 @@ void TIMER1_IRQHandler() {
                     s_RdmTxBuffer[dmx::config::kUsart2Port].state = dmx::RdmTxState::kIdle;
                     sv_port_state[dmx::config::kUsart2Port] = dmx::PortState::kIdle;
                     Dmx::Get()->SetPortDirection<dmx::config::kUsart2Port, dmx::Direction::kInput, true>();
+                    RdmReceiveTimeOutArm<dmx::config::kUsart2Port>();
 
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
-                    const auto kSent = sv_total_statistics[dmx::config::kUsart2Port].rdm.sent.classes + 1;
-                    sv_total_statistics[dmx::config::kUsart2Port].rdm.sent.classes = kSent;
+                    RdmSentCount<dmx::config::kUsart2Port>();
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
                 } break;
 
@@ -749,13 +1254,20 @@ void TIMER1_IRQHandler() {
 // UART 3
 #if defined(DMX_USE_UART3)
     if ((TIMER_INTF(TIMER1) & TIMER_INT_FLAG_CH3) == TIMER_INT_FLAG_CH3) {
+        RdmReceiveTimeOutCheck<dmx::config::kUart3Port>();
+
         if (s_DmxTxBuffer[dmx::config::kUart3Port].state != dmx::TxRxState::kIdle) [[likely]] {
             switch (s_DmxTxBuffer[dmx::config::kUart3Port].state) {
                 case dmx::TxRxState::kDmxInter:
                     [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUart3Port, UART3>()) [[unlikely]] {
+                            break;
+                        }
+
                         Gd32GpioModeOutput<UART3_GPIOx, UART3_TX_GPIO_PINx>();
                         GPIO_BC(UART3_GPIOx) = UART3_TX_GPIO_PINx;
                         s_DmxTxBuffer[dmx::config::kUart3Port].state = dmx::TxRxState::kDmxBreak;
+                        TimingBreakStart<dmx::config::kUart3Port>();
                         TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
                     }
                     break;
@@ -763,11 +1275,13 @@ void TIMER1_IRQHandler() {
                     [[likely]] {
                         Gd32GpioModeAf<UART3_GPIOx, UART3_TX_GPIO_PINx, UART3>();
                         s_DmxTxBuffer[dmx::config::kUart3Port].state = dmx::TxRxState::kDmxMab;
+                        TimingMabStart<dmx::config::kUart3Port>();
                         TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.mab_time;
                     }
                     break;
                 case dmx::TxRxState::kDmxMab:
                     [[likely]] {
+                        TimingFirstSlot<dmx::config::kUart3Port>();
                         DMA_RESTART_DMX_TX(dmx::config::kUart3Port, UART3, UART3_DMAx, UART3_TX_DMA_CHx);
                     }
                     break;
@@ -776,6 +1290,19 @@ void TIMER1_IRQHandler() {
             }
         } else if (s_RdmTxBuffer[dmx::config::kUart3Port].state != dmx::RdmTxState::kIdle) {
             switch (s_RdmTxBuffer[dmx::config::kUart3Port].state) {
+                case dmx::RdmTxState::kInter:
+                    [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUart3Port, UART3>()) [[unlikely]] {
+                            break;
+                        }
+
+                        Gd32GpioModeOutput<UART3_GPIOx, UART3_TX_GPIO_PINx>();
+                        GPIO_BC(UART3_GPIOx) = UART3_TX_GPIO_PINx;
+                        s_RdmTxBuffer[dmx::config::kUart3Port].state = dmx::RdmTxState::kBreak;
+                        TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + rdm::transmit::kBreakTimeTypical;
+                    }
+                    break;
+
                 case dmx::RdmTxState::kBreak:
                     [[likely]] {
                         Gd32GpioModeAf<UART3_GPIOx, UART3_TX_GPIO_PINx, UART3>();
@@ -786,6 +1313,10 @@ void TIMER1_IRQHandler() {
 
                 case dmx::RdmTxState::kMab:
                     [[likely]] {
+                        if (s_RdmTxBuffer[dmx::config::kUart3Port].discovery_response) {
+                            Dmx::Get()->SetPortDirection<dmx::config::kUart3Port, dmx::Direction::kOutput, false>();
+                        }
+
                         DMA_START_RDM_TX(dmx::config::kUart3Port, UART3, UART3_DMAx, UART3_TX_DMA_CHx);
                     }
                     break;
@@ -795,10 +1326,10 @@ void TIMER1_IRQHandler() {
                         s_RdmTxBuffer[dmx::config::kUart3Port].state = dmx::RdmTxState::kIdle;
                         sv_port_state[dmx::config::kUart3Port] = dmx::PortState::kIdle;
                         Dmx::Get()->SetPortDirection<dmx::config::kUart3Port, dmx::Direction::kInput, true>();
+                        RdmReceiveTimeOutArm<dmx::config::kUart3Port>();
 
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
-                        const auto kSent = sv_total_statistics[dmx::config::kUart3Port].rdm.sent.classes + 1;
-                        sv_total_statistics[dmx::config::kUart3Port].rdm.sent.classes = kSent;
+                        RdmSentCount<dmx::config::kUart3Port>();
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
                     }
                     break;
@@ -822,13 +1353,20 @@ void TIMER4_IRQHandler() {
 // UART 4
 #if defined(DMX_USE_UART4)
     if ((TIMER_INTF(TIMER4) & TIMER_INT_FLAG_CH0) == TIMER_INT_FLAG_CH0) [[likely]] {
+        RdmReceiveTimeOutCheck<dmx::config::kUart4Port>();
+
         if (s_DmxTxBuffer[dmx::config::kUart4Port].state != dmx::TxRxState::kIdle) [[likely]] {
             switch (s_DmxTxBuffer[dmx::config::kUart4Port].state) {
                 case dmx::TxRxState::kDmxInter:
                     [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUart4Port, UART4>()) [[unlikely]] {
+                            break;
+                        }
+
                         Gd32GpioModeOutput<UART4_TX_GPIOx, UART4_TX_GPIO_PINx>();
                         GPIO_BC(UART4_TX_GPIOx) = UART4_TX_GPIO_PINx;
                         s_DmxTxBuffer[dmx::config::kUart4Port].state = dmx::TxRxState::kDmxBreak;
+                        TimingBreakStart<dmx::config::kUart4Port>();
                         TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
                     }
                     break;
@@ -837,12 +1375,14 @@ void TIMER4_IRQHandler() {
                     [[likely]] {
                         Gd32GpioModeAf<UART4_TX_GPIOx, UART4_TX_GPIO_PINx, UART4>();
                         s_DmxTxBuffer[dmx::config::kUart4Port].state = dmx::TxRxState::kDmxMab;
+                        TimingMabStart<dmx::config::kUart4Port>();
                         TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.mab_time;
                     }
                     break;
 
                 case dmx::TxRxState::kDmxMab:
                     [[likely]] {
+                        TimingFirstSlot<dmx::config::kUart4Port>();
                         DMA_RESTART_DMX_TX(dmx::config::kUart4Port, UART4, UART4_DMAx, UART4_TX_DMA_CHx);
                     }
                     break;
@@ -853,6 +1393,19 @@ void TIMER4_IRQHandler() {
             }
         } else if (s_RdmTxBuffer[dmx::config::kUart4Port].state != dmx::RdmTxState::kIdle) {
             switch (s_RdmTxBuffer[dmx::config::kUart4Port].state) {
+                case dmx::RdmTxState::kInter:
+                    [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUart4Port, UART4>()) [[unlikely]] {
+                            break;
+                        }
+
+                        Gd32GpioModeOutput<UART4_TX_GPIOx, UART4_TX_GPIO_PINx>();
+                        GPIO_BC(UART4_TX_GPIOx) = UART4_TX_GPIO_PINx;
+                        s_RdmTxBuffer[dmx::config::kUart4Port].state = dmx::RdmTxState::kBreak;
+                        TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + rdm::transmit::kBreakTimeTypical;
+                    }
+                    break;
+
                 case dmx::RdmTxState::kBreak:
                     [[likely]] {
                         Gd32GpioModeAf<UART4_TX_GPIOx, UART4_TX_GPIO_PINx, UART4>();
@@ -863,6 +1416,10 @@ void TIMER4_IRQHandler() {
 
                 case dmx::RdmTxState::kMab:
                     [[likely]] {
+                        if (s_RdmTxBuffer[dmx::config::kUart4Port].discovery_response) {
+                            Dmx::Get()->SetPortDirection<dmx::config::kUart4Port, dmx::Direction::kOutput, false>();
+                        }
+
                         DMA_START_RDM_TX(dmx::config::kUart4Port, UART4, UART4_DMAx, UART4_TX_DMA_CHx);
                     }
                     break;
@@ -872,10 +1429,10 @@ void TIMER4_IRQHandler() {
                         s_RdmTxBuffer[dmx::config::kUart4Port].state = dmx::RdmTxState::kIdle;
                         sv_port_state[dmx::config::kUart4Port] = dmx::PortState::kIdle;
                         Dmx::Get()->SetPortDirection<dmx::config::kUart4Port, dmx::Direction::kInput, true>();
+                        RdmReceiveTimeOutArm<dmx::config::kUart4Port>();
 
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
-                        const auto kSent = sv_total_statistics[dmx::config::kUart4Port].rdm.sent.classes + 1;
-                        sv_total_statistics[dmx::config::kUart4Port].rdm.sent.classes = kSent;
+                        RdmSentCount<dmx::config::kUart4Port>();
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
                     }
                     break;
@@ -894,13 +1451,20 @@ void TIMER4_IRQHandler() {
 // USART 5
 #if defined(DMX_USE_USART5)
     if ((TIMER_INTF(TIMER4) & TIMER_INT_FLAG_CH1) == TIMER_INT_FLAG_CH1) {
+        RdmReceiveTimeOutCheck<dmx::config::kUsart5Port>();
+
         if (s_DmxTxBuffer[dmx::config::kUsart5Port].state != dmx::TxRxState::kIdle) [[likely]] {
             switch (s_DmxTxBuffer[dmx::config::kUsart5Port].state) {
                 case dmx::TxRxState::kDmxInter:
                     [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUsart5Port, USART5>()) [[unlikely]] {
+                            break;
+                        }
+
                         Gd32GpioModeOutput<USART5_GPIOx, USART5_TX_GPIO_PINx>();
                         GPIO_BC(USART5_GPIOx) = USART5_TX_GPIO_PINx;
                         s_DmxTxBuffer[dmx::config::kUsart5Port].state = dmx::TxRxState::kDmxBreak;
+                        TimingBreakStart<dmx::config::kUsart5Port>();
                         TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
                     }
                     break;
@@ -909,12 +1473,14 @@ void TIMER4_IRQHandler() {
                     [[likely]] {
                         Gd32GpioModeAf<USART5_GPIOx, USART5_TX_GPIO_PINx, USART5>();
                         s_DmxTxBuffer[dmx::config::kUsart5Port].state = dmx::TxRxState::kDmxMab;
+                        TimingMabStart<dmx::config::kUsart5Port>();
                         TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.mab_time;
                     }
                     break;
 
                 case dmx::TxRxState::kDmxMab:
                     [[likely]] {
+                        TimingFirstSlot<dmx::config::kUsart5Port>();
                         DMA_RESTART_DMX_TX(dmx::config::kUsart5Port, USART5, USART5_DMAx, USART5_TX_DMA_CHx);
                     }
                     break;
@@ -925,6 +1491,19 @@ void TIMER4_IRQHandler() {
             }
         } else if (s_RdmTxBuffer[dmx::config::kUsart5Port].state != dmx::RdmTxState::kIdle) {
             switch (s_RdmTxBuffer[dmx::config::kUsart5Port].state) {
+                case dmx::RdmTxState::kInter:
+                    [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUsart5Port, USART5>()) [[unlikely]] {
+                            break;
+                        }
+
+                        Gd32GpioModeOutput<USART5_GPIOx, USART5_TX_GPIO_PINx>();
+                        GPIO_BC(USART5_GPIOx) = USART5_TX_GPIO_PINx;
+                        s_RdmTxBuffer[dmx::config::kUsart5Port].state = dmx::RdmTxState::kBreak;
+                        TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + rdm::transmit::kBreakTimeTypical;
+                    }
+                    break;
+
                 case dmx::RdmTxState::kBreak:
                     [[likely]] {
                         Gd32GpioModeAf<USART5_GPIOx, USART5_TX_GPIO_PINx, USART5>();
@@ -935,6 +1514,10 @@ void TIMER4_IRQHandler() {
 
                 case dmx::RdmTxState::kMab:
                     [[likely]] {
+                        if (s_RdmTxBuffer[dmx::config::kUsart5Port].discovery_response) {
+                            Dmx::Get()->SetPortDirection<dmx::config::kUsart5Port, dmx::Direction::kOutput, false>();
+                        }
+
                         DMA_START_RDM_TX(dmx::config::kUsart5Port, USART5, USART5_DMAx, USART5_TX_DMA_CHx);
                     }
                     break;
@@ -944,9 +1527,9 @@ void TIMER4_IRQHandler() {
                         s_RdmTxBuffer[dmx::config::kUsart5Port].state = dmx::RdmTxState::kIdle;
                         sv_port_state[dmx::config::kUsart5Port] = dmx::PortState::kIdle;
                         Dmx::Get()->SetPortDirection<dmx::config::kUsart5Port, dmx::Direction::kInput, true>();
+                        RdmReceiveTimeOutArm<dmx::config::kUsart5Port>();
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
-                        const auto kSent = sv_total_statistics[dmx::config::kUsart5Port].rdm.sent.classes + 1;
-                        sv_total_statistics[dmx::config::kUsart5Port].rdm.sent.classes = kSent;
+                        RdmSentCount<dmx::config::kUsart5Port>();
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
                     }
                     break;
@@ -965,20 +1548,29 @@ void TIMER4_IRQHandler() {
 // UART 6
 #if defined(DMX_USE_UART6)
     if ((TIMER_INTF(TIMER4) & TIMER_INT_FLAG_CH2) == TIMER_INT_FLAG_CH2) {
+        RdmReceiveTimeOutCheck<dmx::config::kUart6Port>();
+
         if (s_DmxTxBuffer[dmx::config::kUart6Port].state != dmx::TxRxState::kIdle) [[likely]] {
             switch (s_DmxTxBuffer[dmx::config::kUart6Port].state) {
                 case dmx::TxRxState::kDmxInter:
+                    if (!IsDmxOutputBreakReady<dmx::config::kUart6Port, UART6>()) [[unlikely]] {
+                        break;
+                    }
+
                     Gd32GpioModeOutput<UART6_GPIOx, UART6_TX_GPIO_PINx>();
                     GPIO_BC(UART6_GPIOx) = UART6_TX_GPIO_PINx;
                     s_DmxTxBuffer[dmx::config::kUart6Port].state = dmx::TxRxState::kDmxBreak;
+                    TimingBreakStart<dmx::config::kUart6Port>();
                     TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
                     break;
                 case dmx::TxRxState::kDmxBreak:
                     Gd32GpioModeAf<UART6_GPIOx, UART6_TX_GPIO_PINx, UART6>();
                     s_DmxTxBuffer[dmx::config::kUart6Port].state = dmx::TxRxState::kDmxMab;
+                    TimingMabStart<dmx::config::kUart6Port>();
                     TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.mab_time;
                     break;
                 case dmx::TxRxState::kDmxMab: {
+                    TimingFirstSlot<dmx::config::kUart6Port>();
                     DMA_RESTART_DMX_TX(dmx::config::kUart6Port, UART6, UART6_DMAx, UART6_TX_DMA_CHx);
                 } break;
                 default:
@@ -986,6 +1578,19 @@ void TIMER4_IRQHandler() {
             }
         } else if (s_RdmTxBuffer[dmx::config::kUart6Port].state != dmx::RdmTxState::kIdle) {
             switch (s_RdmTxBuffer[dmx::config::kUart6Port].state) {
+                case dmx::RdmTxState::kInter:
+                    [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUart6Port, UART6>()) [[unlikely]] {
+                            break;
+                        }
+
+                        Gd32GpioModeOutput<UART6_GPIOx, UART6_TX_GPIO_PINx>();
+                        GPIO_BC(UART6_GPIOx) = UART6_TX_GPIO_PINx;
+                        s_RdmTxBuffer[dmx::config::kUart6Port].state = dmx::RdmTxState::kBreak;
+                        TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + rdm::transmit::kBreakTimeTypical;
+                    }
+                    break;
+
                 case dmx::RdmTxState::kBreak:
                     [[likely]] {
                         Gd32GpioModeAf<UART4_TX_GPIOx, UART4_TX_GPIO_PINx, UART4>();
@@ -996,6 +1601,10 @@ void TIMER4_IRQHandler() {
 
                 case dmx::RdmTxState::kMab:
                     [[likely]] {
+                        if (s_RdmTxBuffer[dmx::config::kUart6Port].discovery_response) {
+                            Dmx::Get()->SetPortDirection<dmx::config::kUart6Port, dmx::Direction::kOutput, false>();
+                        }
+
                         DMA_START_RDM_TX(dmx::config::kUart6Port, UART6, UART6_DMAx, UART6_TX_DMA_CHx);
                     }
                     break;
@@ -1005,9 +1614,9 @@ void TIMER4_IRQHandler() {
                         s_RdmTxBuffer[dmx::config::kUart6Port].state = dmx::RdmTxState::kIdle;
                         sv_port_state[dmx::config::kUart6Port] = dmx::PortState::kIdle;
                         Dmx::Get()->SetPortDirection<dmx::config::kUart6Port, dmx::Direction::kInput, true>();
+                        RdmReceiveTimeOutArm<dmx::config::kUart6Port>();
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
-                        const auto kSent = sv_total_statistics[dmx::config::kUart6Port].rdm.sent.classes + 1;
-                        sv_total_statistics[dmx::config::kUart6Port].rdm.sent.classes = kSent;
+                        RdmSentCount<dmx::config::kUart6Port>();
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
                     }
                     break;
@@ -1026,20 +1635,29 @@ void TIMER4_IRQHandler() {
 // UART 7
 #if defined(DMX_USE_UART7)
     if ((TIMER_INTF(TIMER4) & TIMER_INT_FLAG_CH3) == TIMER_INT_FLAG_CH3) {
+        RdmReceiveTimeOutCheck<dmx::config::kUart7Port>();
+
         if (s_DmxTxBuffer[dmx::config::kUart7Port].state != dmx::TxRxState::kIdle) [[likely]] {
             switch (s_DmxTxBuffer[dmx::config::kUart7Port].state) {
                 case dmx::TxRxState::kDmxInter:
+                    if (!IsDmxOutputBreakReady<dmx::config::kUart7Port, UART7>()) [[unlikely]] {
+                        break;
+                    }
+
                     Gd32GpioModeOutput<UART7_GPIOx, UART7_TX_GPIO_PINx>();
                     GPIO_BC(UART7_GPIOx) = UART7_TX_GPIO_PINx;
                     s_DmxTxBuffer[dmx::config::kUart7Port].state = dmx::TxRxState::kDmxBreak;
+                    TimingBreakStart<dmx::config::kUart7Port>();
                     TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
                     break;
                 case dmx::TxRxState::kDmxBreak:
                     Gd32GpioModeAf<UART7_GPIOx, UART7_TX_GPIO_PINx, UART7>();
                     s_DmxTxBuffer[dmx::config::kUart7Port].state = dmx::TxRxState::kDmxMab;
+                    TimingMabStart<dmx::config::kUart7Port>();
                     TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.mab_time;
                     break;
                 case dmx::TxRxState::kDmxMab: {
+                    TimingFirstSlot<dmx::config::kUart7Port>();
                     DMA_RESTART_DMX_TX(dmx::config::kUart7Port, UART7, UART7_DMAx, UART7_TX_DMA_CHx);
                 } break;
                 default:
@@ -1047,6 +1665,19 @@ void TIMER4_IRQHandler() {
             }
         } else if (s_RdmTxBuffer[dmx::config::kUart7Port].state != dmx::RdmTxState::kIdle) {
             switch (s_RdmTxBuffer[dmx::config::kUart7Port].state) {
+                case dmx::RdmTxState::kInter:
+                    [[likely]] {
+                        if (!IsDmxOutputBreakReady<dmx::config::kUart7Port, UART7>()) [[unlikely]] {
+                            break;
+                        }
+
+                        Gd32GpioModeOutput<UART7_GPIOx, UART7_TX_GPIO_PINx>();
+                        GPIO_BC(UART7_GPIOx) = UART7_TX_GPIO_PINx;
+                        s_RdmTxBuffer[dmx::config::kUart7Port].state = dmx::RdmTxState::kBreak;
+                        TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + rdm::transmit::kBreakTimeTypical;
+                    }
+                    break;
+
                 case dmx::RdmTxState::kBreak:
                     [[likely]] {
                         Gd32GpioModeAf<UART7_GPIOx, UART7_TX_GPIO_PINx, UART7>();
@@ -1057,6 +1688,10 @@ void TIMER4_IRQHandler() {
 
                 case dmx::RdmTxState::kMab:
                     [[likely]] {
+                        if (s_RdmTxBuffer[dmx::config::kUart7Port].discovery_response) {
+                            Dmx::Get()->SetPortDirection<dmx::config::kUart7Port, dmx::Direction::kOutput, false>();
+                        }
+
                         DMA_START_RDM_TX(dmx::config::kUart7Port, UART7, UART7_DMAx, UART7_TX_DMA_CHx);
                     }
                     break;
@@ -1066,9 +1701,9 @@ void TIMER4_IRQHandler() {
                         s_RdmTxBuffer[dmx::config::kUart7Port].state = dmx::RdmTxState::kIdle;
                         sv_port_state[dmx::config::kUart7Port] = dmx::PortState::kIdle;
                         Dmx::Get()->SetPortDirection<dmx::config::kUart7Port, dmx::Direction::kInput, true>();
+                        RdmReceiveTimeOutArm<dmx::config::kUart7Port>();
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
-                        const auto kSent = sv_total_statistics[dmx::config::kUart7Port].rdm.sent.classes + 1;
-                        sv_total_statistics[dmx::config::kUart7Port].rdm.sent.classes = kSent;
+                        RdmSentCount<dmx::config::kUart7Port>();
 #endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
                     }
                     break;
@@ -1517,10 +2152,9 @@ void Dmx::SetPortDirection() {
 
         if constexpr (port_direction == dmx::Direction::kOutput) {
             GPIO_BOP(kDirGpio[port_index].port) = kDirGpio[port_index].pin;
-        } else if constexpr (port_direction == dmx::Direction::kInput) {
-            GPIO_BC(kDirGpio[port_index].port) = kDirGpio[port_index].pin;
         } else {
-            static_assert(false);
+            static_assert(port_direction == dmx::Direction::kInput);
+            GPIO_BC(kDirGpio[port_index].port) = kDirGpio[port_index].pin;
         }
     } else if constexpr (!enable_data) {
         DataDisable(port_index);
@@ -1554,7 +2188,12 @@ void Dmx::DataEnable(uint32_t port_index) {
 
         Gd32UsartInterruptFlagClear<USART_INT_FLAG_RBNE>(kUart);
         Gd32UsartInterruptFlagClear<USART_INT_FLAG_IDLE>(kUart);
+#if defined(CONFIG_DMX_RX_DMA)
+        RxDmaStart(kUart, port_index);
+        Gd32UsartInterruptEnable<USART_INT_ERR>(kUart);
+#else
         Gd32UsartInterruptEnable<USART_INT_RBNE>(kUart);
+#endif
         Gd32UsartInterruptEnable<USART_INT_FLAG_IDLE>(kUart);
 
         sv_port_state[port_index] = dmx::PortState::kRx;
@@ -1587,11 +2226,17 @@ void Dmx::DataDisable(uint32_t port_index) {
             }
         } while (s_DmxTxBuffer[port_index].state != dmx::TxRxState::kIdle);
 
+        TimingRestart(port_index);
         return;
     }
 
     if (port_direction_[port_index] == dmx::Direction::kInput) {
+#if defined(CONFIG_DMX_RX_DMA)
+        Gd32UsartInterruptDisable<USART_INT_ERR>(kUart);
+        RxDmaStop(kUart);
+#else
         Gd32UsartInterruptDisable<USART_INT_RBNE>(kUart);
+#endif
         Gd32UsartInterruptDisable<USART_INT_FLAG_IDLE>(kUart);
         sv_rx_buffer[port_index].state = dmx::TxRxState::kIdle;
         return;
@@ -1613,6 +2258,10 @@ volatile dmx::TotalStatistics& Dmx::GetTotalStatistics(uint32_t port_index) {
     sv_total_statistics[port_index].dmx.received = sv_rx_dmx_packets[port_index].count;
     return sv_total_statistics[port_index];
 }
+
+const dmx::TimingStatistics& Dmx::GetTimingStatistics(uint32_t port_index) const {
+    return s_timing_statistics[port_index];
+}
 #endif
 
 void Dmx::Blackout() {
@@ -1654,11 +2303,10 @@ void Dmx::FullOn() {
 }
 
 // DMX Send
-template <uint32_t portIndex, bool hasStartCode, dmx::SendStyle dmxSendStyle> 
-void Dmx::SetSendDataInternal(const uint8_t* data, uint32_t length) {
-    DMX_CHECK_PORT_INDEX_VOID(portIndex);
+static uint8_t* TransmitBufferAcquire(dmx::DmxTxData& tx_buffer) {
+    tx_buffer.dmx.acquired = true;
+    __DMB();
 
-    auto& tx_buffer = s_DmxTxBuffer[portIndex];
     const auto kHasDataPending = tx_buffer.dmx.read_index != tx_buffer.dmx.write_index;
 
     if (!kHasDataPending) {
@@ -1666,15 +2314,32 @@ void Dmx::SetSendDataInternal(const uint8_t* data, uint32_t length) {
         tx_buffer.dmx.write_index ^= 1;
     }
 
-    const auto kWriteIndex = tx_buffer.dmx.write_index;
-
-    auto* dst_data = tx_buffer.dmx.data[kWriteIndex].data;
+    return tx_buffer.dmx.data[tx_buffer.dmx.write_index].data;
+}
 
-    const auto kCappedLength = (length < transmit_slots_) ? length : transmit_slots_;
-    tx_buffer.dmx.data[kWriteIndex].length = kCappedLength + 1;
+void Dmx::TransmitBufferCommit(uint32_t port_index, uint32_t length) {
+    auto& tx_buffer = s_DmxTxBuffer[port_index];
 
+    tx_buffer.dmx.data[tx_buffer.dmx.write_index].length = length + 1;
     tx_buffer.dmx.data_pending = true;
 
+    __DMB();
+    tx_buffer.dmx.acquired = false;
+
+    if (length != transmit_length_[port_index]) {
+        transmit_length_[port_index] = length;
+        SetTransmitPeriodTime(transmit_period_requested_);
+    }
+}
+
+template <uint32_t portIndex, bool hasStartCode, dmx::SendStyle dmxSendStyle> 
+void Dmx::SetSendDataInternal(const uint8_t* data, uint32_t length) {
+    DMX_CHECK_PORT_INDEX_VOID(portIndex);
+
+    auto* dst_data = TransmitBufferAcquire(s_DmxTxBuffer[portIndex]);
+
+    const auto kCappedLength = (length < transmit_slots_) ? length : transmit_slots_;
+
     if constexpr (hasStartCode) {
         memcpy(dst_data, data, kCappedLength);
     } else {
@@ -1682,16 +2347,33 @@ void Dmx::SetSendDataInternal(const uint8_t* data, uint32_t length) {
         memcpy(&dst_data[1], data, kCappedLength);
     }
 
-    if (kCappedLength != transmit_length_[portIndex]) {
-        transmit_length_[portIndex] = kCappedLength;
-        SetTransmitPeriodTime(transmit_period_requested_);
-    }
+    TransmitBufferCommit(portIndex, kCappedLength);
 
     if constexpr (dmxSendStyle == dmx::SendStyle::kDirect) {
         StartSendStyleDirect(portIndex);
     }
 }
 
+uint8_t* Dmx::AcquireTransmitBuffer(uint32_t port_index) {
+    DMX_CHECK_PORT_INDEX_PTR(port_index);
+
+    auto* data = TransmitBufferAcquire(s_DmxTxBuffer[port_index]);
+    data[0] = dmx::kStartCode;
+
+    return data;
+}
+
+template <dmx::SendStyle dmxSendStyle> 
+void Dmx::CommitTransmitBuffer(uint32_t port_index, uint32_t length) {
+    DMX_CHECK_PORT_INDEX_VOID(port_index);
+
+    TransmitBufferCommit(port_index, (length < transmit_slots_) ? length : transmit_slots_);
+
+    if constexpr (dmxSendStyle == dmx::SendStyle::kDirect) {
+        StartSendStyleDirect(port_index);
+    }
+}
+
 void Dmx::StartSendStyleDirect(uint32_t port_index) {
     DMX_CHECK_PORT_INDEX_VOID(port_index);
 	
@@ -1704,8 +2386,14 @@ template <uint32_t port_index, uint32_t nUart>
 static void StartDmxOutputBreak() {
     // USART_FLAG_TC is set after power on.
     // The flag is cleared by DMA interrupt when maximum slots - 1 are transmitted.
-    // TODO(a): Do we need a timeout just to be safe?
-    while (SET != usart_flag_get(nUart, USART_FLAG_TC));
+    // When the last slots are still being shifted out, the TIMER compare interrupt starts the break.
+    s_DmxTxBuffer[port_index].transmit_complete_retries = 0;
+
+    if (!Gd32UsartFlagGet<USART_FLAG_TC>(nUart)) {
+        TimerCompareSet(nUart, dmx::kTransmitCompletePollTime);
+        s_DmxTxBuffer[port_index].state = dmx::TxRxState::kDmxInter;
+        return;
+    }
 
     switch (nUart) {
 // TIMER 1
@@ -1715,6 +2403,7 @@ static void StartDmxOutputBreak() {
             GPIO_BC(USART0_GPIOx) = USART0_TX_GPIO_PINx;
             TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
             s_DmxTxBuffer[dmx::config::kUsart0Port].state = dmx::TxRxState::kDmxBreak;
+            TimingBreakStart<dmx::config::kUsart0Port>();
             return;
             break;
 #endif // defined(DMX_USE_USART0)
@@ -1724,6 +2413,7 @@ static void StartDmxOutputBreak() {
             GPIO_BC(USART1_GPIOx) = USART1_TX_GPIO_PINx;
             TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
             s_DmxTxBuffer[dmx::config::kUsart1Port].state = dmx::TxRxState::kDmxBreak;
+            TimingBreakStart<dmx::config::kUsart1Port>();
             return;
             break;
 #endif // defined(DMX_USE_USART1)
@@ -1733,6 +2423,7 @@ static void StartDmxOutputBreak() {
             GPIO_BC(USART2_GPIOx) = USART2_TX_GPIO_PINx;
             TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
             s_DmxTxBuffer[dmx::config::kUsart2Port].state = dmx::TxRxState::kDmxBreak;
+            TimingBreakStart<dmx::config::kUsart2Port>();
             return;
             break;
 #endif // defined(DMX_USE_USART2)
@@ -1742,6 +2433,7 @@ static void StartDmxOutputBreak() {
             GPIO_BC(UART3_GPIOx) = UART3_TX_GPIO_PINx;
             TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_dmx_transmit.break_time;
             s_DmxTxBuffer[dmx::config::kUart3Port].state = dmx::TxRxState::kDmxBreak;
+            TimingBreakStart<dmx::config::kUart3Port>();
             return;
             break;
 #endif // defined(DMX_USE_UART3)
@@ -1752,6 +2444,7 @@ static void StartDmxOutputBreak() {
             GPIO_BC(UART4_TX_GPIOx) = UART4_TX_GPIO_PINx;
             TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
             s_DmxTxBuffer[dmx::config::kUart4Port].state = dmx::TxRxState::kDmxBreak;
+            TimingBreakStart<dmx::config::kUart4Port>();
             return;
             break;
 #endif // defined(DMX_USE_UART4)
@@ -1761,6 +2454,7 @@ static void StartDmxOutputBreak() {
             GPIO_BC(USART5_GPIOx) = USART5_TX_GPIO_PINx;
             TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
             s_DmxTxBuffer[dmx::config::kUsart5Port].state = dmx::TxRxState::kDmxBreak;
+            TimingBreakStart<dmx::config::kUsart5Port>();
             return;
             break;
 #endif
@@ -1770,6 +2464,7 @@ static void StartDmxOutputBreak() {
             GPIO_BC(UART6_GPIOx) = UART6_TX_GPIO_PINx;
             TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
             s_DmxTxBuffer[dmx::config::kUart6Port].state = dmx::TxRxState::kDmxBreak;
+            TimingBreakStart<dmx::config::kUart6Port>();
             return;
             break;
 #endif // defined(DMX_USE_UART6)
@@ -1779,6 +2474,7 @@ static void StartDmxOutputBreak() {
             GPIO_BC(UART7_GPIOx) = UART7_TX_GPIO_PINx;
             TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_dmx_transmit.break_time;
             s_DmxTxBuffer[dmx::config::kUart7Port].state = dmx::TxRxState::kDmxBreak;
+            TimingBreakStart<dmx::config::kUart7Port>();
             return;
             break;
 #endif // defined(DMX_USE_UART7)
@@ -1895,6 +2591,7 @@ void Dmx::RdmSendDataInternal(const uint8_t* data, uint32_t length) {
     dst_length = length;
 
     memcpy(dst_data, data, length);
+    tx_buffer.discovery_response = false;
 
     StartRdmOutput(portIndex);
 }
@@ -1904,97 +2601,9 @@ static void StartRdmOutput() {
     DEBUG_PRINTF("port_index=%u, uart=%u", port_index, uart);
     // USART_FLAG_TC is set after power on.
     // The flag is cleared by DMA interrupt when maximum slots - 1 are transmitted.
-    // TODO(a): Do we need a timeout just to be safe?
-    while (SET != usart_flag_get(uart, USART_FLAG_TC));
-
-    switch (uart) {
-        // TIMER 1
-#if defined(DMX_USE_USART0)
-        case USART0: {
-            Gd32GpioModeOutput<USART0_GPIOx, USART0_TX_GPIO_PINx>();
-            GPIO_BC(USART0_GPIOx) = USART0_TX_GPIO_PINx;
-            TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + rdm::transmit::kBreakTimeTypical;
-            s_RdmTxBuffer[dmx::config::kUsart0Port].state = dmx::RdmTxState::kBreak;
-            return;
-        } break;
-#endif // defined(DMX_USE_USART0)
-
-#if defined(DMX_USE_USART1)
-        case USART1: {
-            Gd32GpioModeOutput<USART1_GPIOx, USART1_TX_GPIO_PINx>();
-            GPIO_BC(USART1_GPIOx) = USART1_TX_GPIO_PINx;
-            TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + rdm::transmit::kBreakTimeTypical;
-            s_RdmTxBuffer[dmx::config::kUsart1Port].state = dmx::RdmTxState::kBreak;
-            return;
-        } break;
-#endif // defined(DMX_USE_USART1)
-
-#if defined(DMX_USE_USART2)
-        case USART2: {
-            Gd32GpioModeOutput<USART2_GPIOx, USART2_TX_GPIO_PINx>();
-            GPIO_BC(USART2_GPIOx) = USART2_TX_GPIO_PINx;
-            TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + rdm::transmit::kBreakTimeTypical;
-            s_RdmTxBuffer[dmx::config::kUsart2Port].state = dmx::RdmTxState::kBreak;
-            return;
-        } break;
-#endif // defined(DMX_USE_USART2)
-
-#if defined(DMX_USE_UART3)
-        case UART3: {
-            Gd32GpioModeOutput<UART3_GPIOx, UART3_TX_GPIO_PINx>();
-            GPIO_BC(UART3_GPIOx) = UART3_TX_GPIO_PINx;
-            TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + rdm::transmit::kBreakTimeTypical;
-            s_RdmTxBuffer[dmx::config::kUart3Port].state = dmx::RdmTxState::kBreak;
-            return;
-        } break;
-#endif // defined(DMX_USE_UART3)
-       // TIMER 4
-#if defined(DMX_USE_UART4)
-        case UART4: {
-            Gd32GpioModeOutput<UART4_TX_GPIOx, UART4_TX_GPIO_PINx>();
-            GPIO_BC(UART4_TX_GPIOx) = UART4_TX_GPIO_PINx;
-            TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + rdm::transmit::kBreakTimeTypical;
-            s_RdmTxBuffer[dmx::config::kUart4Port].state = dmx::RdmTxState::kBreak;
-            return;
-        } break;
-#endif //  defined(DMX_USE_UART4)
-
-#if defined(DMX_USE_USART5)
-        case USART5: {
-            Gd32GpioModeOutput<USART5_GPIOx, USART5_TX_GPIO_PINx>();
-            GPIO_BC(USART5_GPIOx) = USART5_TX_GPIO_PINx;
-            TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + rdm::transmit::kBreakTimeTypical;
-            s_RdmTxBuffer[dmx::config::kUsart5Port].state = dmx::RdmTxState::kBreak;
-            return;
-        } break;
-#endif // defined(DMX_USE_USART5)
-
-#if defined(DMX_USE_UART6)
-        case UART6: {
-            Gd32GpioModeOutput<UART6_GPIOx, UART6_TX_GPIO_PINx>();
-            GPIO_BC(UART6_GPIOx) = UART6_TX_GPIO_PINx;
-            TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + rdm::transmit::kBreakTimeTypical;
-            s_RdmTxBuffer[dmx::config::kUart6Port].state = dmx::RdmTxState::kBreak;
-            return;
-        } break;
-#endif // defined(DMX_USE_UART6)
-
-#if defined(DMX_USE_UART7)
-        case UART7: {
-            Gd32GpioModeOutput<UART7_GPIOx, UART7_TX_GPIO_PINx>();
-            GPIO_BC(UART7_GPIOx) = UART7_TX_GPIO_PINx;
-            TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + rdm::transmit::kBreakTimeTypical;
-            s_RdmTxBuffer[dmx::config::kUart7Port].state = dmx::RdmTxState::kBreak;
-            return;
-        } break;
-#endif // defined(DMX_USE_UART7)
-
-        default:
-            [[unlikely]] assert(false);
-            break;
-    }
-
-    assert(false);
+    // The TIMER compare interrupt starts the break when it is set again, see IsDmxOutputBreakReady().
+    s_RdmTxBuffer[port_index].state = dmx::RdmTxState::kInter;
+    TimerCompareSet(uart, dmx::kTimerCompareMin);
 }
 
 template <uint32_t portIndex> 
@@ -2071,56 +2680,80 @@ void Dmx::Sync() {
 }
 
 // DMX Receive
-const uint8_t* Dmx::GetDmxChanged([[maybe_unused]] uint32_t port_index) {
 #if !defined(CONFIG_DMX_TRANSMIT_ONLY)
-    const auto* __restrict__ p = GetDmxAvailable(port_index);
+// Only the bitmap of the completed buffer is taken, the bits of the frame being received are kept.
+static void TakeChangedSlots(uint32_t port_index, dmx::ChangedSlots& changed_slots) {
+#if defined(CONFIG_DMX_DOUBLE_INPUT_BUFFER)
+    auto& dirty = GetReadDmxDataBuffer(port_index).dirty;
+#else
+    auto& dirty = sv_rx_buffer[port_index].dmx.current.dirty;
+#endif
 
-    if (p == nullptr) {
-        return nullptr;
+    const auto kPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    for (uint32_t i = 0; i < dmx::ChangedSlots::kWords; i++) {
+        changed_slots.dirty[i] = dirty[i];
+        dirty[i] = 0;
     }
 
-#if defined(CONFIG_DMX_DOUBLE_INPUT_BUFFER)
-    auto& dmx_data_buffer = GetReadDmxDataBuffer(port_index);
-    const auto* __restrict__ src32 = reinterpret_cast<const volatile uint32_t*>(dmx_data_buffer.data);
-    auto* __restrict__ dst32 = reinterpret_cast<volatile uint32_t*>(sv_rx_buffer[port_index].dmx.previous.data);
+    __set_PRIMASK(kPrimask);
 
-    if (dmx_data_buffer.slots_in_packet != sv_rx_buffer[port_index].dmx.previous.slots_in_packet) {
-        sv_rx_buffer[port_index].dmx.previous.slots_in_packet = dmx_data_buffer.slots_in_packet;
+    changed_slots.first = 0;
+    changed_slots.last = 0;
 
-        for (size_t i = 0; i < dmx::buffer::kSize / 4; ++i) {
-            dst32[i] = src32[i];
+    for (uint32_t i = 0; i < dmx::ChangedSlots::kWords; i++) {
+        if (changed_slots.dirty[i] != 0) {
+            changed_slots.first = (i * 32) + static_cast<uint32_t>(__builtin_ctz(changed_slots.dirty[i])) + 1;
+            break;
         }
-
-        return p;
     }
-#else
-    const auto* __restrict__ src32 = reinterpret_cast<const volatile uint32_t*>(sv_rx_buffer[port_index].dmx.current.data);
-    auto* __restrict__ dst32 = reinterpret_cast<volatile uint32_t*>(sv_rx_buffer[port_index].dmx.previous.data);
 
-    if (sv_rx_buffer[port_index].dmx.current.slots_in_packet != sv_rx_buffer[port_index].dmx.previous.slots_in_packet) {
-        sv_rx_buffer[port_index].dmx.previous.slots_in_packet = sv_rx_buffer[port_index].dmx.current.slots_in_packet;
-
-        for (size_t i = 0; i < dmx::buffer::kSize / 4; ++i) {
-            dst32[i] = src32[i];
+    for (auto i = dmx::ChangedSlots::kWords; i-- > 0;) {
+        if (changed_slots.dirty[i] != 0) {
+            changed_slots.last = (i * 32) + 32 - static_cast<uint32_t>(__builtin_clz(changed_slots.dirty[i]));
+            break;
         }
+    }
+}
+#endif // !defined(CONFIG_DMX_TRANSMIT_ONLY)
 
-        return p;
+const uint8_t* Dmx::GetDmxChangedSlots([[maybe_unused]] uint32_t port_index, dmx::ChangedSlots& changed_slots) {
+#if !defined(CONFIG_DMX_TRANSMIT_ONLY)
+    const auto* p = GetDmxAvailable(port_index);
+
+    if (p == nullptr) {
+        return nullptr;
     }
+
+    TakeChangedSlots(port_index, changed_slots);
+
+    return p;
+#else
+    changed_slots.first = 0;
+    changed_slots.last = 0;
+    return nullptr;
 #endif
+}
+
+const uint8_t* Dmx::GetDmxChanged([[maybe_unused]] uint32_t port_index) {
+#if !defined(CONFIG_DMX_TRANSMIT_ONLY)
+    dmx::ChangedSlots changed_slots;
+
+    const auto* p = GetDmxChangedSlots(port_index, changed_slots);
 
-    bool is_changed = false;
+    if (p == nullptr) {
+        return nullptr;
+    }
 
-    for (size_t i = 0; i < dmx::buffer::kSize / 4; ++i) {
-        const auto kSrcValue = src32[i];
-        auto dst_value = dst32[i];
+    const auto kSlotsInPacket = reinterpret_cast<const struct Data*>(p)->statistics.slots_in_packet;
 
-        if (kSrcValue != dst_value) {
-            dst32[i] = kSrcValue;
-            is_changed = true;
-        }
+    if (kSlotsInPacket != sv_rx_buffer[port_index].dmx.previous_slots_in_packet) {
+        sv_rx_buffer[port_index].dmx.previous_slots_in_packet = kSlotsInPacket;
+        return p;
     }
 
-    return (is_changed ? p : nullptr);
+    return ((changed_slots.first != 0) ? p : nullptr);
 #else
     return nullptr;
 #endif
@@ -2184,36 +2817,23 @@ void Dmx::RdmTransmitDiscoveryRespondMessage(uint32_t port_index, const uint8_t*
     DMX_CHECK_PORT_INDEX_VOID(port_index);
     assert(data != nullptr);
     assert(length != 0);
+    assert(length <= sizeof(TRdmMessage));
 
-    // 3.2.2 Responder Packet spacing
-    timing::DelayUs(rdm::responder::kPacketSpacing, gsv_rdm_data_receive_end[port_index]);
-
-    SetPortDirection(port_index, dmx::Direction::kOutput, false);
-
-    const auto kUart = DmxPortToUart(port_index);
-
-    for (uint32_t i = 0; i < length; i++) {
-        do {
-            __DMB();
-        } while (!Gd32UsartFlagGet<USART_FLAG_TBE>(kUart));
-
-        USART_TDATA(kUart) = USART_TDATA_TDATA & data[i];
-    }
-
-    while (!Gd32UsartFlagGet<USART_FLAG_TC>(kUart)) {
-        static_cast<void>(GET_BITS(USART_RDATA(kUart), 0U, 8U));
-    }
+    auto& tx_buffer = s_RdmTxBuffer[port_index];
 
-    TIMER_CNT(TIMER5) = 0;
-    do {
-        __DMB();
-    } while (TIMER_CNT(TIMER5) < rdm::responder::kDataDirectionDelay);
+    memcpy(tx_buffer.rdm.data.data, data, length);
+    tx_buffer.rdm.data.length = length;
+    tx_buffer.discovery_response = true;
 
-    SetPortDirection(port_index, dmx::Direction::kInput, true);
+    // 3.2.2 Responder Packet spacing
+    // There is no break, the TIMER compare interrupt takes the line and starts the DMA when the spacing has elapsed.
+    // The line is not driven before, the controller can still be turning its own driver around.
+    // The DMA interrupt schedules the data direction turnaround.
+    const auto kElapsed = (DWT->CYCCNT - gsv_rdm_data_receive_end[port_index]) / dmx::kCyclesPerUs;
+    const auto kSpacing = ((kElapsed + dmx::kTimerCompareMin) < rdm::responder::kPacketSpacing) ? (rdm::responder::kPacketSpacing - kElapsed) : dmx::kTimerCompareMin;
 
-#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
-    sv_total_statistics[port_index].rdm.sent.discovery_response = sv_total_statistics[port_index].rdm.sent.discovery_response + 1;
-#endif
+    TimerCompareSet(DmxPortToUart(port_index), kSpacing);
+    tx_buffer.state = dmx::RdmTxState::kMab;
 }
 
 // RDM Receive
@@ -2231,19 +2851,11 @@ const uint8_t* Dmx::RdmReceive(uint32_t port_index) {
     if (p[0] == E120_SC_RDM) {
         const auto* rdm_command = reinterpret_cast<const struct TRdmMessage*>(p);
 
-        uint32_t i;
-        uint16_t checksum = 0;
-
-        for (i = 0; i < 24; i++) {
-            checksum = static_cast<uint16_t>(checksum + p[i]);
-        }
-
-        for (; i < rdm_command->message_length; i++) {
-            checksum = static_cast<uint16_t>(checksum + p[i]);
-        }
+        uint32_t i = rdm_command->message_length;
+        const auto kChecksum = rdm::Checksum(p, i);
 
-        if (p[i++] == static_cast<uint8_t>(checksum >> 8)) {
-            if (p[i] == static_cast<uint8_t>(checksum)) {
+        if (p[i++] == static_cast<uint8_t>(kChecksum >> 8)) {
+            if (p[i] == static_cast<uint8_t>(kChecksum)) {
 #if !defined(CONFIG_DMX_DISABLE_STATISTICS)
                 sv_total_statistics[port_index].rdm.received.good = sv_total_statistics[port_index].rdm.received.good + 1;
 #endif
@@ -2263,23 +2875,59 @@ const uint8_t* Dmx::RdmReceive(uint32_t port_index) {
     return p;
 }
 
-// RDM Receive with timeout
-const uint8_t* Dmx::RdmReceiveTimeOut(uint32_t port_index, uint16_t time_out) {
-    DMX_CHECK_PORT_INDEX_PTR(port_index);
+// RDM Receive with timeout, non-blocking
+void Dmx::RdmReceiveStart(uint32_t port_index, uint16_t time_out) {
+    DMX_CHECK_PORT_INDEX_VOID(port_index);
+
+    // Discard a response that was not collected
+    if ((sv_rx_buffer[port_index].rdm.index & 0x4000) == 0x4000) {
+        sv_rx_buffer[port_index].rdm.index = 0;
+    }
+
+    auto& receive = s_rdm_receive[port_index];
+    receive.time_out = time_out;
+    receive.status = dmx::RdmReceiveStatus::kPending;
+    __DMB();
 
-    uint8_t* p = nullptr;
-    TIMER_CNT(TIMER5) = 0;
+    // When the RDM request is still being sent, the timeout is armed at the data direction turnaround
+    if (s_RdmTxBuffer[port_index].state == dmx::RdmTxState::kIdle) {
+        TimerCompareSet(DmxPortToUart(port_index), time_out);
+    }
+}
+
+dmx::RdmReceiveStatus Dmx::RdmReceivePoll(uint32_t port_index, const uint8_t*& rdm_data) {
+    rdm_data = nullptr;
+    DMX_CHECK_PORT_INDEX_RET(port_index, dmx::RdmReceiveStatus::kIdle);
+
+    auto& receive = s_rdm_receive[port_index];
+    const auto kStatus = receive.status;
 
-    do {
-        if ((p = const_cast<uint8_t*>(RdmReceive(port_index))) != nullptr) {
-            return p;
+    if (kStatus == dmx::RdmReceiveStatus::kIdle) {
+        return dmx::RdmReceiveStatus::kIdle;
+    }
+
+    // A response that completed before the timeout was handled is not a timeout
+    rdm_data = RdmReceive(port_index);
+
+    if (rdm_data == nullptr) {
+        if (kStatus == dmx::RdmReceiveStatus::kPending) {
+            return dmx::RdmReceiveStatus::kPending;
         }
-    } while (TIMER_CNT(TIMER5) < time_out);
+    }
 
-    return nullptr;
+    receive.status = dmx::RdmReceiveStatus::kIdle;
+
+    if (rdm_receive_callback_ != nullptr) {
+        rdm_receive_callback_(port_index, rdm_data);
+    }
+
+    return (rdm_data != nullptr) ? dmx::RdmReceiveStatus::kReceived : dmx::RdmReceiveStatus::kTimeOut;
 }
 
 // Explicit template instantiations
+template void Dmx::CommitTransmitBuffer<dmx::SendStyle::kDirect>(uint32_t, uint32_t);
+template void Dmx::CommitTransmitBuffer<dmx::SendStyle::kSync>(uint32_t, uint32_t);
+
 template void Dmx::SetTransmitDataWithSC<dmx::SendStyle::kDirect>(const uint32_t, const uint8_t*, uint32_t);
 template void Dmx::SetTransmitDataWithSC<dmx::SendStyle::kSync>(const uint32_t, const uint8_t*, uint32_t);
 
@@ -2404,6 +3052,7 @@ void Dmx::SetTransmitPeriodTime(uint32_t period) {
     }
 
     s_dmx_transmit.inter_time = transmit_period_ - package_length_micro_seconds;
+    s_dmx_transmit.period = transmit_period_;
 
     DEBUG_PRINTF("period=%u, nLengthMax=%u, m_nDmxTransmitPeriod=%u, nPackageLengthMicroSeconds=%u -> s_dmx_transmit.inter_time=%u", period, length_max, transmit_period_, package_length_micro_seconds, s_dmx_transmit.inter_time);
 }
@@ -2426,6 +3075,7 @@ void Dmx::SetOutputStyle(uint32_t port_index, dmx::OutputStyle output_style) {
     DMX_CHECK_PORT_INDEX_VOID(port_index);
 
     s_DmxTxBuffer[port_index].output_style = output_style;
+    TimingRestart(port_index);
 
     if (output_style == dmx::OutputStyle::kConstant) {
         if (!has_continuos_output_) {
@@ -2760,6 +3410,32 @@ static void UsartDmaConfig() {
 #endif // DMX_USE_UART7
 }
 
+#if defined(CONFIG_DMX_RX_DMA)
+static void UsartRxDmaConfig(uint32_t usart_periph, IRQn_Type irq) {
+    const auto kDmaPeriph = DmxUartToRxDma(usart_periph);
+    const auto kDmaChannel = DmxUartToRxDmaChannel(usart_periph);
+
+    DMA_PARAMETER_STRUCT dma_init_struct;
+    dma_deinit(kDmaPeriph, kDmaChannel);
+    dma_init_struct.direction = DMA_PERIPHERAL_TO_MEMORY;
+    dma_init_struct.memory_addr = 0;
+    dma_init_struct.memory_inc = DMA_MEMORY_INCREASE_ENABLE;
+    dma_init_struct.memory_width = DMA_MEMORY_WIDTH_8BIT;
+    dma_init_struct.number = dmx::kRxRingSize;
+    dma_init_struct.periph_addr = reinterpret_cast<uint32_t>(&USART_RDATA(usart_periph));
+    dma_init_struct.periph_inc = DMA_PERIPH_INCREASE_DISABLE;
+    dma_init_struct.periph_width = DMA_PERIPHERAL_WIDTH_8BIT;
+    dma_init_struct.priority = DMA_PRIORITY_ULTRA_HIGH;
+    dma_init(kDmaPeriph, kDmaChannel, &dma_init_struct);
+    /* configure DMA mode */
+    dma_circulation_enable(kDmaPeriph, kDmaChannel);
+    dma_memory_to_memory_disable(kDmaPeriph, kDmaChannel);
+    // Same priority as the USART interrupt, so both are never preempting each other
+    NVIC_SetPriority(irq, 0);
+    NVIC_EnableIRQ(irq);
+}
+#endif // defined(CONFIG_DMX_RX_DMA)
+
 static void Timer1Config() {
     rcu_periph_clock_enable(RCU_TIMER1);
     timer_deinit(TIMER1);
@@ -2875,6 +3551,11 @@ Dmx::Dmx() {
         SetPortDirection(port_index, dmx::Direction::kInput, false);
         SetOutputStyle(port_index, dmx::OutputStyle::kDelta);
         ClearData(port_index);
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+        s_timing_statistics[port_index].break_time.Reset();
+        s_timing_statistics[port_index].mab_time.Reset();
+        s_timing_statistics[port_index].period.Reset();
+#endif
     }
 
     SetTransmitBreakTime(dmx::transmit::kBreakTimeTypical);
@@ -2883,6 +3564,21 @@ Dmx::Dmx() {
     SetTransmitPeriodTime(0);
 
     UsartDmaConfig(); // DMX Transmit
+#if defined(CONFIG_DMX_RX_DMA)
+    // DMX/RDM Receive
+#if defined(DMX_USE_USART0)
+    UsartRxDmaConfig(USART0, DMA0_Channel4_IRQn);
+#endif
+#if defined(DMX_USE_USART1)
+    UsartRxDmaConfig(USART1, DMA0_Channel5_IRQn);
+#endif
+#if defined(DMX_USE_USART2)
+    UsartRxDmaConfig(USART2, DMA0_Channel2_IRQn);
+#endif
+#if defined(DMX_USE_UART3)
+    UsartRxDmaConfig(UART3, DMA1_Channel2_IRQn);
+#endif
+#endif // defined(CONFIG_DMX_RX_DMA)
 #if defined(DMX_USE_USART0) || defined(DMX_USE_USART1) || defined(DMX_USE_USART2) || defined(DMX_USE_UART3)
     Timer1Config(); // DMX Transmit -> USART0, USART1, USART2, UART3
 #endif
@@ -110,6 +110,69 @@ inline constexpr uint32_t DmxPortToUart(uint32_t port) {
     return 0;
 }
 
+#if defined(CONFIG_DMX_RX_DMA)
+#if defined(GD32F4XX) || defined(GD32H7XX)
+#error CONFIG_DMX_RX_DMA is not supported for this MCU family
+#endif
+#if defined(DMX_USE_UART4) || defined(DMX_USE_USART5) || defined(DMX_USE_UART6) || defined(DMX_USE_UART7)
+#error CONFIG_DMX_RX_DMA is supported for USART0, USART1, USART2 and UART3 only
+#endif
+
+inline constexpr uint32_t DmxUartToRxDma(uint32_t uart) {
+    switch (uart) {
+#if defined(DMX_USE_USART0)
+        case USART0:
+            return USART0_DMAx;
+#endif
+#if defined(DMX_USE_USART1)
+        case USART1:
+            return USART1_DMAx;
+#endif
+#if defined(DMX_USE_USART2)
+        case USART2:
+            return USART2_DMAx;
+#endif
+#if defined(DMX_USE_UART3)
+        case UART3:
+            return UART3_DMAx;
+#endif
+        default:
+            [[unlikely]] assert(0);
+            break;
+    }
+
+    assert(0);
+    return 0;
+}
+
+inline constexpr dma_channel_enum DmxUartToRxDmaChannel(uint32_t uart) {
+    switch (uart) {
+#if defined(DMX_USE_USART0)
+        case USART0:
+            return USART0_RX_DMA_CHx;
+#endif
+#if defined(DMX_USE_USART1)
+        case USART1:
+            return USART1_RX_DMA_CHx;
+#endif
+#if defined(DMX_USE_USART2)
+        case USART2:
+            return USART2_RX_DMA_CHx;
+#endif
+#if defined(DMX_USE_UART3)
+        case UART3:
+            return UART3_RX_DMA_CHx;
+#endif
+        default:
+            [[unlikely]] assert(0);
+            break;
+    }
+
+    assert(0);
+    return DMA_CH0;
+}
+#endif // defined(CONFIG_DMX_RX_DMA)
+
 #if defined(GD32F4XX) || defined(GD32H7XX)
 inline constexpr uint32_t GetUsartAf(uint32_t usart_periph) {
     switch (usart_periph) {
@@ -10,35 +10,98 @@
 
 namespace json::status
 {
+/*
+ * All functions return the number of characters written, never more than out_buffer_size - 1.
+ * Once the output is truncated, the buffer is full and nothing more is appended.
+ */
+static uint32_t Clamp(int written, uint32_t out_buffer_size) {
+    if (written < 0) {
+        return 0;
+    }
+
+    if (static_cast<uint32_t>(written) >= out_buffer_size) {
+        return (out_buffer_size != 0) ? out_buffer_size - 1 : 0;
+    }
+
+    return static_cast<uint32_t>(written);
+}
+
+static uint32_t Append(char* out_buffer, uint32_t out_buffer_size, uint32_t length, char c) {
+    if ((length + 1) < out_buffer_size) {
+        out_buffer[length++] = c;
+        out_buffer[length] = '\0';
+    }
+
+    return length;
+}
+
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+static uint32_t Histogram(char* out_buffer, uint32_t out_buffer_size, const char* name, const ::dmx::TimingHistogram& histogram) {
+    auto length = Clamp(snprintf(out_buffer, out_buffer_size, 
+         "\"%s\":{\"min\":\"%u\",\"max\":\"%u\",\"mean\":\"%u\",\"count\":\"%u\",\"histogram\":[",
+         name, static_cast<unsigned int>(histogram.Min()), static_cast<unsigned int>(histogram.max), 
+         static_cast<unsigned int>(histogram.Mean()), static_cast<unsigned int>(histogram.count)), out_buffer_size);
+
+    for (uint32_t i = 0; i < ::dmx::TimingHistogram::kBuckets; i++) {
+        const auto kRemaining = out_buffer_size - length;
+        length += Clamp(snprintf(&out_buffer[length], kRemaining, (i == 0) ? "%u" : ",%u", static_cast<unsigned int>(histogram.bucket[i])), kRemaining);
+    }
+
+    const auto kRemaining = out_buffer_size - length;
+    length += Clamp(snprintf(&out_buffer[length], kRemaining, "]}"), kRemaining);
+
+    return length;
+}
+
+static uint32_t Timing(char* out_buffer, uint32_t out_buffer_size, uint32_t port_index) {
+    const auto& timing = Dmx::Get()->GetTimingStatistics(port_index);
+
+    auto length = Clamp(snprintf(out_buffer, out_buffer_size, ",\"timing\":{"), out_buffer_size);
+
+    length += Histogram(&out_buffer[length], out_buffer_size - length, "break", timing.break_time);
+    length = Append(out_buffer, out_buffer_size, length, ',');
+    length += Histogram(&out_buffer[length], out_buffer_size - length, "mab", timing.mab_time);
+    length = Append(out_buffer, out_buffer_size, length, ',');
+    length += Histogram(&out_buffer[length], out_buffer_size - length, "period", timing.period);
+
+    return Append(out_buffer, out_buffer_size, length, '}');
+}
+#endif // !defined(CONFIG_DMX_DISABLE_STATISTICS)
+
 uint32_t Dmx(char* out_buffer, uint32_t out_buffer_size, uint32_t port_index) {
     if (port_index < ::dmx::config::max::kPorts)
     {
         auto& statistics = Dmx::Get()->GetTotalStatistics(port_index);
-        auto length = static_cast<uint32_t>(snprintf(out_buffer, out_buffer_size,
+        auto length = Clamp(snprintf(out_buffer, out_buffer_size,
          "{\"port\":\"%c\","
-         "\"dmx\":{\"sent\":\"%u\",\"received\":\"%u\"},"
-         "\"rdm\":{\"sent\":{\"class\":\"%u\",\"discovery\":\"%u\"},\"received\":{\"good\":\"%u\",\"bad\":\"%u\",\"discovery\":\"%u\"}}}",
-         static_cast<char>('A' + port_index), static_cast<unsigned int>(statistics.dmx.sent), static_cast<unsigned int>(statistics.dmx.received),
+         "\"dmx\":{\"sent\":\"%u\",\"received\":\"%u\",\"timeout\":\"%u\"},"
+         "\"rdm\":{\"sent\":{\"class\":\"%u\",\"discovery\":\"%u\"},\"received\":{\"good\":\"%u\",\"bad\":\"%u\",\"discovery\":\"%u\"}}",
+         static_cast<char>('A' + port_index), static_cast<unsigned int>(statistics.dmx.sent), static_cast<unsigned int>(statistics.dmx.received), static_cast<unsigned int>(statistics.dmx.transmit_timeout),
          static_cast<unsigned int>(statistics.rdm.sent.classes), static_cast<unsigned int>(statistics.rdm.sent.discovery_response), static_cast<unsigned int>(statistics.rdm.received.good),
-         static_cast<unsigned int>(statistics.rdm.received.bad), static_cast<unsigned int>(statistics.rdm.received.discovery_response)));
+         static_cast<unsigned int>(statistics.rdm.received.bad), static_cast<unsigned int>(statistics.rdm.received.discovery_response)), out_buffer_size);
+
+#if !defined(CONFIG_DMX_DISABLE_STATISTICS)
+        length += Timing(&out_buffer[length], out_buffer_size - length, port_index);
+#endif
 
-        return length;
+        return Append(out_buffer, out_buffer_size, length, '}');
     }
 
     return 0;	
 }
 
 uint32_t Dmx(char* out_buffer, uint32_t out_buffer_size) {
-    out_buffer[0] = '[';
-    uint32_t length = 1;
+    auto length = Append(out_buffer, out_buffer_size, 0, '[');
 
     for (uint32_t port_index = 0; port_index < ::dmx::config::max::kPorts; port_index++)
     {
         length += Dmx(&out_buffer[length], out_buffer_size - length, port_index);
-		out_buffer[length++] = ',';
+        length = Append(out_buffer, out_buffer_size, length, ',');
     }
 
-    out_buffer[length - 1] = ']';
+    if ((length > 1) && (out_buffer[length - 1] == ',')) {
+        out_buffer[length - 1] = ']';
+    }
 
     return length;	
 }
@@ -48,6 +48,55 @@
 
 namespace dmxnode
 {
+namespace merge
+{
+/**
+ * Highest of the 4 bytes in a and b
+ */
+inline uint32_t Htp(uint32_t a, uint32_t b)
+{
+#if defined(GD32) && defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    // b + saturated(a - b)
+    return __UADD8(b, __UQSUB8(a, b));
+#else
+    // Bit 7 of each byte of kT is set when the low 7 bits of a are >= those of b, no borrow crosses a byte
+    const auto kT = (a | 0x80808080U) - (b & 0x7F7F7F7FU);
+    const auto kGe = ((a & ~b) | (~(a ^ b) & kT)) & 0x80808080U;
+    const auto kMask = (kGe - (kGe >> 7)) | kGe;
+    return (a & kMask) | (b & ~kMask);
+#endif
+}
+
+/**
+ * out[i] = max(a[i], b[i]) for i in [offset, offset + length), a word at a time.
+ * The buffers must have the same alignment.
+ */
+inline void Htp(uint8_t* out, const uint8_t* a, const uint8_t* b, uint32_t offset, uint32_t length)
+{
+    auto i = offset;
+    const auto kEnd = offset + length;
+
+    for (; (i < kEnd) && ((reinterpret_cast<uintptr_t>(&out[i]) & 3) != 0); i++)
+    {
+        out[i] = std::max(a[i], b[i]);
+    }
+
+    for (; (i + 4) <= kEnd; i += 4)
+    {
+        uint32_t word_a, word_b;
+        memcpy(&word_a, &a[i], 4);
+        memcpy(&word_b, &b[i], 4);
+        const auto kWord = Htp(word_a, word_b);
+        memcpy(&out[i], &kWord, 4);
+    }
+
+    for (; i < kEnd; i++)
+    {
+        out[i] = std::max(a[i], b[i]);
+    }
+}
+} // namespace merge
+
 class Data
 {
    public:
@@ -61,10 +110,23 @@ class Data
 
     static void MergeSourceA(uint32_t port_index, const uint8_t* data, uint32_t length, MergeMode merge_mode) { Get().IMergeSourceA(port_index, data, length, merge_mode); }
 
+    /**
+     * Only slots [offset, offset + count) of data have changed since the previous packet of this source.
+     */
+    static void MergeSourceA(uint32_t port_index, const uint8_t* data, uint32_t length, MergeMode merge_mode, uint32_t offset, uint32_t count)
+    {
+        Get().IMergeSource(port_index, Get().output_port_[port_index].source_a, data, length, merge_mode, offset, count);
+    }
+
     static void SetSourceB(uint32_t port_index, const uint8_t* data, uint32_t length) { Get().IMergeSourceB(port_index, data, length, MergeMode::kLtp); }
 
     static void MergeSourceB(uint32_t port_index, const uint8_t* data, uint32_t length, MergeMode merge_mode) { Get().IMergeSourceB(port_index, data, length, merge_mode); }
 
+    static void MergeSourceB(uint32_t port_index, const uint8_t* data, uint32_t length, MergeMode merge_mode, uint32_t offset, uint32_t count)
+    {
+        Get().IMergeSource(port_index, Get().output_port_[port_index].source_b, data, length, merge_mode, offset, count);
+    }
+
     static void Clear(uint32_t port_index) { Get().IClear(port_index); }
 
     static void ClearLength(uint32_t port_index) { Get().IClearLength(port_index); }
@@ -76,50 +138,38 @@ class Data
     static void Restore(uint32_t port_index, const uint8_t* data) { Get().IRestore(port_index, data); }
 
    private:
-    void IMergeSourceA(uint32_t port_index, const uint8_t* data, uint32_t length, MergeMode merge_mode)
+    struct Source;
+
+    void IMergeSource(uint32_t port_index, Source& source, const uint8_t* data, uint32_t length, MergeMode merge_mode, uint32_t offset, uint32_t count)
     {
         assert(port_index < kPorts);
         assert(data != nullptr);
+        assert(offset + count <= length);
+        assert(length <= dmxnode::kUniverseSize);
+
+        auto& output_port = output_port_[port_index];
 
-        memcpy(output_port_[port_index].source_a.data, data, length);
+        memcpy(&source.data[offset], &data[offset], count);
 
-        output_port_[port_index].length = length;
+        output_port.length = length;
 
         if (merge_mode == MergeMode::kHtp)
         {
-            for (uint32_t i = 0; i < length; i++)
-            {
-                const auto kData = std::max(output_port_[port_index].source_a.data[i], output_port_[port_index].source_b.data[i]);
-                output_port_[port_index].data[i] = kData;
-            }
-
+            merge::Htp(output_port.data, output_port.source_a.data, output_port.source_b.data, offset, count);
             return;
         }
 
-        memcpy(output_port_[port_index].data, data, length);
+        memcpy(&output_port.data[offset], &data[offset], count);
     }
 
-    void IMergeSourceB(uint32_t port_index, const uint8_t* data, uint32_t length, MergeMode merge_mode)
+    void IMergeSourceA(uint32_t port_index, const uint8_t* data, uint32_t length, MergeMode merge_mode)
     {
-        assert(port_index < kPorts);
-        assert(data != nullptr);
-
-        memcpy(output_port_[port_index].source_b.data, data, length);
-
-        output_port_[port_index].length = length;
-
-        if (merge_mode == MergeMode::kHtp)
-        {
-            for (uint32_t i = 0; i < length; i++)
-            {
-                const auto kData = std::max(output_port_[port_index].source_a.data[i], output_port_[port_index].source_b.data[i]);
-                output_port_[port_index].data[i] = kData;
-            }
-
-            return;
-        }
+        IMergeSource(port_index, output_port_[port_index].source_a, data, length, merge_mode, 0, length);
+    }
 
-        memcpy(output_port_[port_index].data, data, length);
+    void IMergeSourceB(uint32_t port_index, const uint8_t* data, uint32_t length, MergeMode merge_mode)
+    {
+        IMergeSource(port_index, output_port_[port_index].source_b, data, length, merge_mode, 0, length);
     }
 
     void IClear(uint32_t port_index)
@@ -52,9 +52,16 @@
 #define LED3_GPIOx				GPIOC
 #define LED3_RCU_GPIOx			RCU_GPIOC
 
-#define LED_BLINK_PIN			LED1_GPIO_PINx
-#define LED_BLINK_GPIO_PORT		LED1_GPIOx
-#define LED_BLINK_GPIO_CLK		LED1_RCU_GPIOx
+#if defined(OUTPUT_DMX_PIXEL_MULTI)
+// PC0 is pixel port 0, the status LED moves to PC8
+# define LED_BLINK_PIN			GPIO_PIN_8
+# define LED_BLINK_GPIO_PORT	GPIOC
+# define LED_BLINK_GPIO_CLK		RCU_GPIOC
+#else
+# define LED_BLINK_PIN			LED1_GPIO_PINx
+# define LED_BLINK_GPIO_PORT	LED1_GPIOx
+# define LED_BLINK_GPIO_CLK		LED1_RCU_GPIOx
+#endif
 
 /**
  * KEYs
@@ -123,6 +130,18 @@
 #define USART0_REMAP
 #define USART2_PARTIAL_REMAP
 
+/**
+ * Parallel pixel output, the ports are PC0..PC7
+ */
+
+#if defined(OUTPUT_DMX_PIXEL_MULTI)
+# if defined(CONFIG_DMXNODE_PIXEL_MAX_PORTS) && (CONFIG_DMXNODE_PIXEL_MAX_PORTS > 8)
+#  error PC10 and PC11 are used by USART2, the maximum is 8 pixel ports
+# endif
+# define PIXEL_MULTI_GPIOx		GPIOC
+# define PIXEL_MULTI_RCU_GPIOx	RCU_GPIOC
+#endif
+
 // Panel LEDs
 #ifdef __cplusplus
 #include <cstdint>
@@ -167,7 +186,11 @@ static constexpr uint32_t kPortATx = 0;
 #define GD32_BOARD_LED1			GD32_PORT_TO_GPIO(GD32_GPIO_PORTC, 0)
 #define GD32_BOARD_LED2			GD32_PORT_TO_GPIO(GD32_GPIO_PORTC, 2)
 #define GD32_BOARD_LED3			GD32_PORT_TO_GPIO(GD32_GPIO_PORTC, 3)
-#define GD32_BOARD_STATUS_LED	GD32_BOARD_LED1
+#if defined(OUTPUT_DMX_PIXEL_MULTI)
+# define GD32_BOARD_STATUS_LED	GD32_PORT_TO_GPIO(GD32_GPIO_PORTC, 8)
+#else
+# define GD32_BOARD_STATUS_LED	GD32_BOARD_LED1
+#endif
 
 /**
  * LCD
@@ -193,7 +216,9 @@ static constexpr uint32_t kPortATx = 0;
  * Pixel DMX
  */
 
-#define PIXELDMXSTARTSTOP_GPIO	GD32_BOARD_LED2
+#if !defined(OUTPUT_DMX_PIXEL_MULTI)	// PC2 is pixel port 2
+# define PIXELDMXSTARTSTOP_GPIO	GD32_BOARD_LED2
+#endif
 
 #include "gpio_header.h"
 
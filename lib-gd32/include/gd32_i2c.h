@@ -58,6 +58,47 @@ void Gd32I2cWriteReg(uint8_t address, uint8_t reg, uint16_t value);
 void Gd32I2cReadReg(uint8_t reg, uint8_t& value);
 void Gd32I2cReadReg(uint8_t address, uint8_t reg, uint8_t& value);
 
+#if defined(CONFIG_I2C_ASYNC)
+namespace gd32::i2c
+{
+inline constexpr uint32_t kAsyncQueueSize = 8;
+static_assert((kAsyncQueueSize & (kAsyncQueueSize - 1)) == 0, "kAsyncQueueSize must be a power of 2");
+
+struct Transaction;
+typedef void (*TransactionCallback)(Transaction& transaction);
+
+/**
+ * A write of write_length bytes, followed by a repeated start read of read_length bytes.
+ * Both lengths 0 is an address probe.
+ * The transaction and its buffers must stay valid until is_done is set.
+ */
+struct Transaction
+{
+    const uint8_t* write_data;
+    uint32_t write_length;
+    uint8_t* read_data;
+    uint32_t read_length;
+    TransactionCallback callback; ///< Called from interrupt context, can be nullptr
+    void* context;
+    uint8_t address;              ///< 7-bit address
+    volatile uint8_t result;      ///< gd32_i2c_rc_t
+    volatile bool is_done;
+};
+} // namespace gd32::i2c
+
+/**
+ * Interrupt driven transactions on I2C_PERIPH.
+ * The blocking API waits for the queue to drain before it uses the bus.
+ * @return false when the queue is full.
+ */
+bool Gd32I2cAsyncSubmit(gd32::i2c::Transaction& transaction);
+bool Gd32I2cAsyncIsIdle();
+/**
+ * Call from the superloop, recovers the bus when a transaction times out.
+ */
+void Gd32I2cAsyncRun();
+#endif
+
 #if defined(CONFIG_ENABLE_I2C1)
 void Gd32I2c1Begin();
 void Gd32I2c1SetBaudrate(uint32_t baudrate);
@@ -66,8 +66,14 @@ void Gd32SpiWritenb(const char* tx_buffer, uint32_t length);
  */
 
 // const uint8_t* Gd32SpiDmaTxPrepare(uint32_t& length);
-// void Gd32SpiDmaTxStart(const uint8_t* tx_buffer, uint32_t length);
-// bool Gd32SpiDmaTxIsActive();
+
+/**
+ * Available when the board defines SPI_DMAx and SPI_DMA_CHx.
+ * The caller owns the buffer, it must stay valid until Gd32SpiDmaTxIsActive() returns false.
+ * The chip select is not handled.
+ */
+void Gd32SpiDmaTxStart(const uint8_t* tx_buffer, uint32_t length);
+bool Gd32SpiDmaTxIsActive();
 
 /**
  * SPI DMA implementation using I2S.
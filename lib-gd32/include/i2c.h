@@ -108,6 +108,22 @@ inline void ReadReg(uint8_t reg, uint8_t& value) {
 inline void ReadReg(uint8_t address, uint8_t reg, uint8_t& value) {
     Gd32I2cReadReg(address, reg, value);
 }
+
+#if defined(CONFIG_I2C_ASYNC)
+using Transaction = gd32::i2c::Transaction;
+
+inline bool AsyncSubmit(Transaction& transaction) {
+    return Gd32I2cAsyncSubmit(transaction);
+}
+
+inline bool AsyncIsIdle() {
+    return Gd32I2cAsyncIsIdle();
+}
+
+inline void AsyncRun() {
+    Gd32I2cAsyncRun();
+}
+#endif
 } // namespace i2c
 
 class I2c {
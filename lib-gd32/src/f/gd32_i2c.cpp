@@ -36,11 +36,25 @@
 
 #include "gd32.h"
 #include "gd32_i2c.h"
+#if defined(CONFIG_I2C_ASYNC)
+#include "timing.h"
+#endif
 
 static constexpr int32_t kTimeout = 0xfff;
 
 static uint8_t s_address;
 static uint8_t s_address1;
+static uint32_t s_baudrate = gd32::kI2CFullSpeed;
+
+template <uint32_t PERIPH> static void WaitAsyncIdle() {
+#if defined(CONFIG_I2C_ASYNC)
+    if constexpr (PERIPH == I2C_PERIPH) {
+        while (!Gd32I2cAsyncIsIdle()) {
+            Gd32I2cAsyncRun();
+        }
+    }
+#endif
+}
 
 // i2c master sends start signal only when the bus is idle
 template <uint32_t PERIPH> static int32_t SendStart() {
@@ -130,6 +144,8 @@ template <uint32_t PERIPH> static int32_t SendData(const uint8_t* data, uint32_t
 }
 
 template <uint32_t PERIPH> static int32_t WriteImplementation(const char* buffer, uint32_t length) {
+    WaitAsyncIdle<PERIPH>();
+
     if (SendStart<PERIPH>() != GD32_I2C_OK) {
         SendStop<PERIPH>();
         return -1;
@@ -151,6 +167,8 @@ template <uint32_t PERIPH> static int32_t WriteImplementation(const char* buffer
 }
 
 template <uint32_t PERIPH> static uint8_t ReadImplementation(char* buffer, uint32_t length) {
+    WaitAsyncIdle<PERIPH>();
+
     auto timeout = kTimeout;
 
     while (i2c_flag_get(PERIPH, I2C_FLAG_I2CBSY)) {
@@ -357,6 +375,8 @@ void Gd32I2cBegin() {
 }
 
 void Gd32I2cSetBaudrate(uint32_t baudrate) {
+    WaitAsyncIdle<I2C_PERIPH>();
+    s_baudrate = baudrate;
     i2c_clock_config(I2C_PERIPH, baudrate, I2C_DTCY_2);
 }
 
@@ -424,6 +444,311 @@ void Gd32I2cReadReg(uint8_t address, uint8_t reg, uint8_t& value) {
     ReadRegisterImplementation<I2C_PERIPH>(reg, value);
 }
 
+#if defined(CONFIG_I2C_ASYNC)
+/*
+ * Interrupt driven transaction engine for I2C_PERIPH.
+ * Transactions are queued; the event interrupt runs the master state machine,
+ * the error interrupt completes a transaction with NACK, arbitration lost or bus error.
+ * The read sequence for 1, 2 and 3 or more bytes follows the reference manual (ACKEN/POAP/BTC handling).
+ */
+namespace {
+enum class Phase : uint8_t { kWrite, kRead };
+
+gd32::i2c::Transaction* s_queue[gd32::i2c::kAsyncQueueSize];
+volatile uint32_t s_queue_head;
+volatile uint32_t s_queue_tail;
+gd32::i2c::Transaction* volatile s_current;
+Phase s_phase;
+uint32_t s_index;
+uint32_t s_start_millis;
+
+constexpr IRQn_Type kEventIRQn = (I2C_PERIPH == I2C0) ? I2C0_EV_IRQn : I2C1_EV_IRQn;
+constexpr IRQn_Type kErrorIRQn = (I2C_PERIPH == I2C0) ? I2C0_ER_IRQn : I2C1_ER_IRQn;
+constexpr uint32_t kStat0Errors = I2C_STAT0_BERR | I2C_STAT0_LOSTARB | I2C_STAT0_AERR | I2C_STAT0_OUERR;
+
+void ClearAddSend() {
+    // ADDSEND is cleared by reading STAT0 followed by STAT1
+    static_cast<void>(I2C_STAT0(I2C_PERIPH));
+    static_cast<void>(I2C_STAT1(I2C_PERIPH));
+}
+
+void StartNext() {
+    if (s_queue_head == s_queue_tail) {
+        s_current = nullptr;
+        I2C_CTL1(I2C_PERIPH) &= ~(I2C_CTL1_EVIE | I2C_CTL1_BUFIE | I2C_CTL1_ERRIE);
+        return;
+    }
+
+    auto* transaction = s_queue[s_queue_tail & (gd32::i2c::kAsyncQueueSize - 1)];
+    s_queue_tail = s_queue_tail + 1;
+
+    s_current = transaction;
+    s_phase = ((transaction->write_length != 0) || (transaction->read_length == 0)) ? Phase::kWrite : Phase::kRead;
+    s_index = 0;
+    s_start_millis = timing::Millis();
+
+    // The blocking API does not clear the acknowledge error of a probe, it would fail this transaction
+    I2C_STAT0(I2C_PERIPH) &= ~kStat0Errors;
+    I2C_CTL0(I2C_PERIPH) = (I2C_CTL0(I2C_PERIPH) & ~I2C_CTL0_POAP) | I2C_CTL0_ACKEN;
+    I2C_CTL1(I2C_PERIPH) |= I2C_CTL1_EVIE | I2C_CTL1_BUFIE | I2C_CTL1_ERRIE;
+    I2C_CTL0(I2C_PERIPH) |= I2C_CTL0_START;
+}
+
+void Complete(uint8_t result) {
+    auto* transaction = s_current;
+
+    transaction->result = result;
+    transaction->is_done = true;
+
+    if (transaction->callback != nullptr) {
+        transaction->callback(*transaction);
+    }
+
+    StartNext();
+}
+
+void StartRead() {
+    s_phase = Phase::kRead;
+    s_index = 0;
+
+    I2C_CTL1(I2C_PERIPH) |= I2C_CTL1_BUFIE;
+    I2C_CTL0(I2C_PERIPH) |= I2C_CTL0_START;
+}
+
+void EventWrite(uint32_t stat0) {
+    auto* transaction = s_current;
+
+    if ((stat0 & (I2C_STAT0_TBE | I2C_STAT0_BTC)) == 0) {
+        return;
+    }
+
+    if (s_index < transaction->write_length) {
+        I2C_DATA(I2C_PERIPH) = transaction->write_data[s_index++];
+
+        if (s_index == transaction->write_length) {
+            I2C_CTL1(I2C_PERIPH) &= ~I2C_CTL1_BUFIE; // Wait for BTC
+        }
+
+        return;
+    }
+
+    if ((stat0 & I2C_STAT0_BTC) == 0) {
+        return;
+    }
+
+    if (transaction->read_length != 0) {
+        StartRead();
+        return;
+    }
+
+    I2C_CTL0(I2C_PERIPH) |= I2C_CTL0_STOP;
+    Complete(GD32_I2C_OK);
+}
+
+void EventRead(uint32_t stat0) {
+    auto* transaction = s_current;
+    const auto kRemaining = transaction->read_length - s_index;
+
+    if (stat0 & I2C_STAT0_BTC) {
+        if (kRemaining == 3) {
+            I2C_CTL0(I2C_PERIPH) &= ~I2C_CTL0_ACKEN;
+            transaction->read_data[s_index++] = static_cast<uint8_t>(I2C_DATA(I2C_PERIPH));
+            return;
+        }
+
+        if (kRemaining == 2) {
+            I2C_CTL0(I2C_PERIPH) |= I2C_CTL0_STOP;
+            transaction->read_data[s_index++] = static_cast<uint8_t>(I2C_DATA(I2C_PERIPH));
+            transaction->read_data[s_index++] = static_cast<uint8_t>(I2C_DATA(I2C_PERIPH));
+            Complete(GD32_I2C_OK);
+            return;
+        }
+    }
+
+    if ((stat0 & I2C_STAT0_RBNE) == 0) {
+        return;
+    }
+
+    if (kRemaining > 3) {
+        transaction->read_data[s_index++] = static_cast<uint8_t>(I2C_DATA(I2C_PERIPH));
+        return;
+    }
+
+    if (kRemaining == 1) {
+        transaction->read_data[s_index++] = static_cast<uint8_t>(I2C_DATA(I2C_PERIPH));
+        Complete(GD32_I2C_OK);
+        return;
+    }
+
+    I2C_CTL1(I2C_PERIPH) &= ~I2C_CTL1_BUFIE; // The last 2 or 3 bytes are handled on BTC
+}
+
+void EventHandler() {
+    auto* transaction = s_current;
+    const auto kStat0 = I2C_STAT0(I2C_PERIPH);
+
+    if (transaction == nullptr) [[unlikely]] {
+        I2C_CTL1(I2C_PERIPH) &= ~(I2C_CTL1_EVIE | I2C_CTL1_BUFIE | I2C_CTL1_ERRIE);
+        return;
+    }
+
+    if (kStat0 & I2C_STAT0_SBSEND) {
+        I2C_DATA(I2C_PERIPH) = static_cast<uint32_t>(transaction->address << 1) | ((s_phase == Phase::kRead) ? 1U : 0U);
+        return;
+    }
+
+    if (kStat0 & I2C_STAT0_ADDSEND) {
+        if (s_phase == Phase::kRead) {
+            if (transaction->read_length == 1) {
+                I2C_CTL0(I2C_PERIPH) &= ~I2C_CTL0_ACKEN;
+                ClearAddSend();
+                I2C_CTL0(I2C_PERIPH) |= I2C_CTL0_STOP;
+                return;
+            }
+
+            if (transaction->read_length == 2) {
+                I2C_CTL0(I2C_PERIPH) = (I2C_CTL0(I2C_PERIPH) & ~I2C_CTL0_ACKEN) | I2C_CTL0_POAP;
+                I2C_CTL1(I2C_PERIPH) &= ~I2C_CTL1_BUFIE;
+                ClearAddSend();
+                return;
+            }
+
+            ClearAddSend();
+            return;
+        }
+
+        ClearAddSend();
+
+        if ((transaction->write_length == 0) && (transaction->read_length == 0)) {
+            I2C_CTL0(I2C_PERIPH) |= I2C_CTL0_STOP;
+            Complete(GD32_I2C_OK);
+        }
+
+        return;
+    }
+
+    if (s_phase == Phase::kWrite) {
+        EventWrite(kStat0);
+    } else {
+        EventRead(kStat0);
+    }
+}
+
+void ErrorHandler() {
+    const auto kStat0 = I2C_STAT0(I2C_PERIPH);
+
+    I2C_STAT0(I2C_PERIPH) = kStat0 & ~kStat0Errors;
+
+    if (s_current == nullptr) [[unlikely]] {
+        return;
+    }
+
+    uint8_t result = GD32_I2C_NOK;
+
+    if (kStat0 & I2C_STAT0_LOSTARB) {
+        result = GD32_I2C_NOK_LA; // The bus is released by hardware
+    } else {
+        if (kStat0 & I2C_STAT0_AERR) {
+            result = GD32_I2C_NACK;
+        }
+        I2C_CTL0(I2C_PERIPH) |= I2C_CTL0_STOP;
+    }
+
+    Complete(result);
+}
+} // namespace
+
+extern "C" {
+void I2C0_EV_IRQHandler() {
+    if constexpr (I2C_PERIPH == I2C0) {
+        EventHandler();
+    }
+}
+
+void I2C0_ER_IRQHandler() {
+    if constexpr (I2C_PERIPH == I2C0) {
+        ErrorHandler();
+    }
+}
+
+void I2C1_EV_IRQHandler() {
+    if constexpr (I2C_PERIPH == I2C1) {
+        EventHandler();
+    }
+}
+
+void I2C1_ER_IRQHandler() {
+    if constexpr (I2C_PERIPH == I2C1) {
+        ErrorHandler();
+    }
+}
+}
+
+bool Gd32I2cAsyncSubmit(gd32::i2c::Transaction& transaction) {
+    if ((s_queue_head - s_queue_tail) == gd32::i2c::kAsyncQueueSize) {
+        return false;
+    }
+
+    transaction.is_done = false;
+    transaction.result = GD32_I2C_OK;
+
+    s_queue[s_queue_head & (gd32::i2c::kAsyncQueueSize - 1)] = &transaction;
+
+    const auto kPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    s_queue_head = s_queue_head + 1;
+
+    if (s_current == nullptr) {
+        NVIC_SetPriority(kEventIRQn, 2);
+        NVIC_SetPriority(kErrorIRQn, 1);
+        NVIC_EnableIRQ(kEventIRQn);
+        NVIC_EnableIRQ(kErrorIRQn);
+        StartNext();
+    }
+
+    __set_PRIMASK(kPrimask);
+
+    return true;
+}
+
+bool Gd32I2cAsyncIsIdle() {
+    return s_current == nullptr;
+}
+
+void Gd32I2cAsyncRun() {
+    auto* transaction = s_current;
+
+    if (transaction == nullptr) {
+        return;
+    }
+
+    // Allow for 100 kHz, about 11 bytes per millisecond
+    const auto kTimeoutMillis = 10 + (transaction->write_length + transaction->read_length) / 8;
+
+    if ((timing::Millis() - s_start_millis) <= kTimeoutMillis) {
+        return;
+    }
+
+    const auto kPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    if (s_current == transaction) {
+        I2C_CTL1(I2C_PERIPH) &= ~(I2C_CTL1_EVIE | I2C_CTL1_BUFIE | I2C_CTL1_ERRIE);
+
+        I2C_CTL0(I2C_PERIPH) |= I2C_CTL0_SRESET;
+        I2C_CTL0(I2C_PERIPH) &= ~I2C_CTL0_SRESET;
+
+        i2c_clock_config(I2C_PERIPH, s_baudrate, I2C_DTCY_2);
+        i2c_enable(I2C_PERIPH);
+
+        Complete(GD32_I2C_NOK_TOUT);
+    }
+
+    __set_PRIMASK(kPrimask);
+}
+#endif // CONFIG_I2C_ASYNC
+
 // I2C1
 #if defined(CONFIG_ENABLE_I2C1)
 void Gd32I2c1Begin() {
@@ -91,6 +91,53 @@ static void GpioConfig() {
     SetCsHigh();
 }
 
+#if defined(SPI_DMAx)
+#if defined(GD32F4XX)
+#define DMA_PARAMETER_STRUCT dma_single_data_parameter_struct
+#define DMA_CHMADDR DMA_CHM0ADDR
+#define DMA_MEMORY_TO_PERIPHERAL DMA_MEMORY_TO_PERIPH
+#define dma_init dma_single_data_mode_init
+#define dma_struct_para_init dma_single_data_para_struct_init
+#define dma_memory_to_memory_disable(x, y)
+#else
+#define DMA_PARAMETER_STRUCT dma_parameter_struct
+#endif
+
+static void SpiDmaConfig() {
+    if (SPI_DMAx == DMA0) {
+        rcu_periph_clock_enable(RCU_DMA0);
+    } else {
+        rcu_periph_clock_enable(RCU_DMA1);
+    }
+
+    dma_deinit(SPI_DMAx, SPI_DMA_CHx);
+
+    DMA_PARAMETER_STRUCT dma_init_struct;
+    dma_struct_para_init(&dma_init_struct);
+
+    dma_init_struct.direction = DMA_MEMORY_TO_PERIPHERAL;
+    dma_init_struct.memory_inc = DMA_MEMORY_INCREASE_ENABLE;
+#if defined(GD32F4XX)
+    dma_init_struct.periph_memory_width = DMA_PERIPH_WIDTH_8BIT;
+#else
+    dma_init_struct.memory_width = DMA_MEMORY_WIDTH_8BIT;
+    dma_init_struct.periph_width = DMA_PERIPHERAL_WIDTH_8BIT;
+#endif
+    dma_init_struct.periph_addr = SPI_PERIPH + 0x0CU;
+    dma_init_struct.periph_inc = DMA_PERIPH_INCREASE_DISABLE;
+    dma_init_struct.priority = DMA_PRIORITY_MEDIUM;
+    dma_init(SPI_DMAx, SPI_DMA_CHx, &dma_init_struct);
+
+    dma_circulation_disable(SPI_DMAx, SPI_DMA_CHx);
+    dma_memory_to_memory_disable(SPI_DMAx, SPI_DMA_CHx);
+#if defined(GD32F4XX)
+    dma_channel_subperipheral_select(SPI_DMAx, SPI_DMA_CHx, SPI_DMA_SUBPERIx);
+#endif
+
+    DMA_CHCNT(SPI_DMAx, SPI_DMA_CHx) = 0;
+}
+#endif
+
 static void SpiConfig() {
     spi_disable(SPI_PERIPH);
     spi_i2s_deinit(SPI_PERIPH);
@@ -116,6 +163,9 @@ void Gd32SpiBegin() {
     RcuConfig();
     GpioConfig();
     SpiConfig();
+#if defined(SPI_DMAx)
+    SpiDmaConfig();
+#endif
 }
 
 void Gd32SpiEnd() {
@@ -227,6 +277,51 @@ void Gd32SpiWritenb(const char* tx_buffer, uint32_t data_length) {
     SetCsHigh();
 }
 
+#if defined(SPI_DMAx)
+void Gd32SpiDmaTxStart(const uint8_t* tx_buffer, uint32_t length) {
+    assert(tx_buffer != nullptr);
+    assert(length != 0);
+    assert(length <= DMA_CHXCNT_CNT);
+
+#if defined(GD32F4XX)
+    dma_flag_clear(SPI_DMAx, SPI_DMA_CHx, DMA_FLAG_FTF);
+#endif
+
+    auto dma_ch_ctl = DMA_CHCTL(SPI_DMAx, SPI_DMA_CHx);
+    dma_ch_ctl &= ~DMA_CHXCTL_CHEN;
+    DMA_CHCTL(SPI_DMAx, SPI_DMA_CHx) = dma_ch_ctl;
+
+    DMA_CHMADDR(SPI_DMAx, SPI_DMA_CHx) = reinterpret_cast<uint32_t>(tx_buffer);
+    DMA_CHCNT(SPI_DMAx, SPI_DMA_CHx) = (length & DMA_CHXCNT_CNT);
+
+    dma_ch_ctl |= DMA_CHXCTL_CHEN;
+    DMA_CHCTL(SPI_DMAx, SPI_DMA_CHx) = dma_ch_ctl;
+
+    spi_dma_enable(SPI_PERIPH, SPI_DMA_TRANSMIT);
+}
+
+/**
+ * The transfer is finished when the DMA is done and the last byte has left the shift register.
+ */
+bool Gd32SpiDmaTxIsActive() {
+    if (DMA_CHCNT(SPI_DMAx, SPI_DMA_CHx) != 0) {
+        return true;
+    }
+
+    const auto kStat = SPI_STAT(SPI_PERIPH);
+
+    if (((kStat & SPI_FLAG_TBE) == 0) || ((kStat & SPI_FLAG_TRANS) != 0)) {
+        return true;
+    }
+
+    // The received bytes are not used; reading DATA then STAT also clears the overrun flag.
+    static_cast<void>(SPI_DATA(SPI_PERIPH));
+    static_cast<void>(SPI_STAT(SPI_PERIPH));
+
+    return false;
+}
+#endif
+
 #if defined(SPI_BITBANG_SCK_GPIO_PINx)
 // bitbang support
 // Note: /CS is handled by the user application
@@ -0,0 +1,83 @@
+/**
+ * @file gamma16_tables.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef GAMMA_GAMMA16_TABLES_H_
+#define GAMMA_GAMMA16_TABLES_H_
+
+#include <cstdint>
+
+#include "gamma10offset0_16.h"
+#include "gamma20offset0_16.h"
+#include "gamma21offset0_16.h"
+#include "gamma22offset0_16.h"
+#include "gamma23offset0_16.h"
+#include "gamma24offset0_16.h"
+#include "gamma25offset0_16.h"
+#include "gamma25offset5_16.h"
+
+#include "gamma_tables.h"
+
+/**
+ * 16-bit versions of the 8-bit gamma tables, the same curves with the fraction kept.
+ * Used by the temporal dithering, value = 0 or round(65535 * (x / 255)^gamma + 257 * offset).
+ */
+namespace gamma16
+{
+inline const uint16_t* GetTable(const uint8_t* table)
+{
+    if (table == gamma20_0)
+    {
+        return gamma20_0_16;
+    }
+    else if (table == gamma21_0)
+    {
+        return gamma21_0_16;
+    }
+    else if (table == gamma22_0)
+    {
+        return gamma22_0_16;
+    }
+    else if (table == gamma23_0)
+    {
+        return gamma23_0_16;
+    }
+    else if (table == gamma24_0)
+    {
+        return gamma24_0_16;
+    }
+    else if (table == gamma25_0)
+    {
+        return gamma25_0_16;
+    }
+    else if (table == gamma25_5)
+    {
+        return gamma25_5_16;
+    }
+
+    return gamma10_0_16;
+}
+} // namespace gamma16
+
+#endif  // GAMMA_GAMMA16_TABLES_H_
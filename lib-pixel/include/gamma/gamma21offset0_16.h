@@ -0,0 +1,19 @@
+// gamma=2.1, offset=0.0, 16-bit
+static constexpr uint16_t gamma21_0_16[256] = {
+     0,     1,     2,     6,    11,    17,    25,    34,    46,    58,    73,    89,   107,   126,   148,   171,
+   196,   222,   251,   281,   313,   346,   382,   419,   458,   499,   542,   587,   634,   682,   732,   785,
+   839,   895,   952,  1012,  1074,  1138,  1203,  1270,  1340,  1411,  1484,  1560,  1637,  1716,  1797,  1880,
+  1965,  2052,  2141,  2232,  2325,  2419,  2516,  2615,  2716,  2819,  2924,  3031,  3139,  3250,  3363,  3478,
+  3595,  3714,  3835,  3958,  4083,  4210,  4340,  4471,  4604,  4739,  4877,  5016,  5158,  5301,  5447,  5594,
+  5744,  5896,  6050,  6206,  6364,  6524,  6686,  6851,  7017,  7186,  7356,  7529,  7704,  7880,  8059,  8241,
+  8424,  8609,  8797,  8986,  9178,  9372,  9568,  9766,  9966, 10168, 10372, 10579, 10788, 10999, 11211, 11427,
+ 11644, 11863, 12085, 12308, 12534, 12762, 12992, 13225, 13459, 13696, 13935, 14176, 14419, 14664, 14911, 15161,
+ 15413, 15667, 15923, 16181, 16442, 16704, 16969, 17236, 17505, 17777, 18050, 18326, 18604, 18884, 19167, 19451,
+ 19738, 20027, 20318, 20611, 20907, 21205, 21505, 21807, 22111, 22418, 22726, 23038, 23351, 23666, 23984, 24304,
+ 24626, 24950, 25277, 25605, 25936, 26270, 26605, 26943, 27283, 27625, 27969, 28316, 28665, 29016, 29369, 29725,
+ 30083, 30443, 30805, 31170, 31536, 31905, 32277, 32650, 33026, 33404, 33784, 34167, 34552, 34939, 35328, 35720,
+ 36114, 36510, 36908, 37309, 37712, 38117, 38524, 38934, 39346, 39760, 40177, 40596, 41017, 41440, 41866, 42294,
+ 42724, 43156, 43591, 44028, 44468, 44909, 45353, 45799, 46248, 46699, 47152, 47607, 48065, 48525, 48987, 49451,
+ 49918, 50387, 50859, 51333, 51809, 52287, 52768, 53251, 53736, 54223, 54713, 55205, 55700, 56197, 56696, 57197,
+ 57701, 58207, 58715, 59226, 59739, 60254, 60772, 61292, 61814, 62339, 62866, 63395, 63926, 64460, 64996, 65535 
+};
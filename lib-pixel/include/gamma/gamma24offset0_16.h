@@ -0,0 +1,19 @@
+// gamma=2.4, offset=0.0, 16-bit
+static constexpr uint16_t gamma24_0_16[256] = {
+     0,     0,     1,     2,     3,     5,     8,    12,    16,    21,    28,    35,    43,    52,    62,    73,
+    85,    99,   113,   129,   146,   164,   183,   204,   226,   249,   273,   299,   327,   355,   385,   417,
+   450,   484,   520,   558,   597,   637,   680,   723,   769,   816,   864,   914,   966,  1020,  1075,  1132,
+  1191,  1251,  1313,  1377,  1443,  1510,  1580,  1651,  1724,  1798,  1875,  1954,  2034,  2116,  2200,  2287,
+  2375,  2465,  2557,  2651,  2747,  2845,  2945,  3046,  3150,  3257,  3365,  3475,  3587,  3701,  3818,  3936,
+  4057,  4180,  4305,  4432,  4561,  4692,  4826,  4962,  5100,  5240,  5382,  5527,  5674,  5823,  5974,  6128,
+  6284,  6442,  6603,  6766,  6931,  7098,  7268,  7440,  7615,  7792,  7971,  8153,  8337,  8523,  8712,  8903,
+  9097,  9293,  9492,  9693,  9896, 10102, 10311, 10522, 10735, 10951, 11170, 11391, 11614, 11840, 12069, 12300,
+ 12534, 12770, 13009, 13250, 13494, 13741, 13990, 14242, 14497, 14754, 15014, 15276, 15541, 15809, 16079, 16352,
+ 16628, 16907, 17188, 17472, 17758, 18048, 18340, 18635, 18932, 19233, 19536, 19841, 20150, 20461, 20776, 21093,
+ 21412, 21735, 22060, 22389, 22720, 23054, 23390, 23730, 24072, 24418, 24766, 25117, 25471, 25828, 26188, 26550,
+ 26916, 27284, 27656, 28030, 28407, 28788, 29171, 29557, 29946, 30338, 30733, 31131, 31532, 31936, 32343, 32753,
+ 33167, 33583, 34002, 34424, 34849, 35277, 35709, 36143, 36580, 37021, 37465, 37911, 38361, 38814, 39270, 39729,
+ 40191, 40656, 41125, 41596, 42071, 42549, 43030, 43514, 44001, 44492, 44985, 45482, 45982, 46486, 46992, 47502,
+ 48014, 48531, 49050, 49572, 50098, 50627, 51159, 51695, 52233, 52775, 53321, 53869, 54421, 54976, 55534, 56096,
+ 56661, 57229, 57801, 58376, 58954, 59535, 60120, 60709, 61300, 61895, 62493, 63095, 63700, 64308, 64920, 65535 
+};
@@ -0,0 +1,19 @@
+// gamma=2.5, offset=0.0, 16-bit
+static constexpr uint16_t gamma25_0_16[256] = {
+     0,     0,     0,     1,     2,     4,     6,     8,    11,    15,    20,    25,    31,    38,    46,    55,
+    65,    75,    87,    99,   113,   128,   143,   160,   178,   197,   218,   239,   262,   286,   311,   338,
+   366,   395,   425,   457,   491,   526,   562,   599,   639,   679,   722,   765,   811,   857,   906,   956,
+  1007,  1061,  1116,  1172,  1231,  1291,  1352,  1416,  1481,  1548,  1617,  1688,  1760,  1834,  1910,  1988,
+  2068,  2150,  2233,  2319,  2407,  2496,  2587,  2681,  2776,  2874,  2973,  3075,  3178,  3284,  3391,  3501,
+  3613,  3727,  3843,  3961,  4082,  4204,  4329,  4456,  4585,  4716,  4850,  4986,  5124,  5264,  5407,  5552,
+  5699,  5849,  6001,  6155,  6311,  6470,  6632,  6795,  6962,  7130,  7301,  7475,  7650,  7829,  8009,  8193,
+  8379,  8567,  8758,  8951,  9147,  9345,  9546,  9750,  9956, 10165, 10376, 10590, 10806, 11025, 11247, 11472,
+ 11699, 11929, 12161, 12397, 12634, 12875, 13119, 13365, 13614, 13865, 14120, 14377, 14637, 14899, 15165, 15433,
+ 15705, 15979, 16256, 16535, 16818, 17104, 17392, 17683, 17978, 18275, 18575, 18878, 19184, 19493, 19805, 20119,
+ 20437, 20758, 21082, 21409, 21739, 22072, 22407, 22746, 23089, 23434, 23782, 24133, 24487, 24845, 25206, 25569,
+ 25936, 26306, 26679, 27055, 27435, 27818, 28203, 28592, 28985, 29380, 29779, 30181, 30586, 30994, 31406, 31820,
+ 32239, 32660, 33085, 33513, 33944, 34379, 34817, 35258, 35702, 36150, 36602, 37056, 37514, 37976, 38441, 38909,
+ 39380, 39856, 40334, 40816, 41301, 41790, 42282, 42778, 43277, 43780, 44286, 44795, 45308, 45825, 46345, 46869,
+ 47396, 47927, 48461, 48999, 49540, 50085, 50634, 51186, 51742, 52301, 52864, 53431, 54001, 54575, 55153, 55734,
+ 56318, 56907, 57499, 58095, 58695, 59298, 59905, 60515, 61130, 61748, 62370, 62995, 63624, 64258, 64894, 65535 
+};
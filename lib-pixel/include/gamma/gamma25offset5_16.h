@@ -0,0 +1,19 @@
+// gamma=2.5, offset=0.5, 16-bit
+static constexpr uint16_t gamma25_5_16[256] = {
+     0,   129,   129,   129,   131,   132,   134,   137,   140,   144,   148,   154,   160,   167,   175,   183,
+   193,   204,   215,   228,   241,   256,   272,   289,   307,   326,   346,   368,   390,   414,   440,   466,
+   494,   523,   554,   586,   619,   654,   690,   728,   767,   808,   850,   894,   939,   986,  1034,  1084,
+  1136,  1189,  1244,  1301,  1359,  1419,  1481,  1544,  1610,  1677,  1745,  1816,  1888,  1963,  2039,  2117,
+  2197,  2278,  2362,  2448,  2535,  2625,  2716,  2809,  2905,  3002,  3102,  3203,  3307,  3412,  3520,  3629,
+  3741,  3855,  3971,  4090,  4210,  4333,  4457,  4584,  4713,  4845,  4978,  5114,  5252,  5393,  5535,  5680,
+  5828,  5977,  6129,  6283,  6440,  6599,  6760,  6924,  7090,  7259,  7430,  7603,  7779,  7957,  8138,  8321,
+  8507,  8695,  8886,  9079,  9275,  9474,  9675,  9878, 10084, 10293, 10504, 10718, 10935, 11154, 11376, 11600,
+ 11827, 12057, 12290, 12525, 12763, 13004, 13247, 13493, 13742, 13994, 14248, 14505, 14765, 15028, 15294, 15562,
+ 15833, 16107, 16384, 16664, 16947, 17232, 17521, 17812, 18106, 18403, 18703, 19006, 19312, 19621, 19933, 20248,
+ 20566, 20887, 21210, 21537, 21867, 22200, 22536, 22875, 23217, 23562, 23910, 24262, 24616, 24973, 25334, 25698,
+ 26065, 26435, 26808, 27184, 27563, 27946, 28332, 28721, 29113, 29509, 29907, 30309, 30714, 31122, 31534, 31949,
+ 32367, 32788, 33213, 33641, 34073, 34507, 34945, 35386, 35831, 36279, 36730, 37185, 37643, 38104, 38569, 39037,
+ 39509, 39984, 40462, 40944, 41430, 41918, 42411, 42906, 43406, 43908, 44414, 44924, 45437, 45954, 46474, 46997,
+ 47525, 48055, 48590, 49128, 49669, 50214, 50763, 51315, 51870, 52430, 52993, 53559, 54130, 54703, 55281, 55862,
+ 56447, 57035, 57628, 58223, 58823, 59426, 60033, 60644, 61258, 61876, 62498, 63124, 63753, 64386, 65023, 65535 
+};
@@ -44,19 +44,19 @@ namespace gamma
 inline constexpr auto kMin = 20U; ///< 2.0
 inline constexpr auto kMax = 25U; ///< 2.5
 
-inline const uint8_t* GetTableDefault(pixel::Type type)
+inline const uint8_t* GetTableDefault(pixel::LedType type)
 {
-    if (type == pixel::Type::WS2801)
+    if (type == pixel::LedType::kWS2801)
     {
         return gamma25_0;
     }
 
-    if ((type == pixel::Type::APA102) || (type == pixel::Type::SK9822))
+    if ((type == pixel::LedType::kAPA102) || (type == pixel::LedType::kSK9822))
     {
         return gamma25_5;
     }
 
-    if (type == pixel::Type::P9813)
+    if (type == pixel::LedType::kP9813)
     {
         return gamma10_0;
     }
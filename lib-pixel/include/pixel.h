@@ -41,11 +41,11 @@
 #include "pixelconfiguration.h"
 
 namespace pixel {
-inline uint32_t GetColour(uint8_t red, uint8_t green, uint8_t blue) {
+inline constexpr uint32_t GetColour(uint8_t red, uint8_t green, uint8_t blue) {
     return static_cast<uint32_t>(red << 16) | static_cast<uint32_t>(green << 8) | blue;
 }
 
-inline uint32_t GetColour(uint8_t red, uint8_t green, uint8_t blue, uint8_t white) {
+inline constexpr uint32_t GetColour(uint8_t red, uint8_t green, uint8_t blue, uint8_t white) {
     return static_cast<uint32_t>(white << 24) | static_cast<uint32_t>(red << 16) | static_cast<uint32_t>(green << 8) | blue;
 }
 
@@ -71,26 +71,15 @@ inline void SetPixelColour([[maybe_unused]] uint32_t port_index, uint32_t pixel_
 #if defined(PIXELPATTERNS_MULTI)
     switch (PixelConfiguration::Get().GetType()) {
         case pixel::LedType::kWS2801:
-            output_type->SetColourWS2801(port_index, pixel_index, kColours.Red(), kColours.Green(), kColours.Blue());
-            break;
-
         case pixel::LedType::kAPA102:
         case pixel::LedType::kSK9822:
-            output_type->SetPixel4Bytes(port_index, pixel_index, 0xFF, kColours.Red(), kColours.Green(), kColours.Blue());
-            break;
-
-        case pixel::LedType::kP9813: {
-            const auto kRed = kColours.Red();
-            const auto kBlue = kColours.Blue();
-            const uint8_t kFlag = static_cast<uint8_t>(0xC0 | ((~kBlue & 0xC0) >> 2) | ((~kRed & 0xC0) >> 4) | ((~kRed & 0xC0) >> 6));
-            output_type->SetPixel4Bytes(port_index, pixel_index, kFlag, kBlue, kColours.Green(), kRed);
+        case pixel::LedType::kP9813:
+            // The ports have no clock line, PixelOutputMulti::ApplyConfiguration() sets WS2812B instead
+            assert(0);
             break;
-        }
-
         case pixel::LedType::kSK6812W:
             output_type->SetColourRTZ(port_index, pixel_index, kColours.Red(), kColours.Green(), kColours.Blue(), kColours.White());
             break;
-
         default:
             output_type->SetColourRTZ(port_index, pixel_index, kColours.Red(), kColours.Green(), kColours.Blue());
             break;
@@ -112,14 +101,35 @@ inline void SetPixelColour([[maybe_unused]] uint32_t port_index, uint32_t pixel_
 #endif // PIXELPATTERNS_MULTI
 }
 
-inline void SetPixelColour(uint32_t port_index, uint32_t colour) {
-    const auto kCount = PixelConfiguration::Get().GetCount();
+/**
+ * Sets count pixels, stride apart, starting at pixel_index.
+ */
+inline void FillPixelColour([[maybe_unused]] uint32_t port_index, uint32_t pixel_index, uint32_t count, uint32_t colour, uint32_t stride = 1) {
+#if defined(PIXELPATTERNS_MULTI)
+    for (uint32_t i = 0; i < count; i++) {
+        SetPixelColour(port_index, pixel_index, colour);
+        pixel_index += stride;
+    }
+#else
+    auto* output_type = PixelOutputType::Get();
+    assert(output_type != nullptr);
+
+    const pixel::PixelColours kColours(colour);
 
-    for (uint32_t i = 0; i < kCount; i++) {
-        SetPixelColour(port_index, i, colour);
+    if (PixelConfiguration::Get().GetType() != pixel::LedType::kSK6812W) {
+        output_type->SetPixels(pixel_index, count, stride, kColours.Red(), kColours.Green(), kColours.Blue());
+    } else {
+        if ((kColours.Red() == kColours.Green()) && (kColours.Green() == kColours.Blue())) {
+            output_type->SetPixels(pixel_index, count, stride, 0x00, 0x00, 0x00, kColours.Red());
+        } else {
+            output_type->SetPixels(pixel_index, count, stride, kColours.Red(), kColours.Green(), kColours.Blue(), 0x00);
+        }
     }
+#endif
 }
 
+inline void SetPixelColour(uint32_t port_index, uint32_t colour) { FillPixelColour(port_index, 0, PixelConfiguration::Get().GetCount(), colour); }
+
 inline bool IsUpdating() {
     auto* output_type = PixelOutputType::Get();
     assert(output_type != nullptr);
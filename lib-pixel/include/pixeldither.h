@@ -0,0 +1,183 @@
+/**
+ * @file pixeldither.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PIXELDITHER_H_
+#define PIXELDITHER_H_
+
+#if !defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+#error CONFIG_PIXELDMX_ENABLE_DITHERING requires CONFIG_PIXELDMX_ENABLE_GAMMATABLE
+#endif
+
+#include <cstdint>
+#include <cassert>
+
+#include "pixeloutput.h"
+#include "pixelconfiguration.h"
+#include "pixeltype.h"
+#include "gamma/gamma16_tables.h"
+
+/**
+ * Temporal dithering: the DMX values are mapped through a 16-bit gamma table,
+ * each frame sent outputs the upper 8 bits and carries the lower 8 bits over to the next frame.
+ * Averaged over N frames the output is within 1/N of the 16-bit target.
+ */
+class PixelDither
+{
+    static constexpr uint32_t kMaxChannels = (pixel::max::ledcount::kRgb * 3) > (pixel::max::ledcount::kRgbw * 4) ? (pixel::max::ledcount::kRgb * 3) : (pixel::max::ledcount::kRgbw * 4);
+
+   public:
+    /**
+     * Takes over the LED type, map and gamma table, and restarts from black.
+     */
+    void ApplyConfiguration()
+    {
+        auto& configuration = PixelConfiguration::Get();
+
+        encoder_ = pixel::output::GetEncoder(configuration.GetType());
+        gamma_table_ = gamma16::GetTable(configuration.GetGammaTable());
+        channels_ = configuration.GetLedsPerPixel();
+
+        if (channels_ == 4)
+        {
+            for (uint32_t colour = 0; colour < 4; colour++)
+            {
+                offsets_[colour] = static_cast<uint8_t>(colour);
+            }
+        }
+        else
+        {
+            assert(channels_ == 3);
+
+            for (uint32_t colour = 0; colour < 3; colour++)
+            {
+                offsets_[colour] = static_cast<uint8_t>(pixel::GetMapOffset(configuration.GetMap(), colour));
+            }
+        }
+
+        for (uint32_t i = 0; i < kMaxChannels; i++)
+        {
+            target_[i] = 0;
+            // Staggered start, so that pixels with the same value do not step in the same frame
+            error_[i] = static_cast<uint8_t>(i * 97U);
+        }
+    }
+
+    /**
+     * Stores the gamma corrected targets, the output buffer is not touched.
+     */
+    void SetData(const uint8_t* data, uint32_t length, uint32_t d, uint32_t begin_index, uint32_t end_index, uint32_t grouping_count)
+    {
+        for (auto j = begin_index; (j < end_index) && (d < length); j++)
+        {
+            auto target_index = j * grouping_count * channels_;
+            assert(target_index + grouping_count * channels_ <= kMaxChannels);
+
+            for (uint32_t k = 0; k < grouping_count; k++)
+            {
+                for (uint32_t colour = 0; colour < channels_; colour++)
+                {
+                    target_[target_index++] = gamma_table_[data[d + offsets_[colour]]];
+                }
+            }
+
+            d = d + channels_;
+        }
+    }
+
+    /**
+     * Encodes the next dithered frame into the output buffer.
+     */
+    void Render(PixelOutput& output)
+    {
+        const auto kCount = PixelConfiguration::Get().GetCount();
+
+        switch (encoder_)
+        {
+            case pixel::output::Encoder::kRtz:
+                Render<pixel::output::Encoder::kRtz>(output, kCount);
+                break;
+            case pixel::output::Encoder::kRtzRgbw:
+                Render<pixel::output::Encoder::kRtzRgbw>(output, kCount);
+                break;
+            case pixel::output::Encoder::kWS2801:
+                Render<pixel::output::Encoder::kWS2801>(output, kCount);
+                break;
+            case pixel::output::Encoder::kAPA102:
+                Render<pixel::output::Encoder::kAPA102>(output, kCount);
+                break;
+            case pixel::output::Encoder::kP9813:
+                Render<pixel::output::Encoder::kP9813>(output, kCount);
+                break;
+            default:
+                assert(0);
+                __builtin_unreachable();
+                break;
+        }
+    }
+
+   private:
+    template <pixel::output::Encoder kEncoder> void Render(PixelOutput& output, uint32_t count)
+    {
+        [[maybe_unused]] const auto kGlobalBrightness = PixelConfiguration::Get().GetGlobalBrightness();
+        uint32_t index = 0;
+
+        for (uint32_t pixel_index = 0; pixel_index < count; pixel_index++)
+        {
+            if constexpr (kEncoder == pixel::output::Encoder::kRtzRgbw)
+            {
+                const auto kRed = Next(index);
+                const auto kGreen = Next(index + 1);
+                const auto kBlue = Next(index + 2);
+                output.SetPixelRgbw(pixel_index, kRed, kGreen, kBlue, Next(index + 3));
+                index = index + 4;
+            }
+            else
+            {
+                const auto kRed = Next(index);
+                const auto kGreen = Next(index + 1);
+                output.template SetPixel<kEncoder>(pixel_index, kRed, kGreen, Next(index + 2), kGlobalBrightness);
+                index = index + 3;
+            }
+        }
+    }
+
+    uint8_t Next(uint32_t index)
+    {
+        const uint32_t kSum = target_[index] + error_[index];
+        error_[index] = static_cast<uint8_t>(kSum);
+        const auto kValue = kSum >> 8;
+        return static_cast<uint8_t>(kValue > 0xFF ? 0xFF : kValue);
+    }
+
+   private:
+    const uint16_t* gamma_table_{gamma10_0_16};
+    uint32_t channels_{3};
+    pixel::output::Encoder encoder_{pixel::output::Encoder::kRtz};
+    uint8_t offsets_[4]{0, 1, 2, 3};
+    uint16_t target_[kMaxChannels];
+    uint8_t error_[kMaxChannels];
+};
+
+#endif  // PIXELDITHER_H_
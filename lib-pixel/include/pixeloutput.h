@@ -26,6 +26,11 @@
 #define PIXELOUTPUT_H_
 
 #include <cstdint>
+#include <cstring>
+#include <cassert>
+
+#include "pixeltype.h"
+#include "pixelconfiguration.h"
 
 #if defined(GD32)
 #include "gd32_spi.h"
@@ -33,6 +38,91 @@
 #include "h3_spi.h"
 #endif
 
+namespace pixel::output
+{
+/**
+ * The GD32 I2S transmits 16-bit frames MSB first, the DMA buffer is kept in that wire order:
+ * the two bytes of each halfword are swapped.
+ */
+#if defined(GD32)
+inline constexpr uint32_t kByteSwap = 1;
+#else
+inline constexpr uint32_t kByteSwap = 0;
+#endif
+/**
+ * RTZ frames start with one low halfword, so that each colour byte starts halfword aligned.
+ */
+inline constexpr uint32_t kRtzLeadingBytes = 2;
+
+enum class Encoder : uint8_t
+{
+    kRtz,
+    kRtzRgbw,
+    kWS2801,
+    kAPA102,
+    kP9813
+};
+
+inline constexpr Encoder GetEncoder(pixel::LedType type)
+{
+    switch (type)
+    {
+        case pixel::LedType::kSK6812W:
+            return Encoder::kRtzRgbw;
+        case pixel::LedType::kWS2801:
+            return Encoder::kWS2801;
+        case pixel::LedType::kAPA102:
+        case pixel::LedType::kSK9822:
+            return Encoder::kAPA102;
+        case pixel::LedType::kP9813:
+            return Encoder::kP9813;
+        default:
+            return Encoder::kRtz;
+    }
+}
+
+inline constexpr uint32_t GetPixelSize(Encoder encoder)
+{
+    return (encoder == Encoder::kRtz) ? 24U : (encoder == Encoder::kRtzRgbw) ? 32U : (encoder == Encoder::kWS2801) ? 3U : 4U;
+}
+
+inline constexpr uint32_t GetPixelOffset(Encoder encoder)
+{
+    return ((encoder == Encoder::kRtz) || (encoder == Encoder::kRtzRgbw)) ? kRtzLeadingBytes : (encoder == Encoder::kWS2801) ? 0U : 4U;
+}
+
+template <Encoder kEncoder> inline constexpr uint32_t kPixelSize = GetPixelSize(kEncoder);
+
+template <Encoder kEncoder> inline constexpr uint32_t kPixelOffset = GetPixelOffset(kEncoder);
+
+/**
+ * Each entry holds the 4 RTZ code bytes of a nibble, MSB first in wire order.
+ */
+inline void SetupRtzTable(uint8_t low_code, uint8_t high_code, uint32_t (&table)[16])
+{
+    for (uint32_t nibble = 0; nibble < 16; nibble++)
+    {
+        uint8_t codes[4];
+
+        for (uint32_t bit = 0; bit < 4; bit++)
+        {
+            codes[bit ^ kByteSwap] = ((nibble & (0x8U >> bit)) != 0) ? high_code : low_code;
+        }
+
+        memcpy(&table[nibble], codes, sizeof(codes));
+    }
+}
+
+/**
+ * Stores the 8 RTZ code bytes of a colour byte, out must be halfword aligned in the DMA buffer.
+ */
+inline void EncodeRtz(const uint32_t (&table)[16], uint8_t value, uint8_t* out)
+{
+    memcpy(out, &table[value >> 4], sizeof(uint32_t));
+    memcpy(out + 4, &table[value & 0x0F], sizeof(uint32_t));
+}
+} // namespace pixel::output
+
 class PixelOutput
 {
    public:
@@ -44,6 +134,111 @@ class PixelOutput
     void SetPixel(uint32_t index, uint8_t red, uint8_t green, uint8_t blue);
     void SetPixel(uint32_t index, uint8_t red, uint8_t green, uint8_t blue, uint8_t white);
 
+    /**
+     * Sets count pixels, stride apart, to the same colour: the first pixel is encoded, the others are copies.
+     */
+    void SetPixels(uint32_t index, uint32_t count, uint32_t stride, uint8_t red, uint8_t green, uint8_t blue);
+    void SetPixels(uint32_t index, uint32_t count, uint32_t stride, uint8_t red, uint8_t green, uint8_t blue, uint8_t white);
+
+    /**
+     * Encoder specialised versions, without configuration lookups and without gamma correction.
+     * The global brightness is only used by APA102, the callers read it once per frame.
+     */
+    template <pixel::output::Encoder kEncoder> void SetPixel(uint32_t index, uint8_t red, uint8_t green, uint8_t blue, [[maybe_unused]] uint8_t global_brightness)
+    {
+        static_assert(kEncoder != pixel::output::Encoder::kRtzRgbw);
+
+        Touch(index);
+
+        if constexpr (kEncoder == pixel::output::Encoder::kRtz)
+        {
+            const auto kOffset = index * 24U;
+
+            SetColorWS28xx(kOffset, red);
+            SetColorWS28xx(kOffset + 8, green);
+            SetColorWS28xx(kOffset + 16, blue);
+        }
+        else if constexpr (kEncoder == pixel::output::Encoder::kWS2801)
+        {
+            const auto kOffset = index * 3U;
+            assert(kOffset + 2U < buf_size_);
+
+            SetByte(kOffset, red);
+            SetByte(kOffset + 1, green);
+            SetByte(kOffset + 2, blue);
+        }
+        else if constexpr (kEncoder == pixel::output::Encoder::kAPA102)
+        {
+            const auto kOffset = 4U + (index * 4U);
+            assert(kOffset + 3U < buf_size_);
+
+            SetByte(kOffset, global_brightness);
+            SetByte(kOffset + 1, red);
+            SetByte(kOffset + 2, green);
+            SetByte(kOffset + 3, blue);
+        }
+        else
+        {
+            const auto kOffset = 4U + (index * 4U);
+            assert(kOffset + 3U < buf_size_);
+
+            const auto kFlag = static_cast<uint8_t>(0xC0 | ((~blue & 0xC0) >> 2) | ((~green & 0xC0) >> 4) | ((~red & 0xC0) >> 6));
+
+            SetByte(kOffset, kFlag);
+            SetByte(kOffset + 1, blue);
+            SetByte(kOffset + 2, green);
+            SetByte(kOffset + 3, red);
+        }
+    }
+
+    void SetPixelRgbw(uint32_t index, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
+    {
+        Touch(index);
+
+        const auto kOffset = index * 32U;
+
+        SetColorWS28xx(kOffset, green);
+        SetColorWS28xx(kOffset + 8, red);
+        SetColorWS28xx(kOffset + 16, blue);
+        SetColorWS28xx(kOffset + 24, white);
+    }
+
+    /**
+     * Copies the encoded pixel, used for grouping.
+     */
+    template <pixel::output::Encoder kEncoder> void CopyPixel(uint32_t from, uint32_t to)
+    {
+        constexpr auto kSize = pixel::output::kPixelSize<kEncoder>;
+        constexpr auto kOffset = pixel::output::kPixelOffset<kEncoder>;
+
+        Touch(to);
+
+        if constexpr ((kSize & 1) == 0)
+        {
+            // Even sized pixels at even offsets are not affected by the byte swap
+            assert(kOffset + (to + 1) * kSize <= buf_size_);
+            memcpy(&buffer_[kOffset + to * kSize], &buffer_[kOffset + from * kSize], kSize);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < kSize; i++)
+            {
+                SetByte(kOffset + to * kSize + i, buffer_[(kOffset + from * kSize + i) ^ pixel::output::kByteSwap]);
+            }
+        }
+    }
+
+    template <pixel::output::Encoder kEncoder> void CopyPixels(uint32_t from, uint32_t count, uint32_t stride)
+    {
+        auto to = from;
+
+        for (uint32_t i = 1; i < count; i++)
+        {
+            to += stride;
+            CopyPixel<kEncoder>(from, to);
+        }
+    }
+
     bool IsUpdating()
     {
 #if defined(GD32)
@@ -68,12 +263,71 @@ class PixelOutput
 
    private:
     void SetupBuffers();
-    void SetColorWS28xx(uint32_t offset, uint8_t value);
+    void SetupRtzTable();
+    void CatchUp();
+    void CopyFromBackBuffer(uint32_t begin, uint32_t end);
+
+    /**
+     * Keeps the written pixels a range. A write that leaves a gap catches up first, as the pixels in the gap may be stale.
+     */
+    void Touch(uint32_t index)
+    {
+        if ((index >= written_begin_) && (index < written_end_))
+        {
+            return;
+        }
+
+        if (written_begin_ >= written_end_)
+        {
+            written_begin_ = index;
+            written_end_ = index + 1;
+            return;
+        }
+
+        if (index == written_end_)
+        {
+            written_end_ = index + 1;
+            return;
+        }
+
+        if (index + 1 == written_begin_)
+        {
+            written_begin_ = index;
+            return;
+        }
+
+        CatchUp();
+
+        if (index < written_begin_)
+        {
+            written_begin_ = index;
+        }
+        else
+        {
+            written_end_ = index + 1;
+        }
+    }
+
+    void SetColorWS28xx(uint32_t offset, uint8_t value)
+    {
+        assert(buffer_ != nullptr);
+        assert(offset + pixel::output::kRtzLeadingBytes + 8 <= buf_size_);
+
+        pixel::output::EncodeRtz(rtz_table_, value, &buffer_[offset + pixel::output::kRtzLeadingBytes]);
+    }
+
+    void SetByte(uint32_t index, uint8_t value) { buffer_[index ^ pixel::output::kByteSwap] = value; }
 
    private:
     uint32_t buf_size_;
-    uint8_t* buffer_{nullptr};
-    uint8_t* blackout_buffer_{nullptr};
+    uint8_t* buffer_{nullptr};           ///< The half the encoders write into
+    uint8_t* back_buffer_{nullptr};      ///< The half that is transmitted, see Update()
+    uint32_t written_begin_{UINT32_MAX}; ///< The pixels written since the last Update()
+    uint32_t written_end_{0};
+    uint32_t stale_begin_{0};            ///< The pixels of which the render half is a frame behind
+    uint32_t stale_end_{0};
+    uint32_t rtz_table_[16];
+    pixel::output::Encoder encoder_{pixel::output::Encoder::kRtz};
 
     static inline PixelOutput* s_this;
 };
@@ -0,0 +1,219 @@
+/**
+ * @file pixeloutputmulti.h
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PIXELOUTPUTMULTI_H_
+#define PIXELOUTPUTMULTI_H_
+
+#include <cstdint>
+#include <cassert>
+
+#include "pixeltype.h"
+#include "pixelconfiguration.h"
+
+#if !defined(CONFIG_DMXNODE_PIXEL_MAX_PORTS)
+#define CONFIG_DMXNODE_PIXEL_MAX_PORTS 8U
+#endif
+
+namespace pixel::output::multi
+{
+inline constexpr uint32_t kMaxPorts = CONFIG_DMXNODE_PIXEL_MAX_PORTS;
+static_assert((kMaxPorts == 8) || (kMaxPorts == 16), "The ports are the low 8 or 16 pins of one GPIO port");
+
+/**
+ * Bytes per port, the default is one universe: 170 RGB or 128 RGBW pixels.
+ * The port data and the bit planes take kMaxPorts * kMaxPortBytes * (1 + sizeof(Plane)) bytes of RAM.
+ */
+#if defined(CONFIG_PIXEL_MULTI_MAX_PORT_BYTES)
+inline constexpr uint32_t kMaxPortBytes = CONFIG_PIXEL_MULTI_MAX_PORT_BYTES;
+#else
+inline constexpr uint32_t kMaxPortBytes = 512;
+#endif
+
+/**
+ * One bit-plane entry per bit slot, bit n drives port n
+ */
+#if (CONFIG_DMXNODE_PIXEL_MAX_PORTS == 8)
+using Plane = uint8_t;
+#else
+using Plane = uint16_t;
+#endif
+
+inline constexpr uint32_t kMaxPlanes = kMaxPortBytes * 8;
+
+/**
+ * Transposes one byte of 8 ports into 8 bit slots.
+ * out[0] holds the MSB's (they are sent first), bit n of out[i] is bit (7 - i) of in[n].
+ * Hacker's Delight, 7-3 transpose8.
+ */
+inline void Transpose8(const uint8_t* in, uint32_t stride, uint8_t* out)
+{
+    auto x = (static_cast<uint32_t>(in[7 * stride]) << 24) | (static_cast<uint32_t>(in[6 * stride]) << 16) | (static_cast<uint32_t>(in[5 * stride]) << 8) |
+             in[4 * stride];
+    auto y = (static_cast<uint32_t>(in[3 * stride]) << 24) | (static_cast<uint32_t>(in[2 * stride]) << 16) | (static_cast<uint32_t>(in[1 * stride]) << 8) |
+             in[0];
+
+    auto t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    out[0] = static_cast<uint8_t>(x >> 24);
+    out[1] = static_cast<uint8_t>(x >> 16);
+    out[2] = static_cast<uint8_t>(x >> 8);
+    out[3] = static_cast<uint8_t>(x);
+    out[4] = static_cast<uint8_t>(y >> 24);
+    out[5] = static_cast<uint8_t>(y >> 16);
+    out[6] = static_cast<uint8_t>(y >> 8);
+    out[7] = static_cast<uint8_t>(y);
+}
+
+/**
+ * Builds the bit planes for bytes [0, length) of all ports.
+ * The planes hold the ports that must go low at T0H, that is the inverted data bits.
+ */
+inline void Transpose(const uint8_t (*data)[kMaxPortBytes], uint32_t length, Plane mask, Plane* planes)
+{
+    for (uint32_t index = 0; index < length; index++)
+    {
+        uint8_t low[8];
+        Transpose8(&data[0][index], kMaxPortBytes, low);
+#if (CONFIG_DMXNODE_PIXEL_MAX_PORTS == 16)
+        uint8_t high[8];
+        Transpose8(&data[8][index], kMaxPortBytes, high);
+#endif
+        for (uint32_t bit = 0; bit < 8; bit++)
+        {
+#if (CONFIG_DMXNODE_PIXEL_MAX_PORTS == 16)
+            const auto kBits = static_cast<Plane>((high[bit] << 8) | low[bit]);
+#else
+            const auto kBits = low[bit];
+#endif
+            *planes++ = static_cast<Plane>(~kBits & mask);
+        }
+    }
+}
+} // namespace pixel::output::multi
+
+/**
+ * Parallel RTZ output: up to 16 ports on the low pins of one GPIO port.
+ * A timer drives three DMA channels per bit slot: set all ports, clear the ports sending a 0 at T0H, clear all ports at T1H.
+ */
+class PixelOutputMulti
+{
+   public:
+    PixelOutputMulti();
+    ~PixelOutputMulti();
+
+    void ApplyConfiguration();
+
+    void SetOutputPorts(uint32_t output_ports);
+
+    uint32_t GetOutputPorts() const { return output_ports_; }
+
+    void SetColourRTZ(uint32_t port_index, uint32_t pixel_index, uint8_t red, uint8_t green, uint8_t blue)
+    {
+        assert(port_index < pixel::output::multi::kMaxPorts);
+        const auto kOffset = pixel_index * 3U;
+        assert(kOffset + 2U < pixel::output::multi::kMaxPortBytes);
+
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+        const auto* gamma_table = PixelConfiguration::Get().GetGammaTable();
+
+        red = gamma_table[red];
+        green = gamma_table[green];
+        blue = gamma_table[blue];
+#endif
+
+        auto* data = &data_[port_index][kOffset];
+
+        data[0] = red;
+        data[1] = green;
+        data[2] = blue;
+    }
+
+    void SetColourRTZ(uint32_t port_index, uint32_t pixel_index, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
+    {
+        assert(port_index < pixel::output::multi::kMaxPorts);
+        const auto kOffset = pixel_index * 4U;
+        assert(kOffset + 3U < pixel::output::multi::kMaxPortBytes);
+
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+        const auto* gamma_table = PixelConfiguration::Get().GetGammaTable();
+
+        red = gamma_table[red];
+        green = gamma_table[green];
+        blue = gamma_table[blue];
+        white = gamma_table[white];
+#endif
+
+        auto* data = &data_[port_index][kOffset];
+
+        data[0] = green;
+        data[1] = red;
+        data[2] = blue;
+        data[3] = white;
+    }
+
+    bool IsUpdating();
+
+    void Update();
+    void Blackout();
+    void FullOn();
+
+    /**
+     * @return The frames per second sent, for the status JSON
+     */
+    uint32_t GetUserData();
+
+    static PixelOutputMulti* Get() { return s_this; }
+
+   private:
+    void Start(uint32_t planes);
+
+   private:
+    uint32_t output_ports_{pixel::output::multi::kMaxPorts};
+    uint32_t port_bytes_{0};
+    pixel::output::multi::Plane mask_{0};
+    bool is_active_{false};
+    uint32_t end_micros_{0};
+    uint32_t frames_{0};
+    uint32_t frames_millis_{0};
+    uint32_t frame_rate_{0};
+    uint8_t data_[pixel::output::multi::kMaxPorts][pixel::output::multi::kMaxPortBytes];
+
+    static inline PixelOutputMulti* s_this;
+};
+
+using PixelOutputType = PixelOutputMulti;
+
+#endif  // PIXELOUTPUTMULTI_H_
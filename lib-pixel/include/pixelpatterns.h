@@ -64,6 +64,29 @@ inline constexpr char kPatternName[static_cast<uint32_t>(pixelpatterns::Pattern:
 };
 
 enum class Direction { kForward, kReverse };
+
+/**
+ * The colour wheel, red - green - blue - back to red, one entry per position.
+ */
+struct WheelTable {
+    constexpr WheelTable() : colour() {
+        for (uint32_t i = 0; i < 256; i++) {
+            const auto kPosition = 255U - i;
+
+            if (kPosition < 85U) {
+                colour[i] = pixel::GetColour(static_cast<uint8_t>(255U - kPosition * 3), 0, static_cast<uint8_t>(kPosition * 3));
+            } else if (kPosition < 170U) {
+                colour[i] = pixel::GetColour(0, static_cast<uint8_t>((kPosition - 85U) * 3), static_cast<uint8_t>(255U - (kPosition - 85U) * 3));
+            } else {
+                colour[i] = pixel::GetColour(static_cast<uint8_t>((kPosition - 170U) * 3), static_cast<uint8_t>(255U - (kPosition - 170U) * 3), 0);
+            }
+        }
+    }
+
+    uint32_t colour[256];
+};
+
+inline constexpr WheelTable kWheel;
 } // namespace pixelpatterns
 
 class PixelPatterns {
@@ -164,13 +187,37 @@ class PixelPatterns {
     }
 
    private:
+    /**
+     * Pixel i shows wheel position (i * 256 / count) + index. The position is stepped with a
+     * remainder accumulator, and each run of pixels with the same position is filled at once.
+     */
     void RainbowCycleUpdate(uint32_t port_index) {
         const auto kIndex = s_port_config[port_index].pixel_index;
+        const auto kCount = PixelConfiguration::Get().GetCount();
+
+        uint32_t first = 0;
+        uint32_t position = 0;
+        uint32_t remainder = 0;
+
+        for (uint32_t i = 1; i < kCount; i++) {
+            remainder += 256U;
+
+            if (remainder < kCount) {
+                continue;
+            }
+
+            pixel::FillPixelColour(port_index, first, i - first, pixelpatterns::kWheel.colour[(position + kIndex) & 0xFF]);
 
-        for (uint32_t i = 0; i < PixelConfiguration::Get().GetCount(); i++) {
-            pixel::SetPixelColour(port_index, i, Wheel(((i * 256U / PixelConfiguration::Get().GetCount()) + kIndex) & 0xFF));
+            do {
+                remainder -= kCount;
+                position++;
+            } while (remainder >= kCount);
+
+            first = i;
         }
 
+        pixel::FillPixelColour(port_index, first, kCount - first, pixelpatterns::kWheel.colour[(position + kIndex) & 0xFF]);
+
         Increment(port_index);
     }
 
@@ -178,13 +225,15 @@ class PixelPatterns {
         const auto kColour1 = s_port_config[port_index].colour1;
         const auto kColour2 = s_port_config[port_index].colour2;
         const auto kPixelIndex = s_port_config[port_index].pixel_index;
+        const auto kCount = PixelConfiguration::Get().GetCount();
 
-        for (uint32_t i = 0; i < PixelConfiguration::Get().GetCount(); i++) {
-            if ((i + kPixelIndex) % 3 == 0) {
-                pixel::SetPixelColour(port_index, i, kColour1);
-            } else {
-                pixel::SetPixelColour(port_index, i, kColour2);
-            }
+        pixel::FillPixelColour(port_index, 0, kCount, kColour2);
+
+        // Every third pixel, starting at the first i for which (i + pixel_index) % 3 == 0
+        const auto kFirst = (3U - (kPixelIndex % 3U)) % 3U;
+
+        if (kFirst < kCount) {
+            pixel::FillPixelColour(port_index, kFirst, (kCount - kFirst + 2U) / 3U, kColour1, 3);
         }
 
         Increment(port_index);
@@ -247,20 +296,6 @@ class PixelPatterns {
         return true;
     }
 
-    uint32_t Wheel(uint8_t wheel_position) {
-        wheel_position = static_cast<uint8_t>(255U - wheel_position);
-
-        if (wheel_position < 85) {
-            return pixel::GetColour(static_cast<uint8_t>(255U - wheel_position * 3), 0, static_cast<uint8_t>(wheel_position * 3));
-        } else if (wheel_position < 170U) {
-            wheel_position = static_cast<uint8_t>(wheel_position - 85U);
-            return pixel::GetColour(0, static_cast<uint8_t>(wheel_position * 3), static_cast<uint8_t>(255U - wheel_position * 3));
-        } else {
-            wheel_position = static_cast<uint8_t>(wheel_position - 170U);
-            return pixel::GetColour(static_cast<uint8_t>(wheel_position * 3), static_cast<uint8_t>(255U - wheel_position * 3), 0);
-        }
-    }
-
     void Increment(uint32_t port_index) {
         if (s_port_config[port_index].direction == pixelpatterns::Direction::kForward) {
             s_port_config[port_index].pixel_index++;
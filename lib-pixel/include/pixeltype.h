@@ -84,6 +84,14 @@ inline constexpr char kMaps[static_cast<uint32_t>(pixel::LedMap::kUndefined)][5]
 constexpr uint32_t kMapsCount = static_cast<uint32_t>(sizeof(kMaps) / sizeof(kMaps[0]));
 static_assert(kMapsCount == static_cast<uint32_t>(pixel::LedMap::kUndefined), "LedMap must match kMaps");
 
+/**
+ * Offset of red (0), green (1) and blue (2) in the DMX data, for the 3 channel maps.
+ */
+inline constexpr uint32_t GetMapOffset(LedMap map, uint32_t colour) {
+    constexpr uint8_t kOffsets[][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {2, 0, 1}, {1, 2, 0}, {2, 1, 0}};
+    return kOffsets[static_cast<uint32_t>(map)][colour];
+}
+
 enum class ProtocolType : uint8_t {
     kRtz,
     kSpi,
@@ -108,8 +116,8 @@ struct TypeInfo {
     constexpr bool IsSpi() const { return protocol_type == ProtocolType::kSpi; }
 };
 
-static_assert(sizeof(TypeInfo) == 20, "TypeInfo must remain compact");
-static_assert(alignof(TypeInfo) == 4, "Unexpected TypeInfo alignment");
+static_assert(sizeof(TypeInfo) == sizeof(const char*) + 16, "TypeInfo must remain compact"); // 20 bytes on Cortex-M
+static_assert(alignof(TypeInfo) == alignof(const char*), "Unexpected TypeInfo alignment");
 
 constexpr TypeInfo MakeSpiTypeInfo(const char* name, LedCount led_count, uint32_t default_hz, uint32_t max_hz)
 {
@@ -0,0 +1,369 @@
+/**
+ * @file pixeloutputmulti.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined(DEBUG_PIXELDMX)
+#undef NDEBUG
+#endif
+
+#include "gd32.h"
+
+/**
+ * The board selects the GPIO port, the ports are its low 8 or 16 pins.
+ * Without it the library is built without the parallel output.
+ */
+#if defined(OUTPUT_DMX_PIXEL_MULTI) && (!defined(PIXEL_MULTI_GPIOx) || !defined(PIXEL_MULTI_RCU_GPIOx))
+#error The board must define PIXEL_MULTI_GPIOx and PIXEL_MULTI_RCU_GPIOx
+#endif
+
+#if defined(PIXEL_MULTI_GPIOx)
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+#include <algorithm>
+
+#include "pixeloutputmulti.h"
+#include "pixelconfiguration.h"
+#include "timing.h"
+#include "firmware/debug/debug_debug.h"
+
+#if defined(GD32F4XX) || defined(GD32H7XX)
+#error The parallel pixel output is not supported for this MCU family
+#endif
+
+/**
+ * Only gd32f30x_mcu.h defines the TIMER7 DMA requests.
+ * The GD32F10x and GD32F20x have the same mapping.
+ */
+#if !defined(TIMER7_DMAx)
+#if defined(GD32F10X) || defined(GD32F20X)
+#define TIMER7_RCU_DMAx		RCU_DMA1
+#define TIMER7_DMAx			DMA1
+#define TIMER7_CH0_DMA_CHx	DMA_CH2
+#define TIMER7_CH1_DMA_CHx	DMA_CH4
+#define TIMER7_CH2_DMA_CHx	DMA_CH0
+#else
+#error The TIMER7 DMA channels are not defined for this MCU
+#endif
+#endif
+
+#if defined(DMX_USE_UART3)
+#error UART3 and the parallel pixel output share DMA1 channels
+#endif
+
+#if defined(CONFIG_TIME_USE_TIMER) && !defined(CONFIG_NET_ENABLE_PTP)
+#error CONFIG_TIME_USE_TIMER and the parallel pixel output both use TIMER7
+#endif
+
+#if defined(CONFIG_USE_SOFTUART0)
+#error The software UART0 and the parallel pixel output both use TIMER7
+#endif
+
+namespace pixel::output::multi
+{
+/**
+ * TIMER7 compare events request DMA1 channels:
+ * CH0 sets all ports at the start of a bit slot, CH1 clears the 0 bits at T0H, CH2 clears all ports at T1H.
+ */
+static constexpr auto kDmaSet = TIMER7_CH0_DMA_CHx;
+static constexpr auto kDmaData = TIMER7_CH1_DMA_CHx;
+static constexpr auto kDmaClear = TIMER7_CH2_DMA_CHx;
+
+static constexpr uint32_t kTimerClock = APB2_CLOCK_FREQ;
+static constexpr uint32_t kBitTicks = kTimerClock / 800000U; // 1.25 us
+static constexpr uint32_t kResetMicros = 300;
+
+#if (CONFIG_DMXNODE_PIXEL_MAX_PORTS == 8)
+static constexpr uint32_t kDmaMemoryWidth = DMA_MEMORY_WIDTH_8BIT;
+#else
+static constexpr uint32_t kDmaMemoryWidth = DMA_MEMORY_WIDTH_16BIT;
+#endif
+
+static Plane s_planes[kMaxPlanes] __attribute__((aligned(4)));
+static Plane s_set;
+static Plane s_clear;
+} // namespace pixel::output::multi
+
+using namespace pixel::output::multi;
+
+static void DmaConfig(dma_channel_enum channel, uint32_t periph_addr, bool is_memory_inc)
+{
+    dma_deinit(TIMER7_DMAx, channel);
+
+    dma_parameter_struct dma_init_struct;
+    dma_struct_para_init(&dma_init_struct);
+
+    dma_init_struct.direction = DMA_MEMORY_TO_PERIPHERAL;
+    dma_init_struct.memory_inc = is_memory_inc ? DMA_MEMORY_INCREASE_ENABLE : DMA_MEMORY_INCREASE_DISABLE;
+    dma_init_struct.memory_width = kDmaMemoryWidth;
+    // The plane is zero extended, only the low half of BOP is written
+    dma_init_struct.periph_addr = periph_addr;
+    dma_init_struct.periph_inc = DMA_PERIPH_INCREASE_DISABLE;
+    dma_init_struct.periph_width = DMA_PERIPHERAL_WIDTH_32BIT;
+    dma_init_struct.priority = DMA_PRIORITY_ULTRA_HIGH;
+    dma_init(TIMER7_DMAx, channel, &dma_init_struct);
+
+    dma_circulation_disable(TIMER7_DMAx, channel);
+    dma_memory_to_memory_disable(TIMER7_DMAx, channel);
+
+    DMA_CHCNT(TIMER7_DMAx, channel) = 0;
+}
+
+static void DmaStart(dma_channel_enum channel, const Plane* memory, uint32_t count)
+{
+    auto dma_ch_ctl = DMA_CHCTL(TIMER7_DMAx, channel);
+    dma_ch_ctl &= ~DMA_CHXCTL_CHEN;
+    DMA_CHCTL(TIMER7_DMAx, channel) = dma_ch_ctl;
+    DMA_CHMADDR(TIMER7_DMAx, channel) = reinterpret_cast<uint32_t>(memory);
+    DMA_CHCNT(TIMER7_DMAx, channel) = count;
+    dma_ch_ctl |= DMA_CHXCTL_CHEN;
+    DMA_CHCTL(TIMER7_DMAx, channel) = dma_ch_ctl;
+}
+
+static void TimerConfig(uint32_t low_ticks, uint32_t high_ticks)
+{
+    timer_deinit(TIMER7);
+
+    timer_parameter_struct timer_initpara;
+    timer_struct_para_init(&timer_initpara);
+
+    timer_initpara.prescaler = 0;
+    timer_initpara.period = kBitTicks - 1;
+    timer_init(TIMER7, &timer_initpara);
+
+    timer_oc_parameter_struct timer_ocinitpara;
+    timer_channel_output_struct_para_init(&timer_ocinitpara);
+
+    const uint16_t kChannels[] = {TIMER_CH_0, TIMER_CH_1, TIMER_CH_2};
+    const uint32_t kPulses[] = {1, 1 + low_ticks, 1 + high_ticks};
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        timer_channel_output_config(TIMER7, kChannels[i], &timer_ocinitpara);
+        timer_channel_output_mode_config(TIMER7, kChannels[i], TIMER_OC_MODE_TIMING);
+        timer_channel_output_pulse_value_config(TIMER7, kChannels[i], kPulses[i]);
+    }
+
+    timer_dma_enable(TIMER7, TIMER_DMA_CH0D | TIMER_DMA_CH1D | TIMER_DMA_CH2D);
+}
+
+PixelOutputMulti::PixelOutputMulti()
+{
+    DEBUG_ENTRY();
+
+    assert(s_this == nullptr);
+    s_this = this;
+
+    rcu_periph_clock_enable(PIXEL_MULTI_RCU_GPIOx);
+    rcu_periph_clock_enable(TIMER7_RCU_DMAx);
+    rcu_periph_clock_enable(RCU_TIMER7);
+
+    constexpr auto kPins = static_cast<uint32_t>((1U << kMaxPorts) - 1);
+
+    GPIO_BC(PIXEL_MULTI_GPIOx) = kPins;
+    gpio_init(PIXEL_MULTI_GPIOx, GPIO_MODE_OUT_PP, GPIO_OSPEED_50MHZ, kPins);
+
+    DmaConfig(kDmaSet, reinterpret_cast<uint32_t>(&GPIO_BOP(PIXEL_MULTI_GPIOx)), false);
+    DmaConfig(kDmaData, reinterpret_cast<uint32_t>(&GPIO_BC(PIXEL_MULTI_GPIOx)), true);
+    DmaConfig(kDmaClear, reinterpret_cast<uint32_t>(&GPIO_BC(PIXEL_MULTI_GPIOx)), false);
+
+    memset(data_, 0, sizeof(data_));
+
+    ApplyConfiguration();
+
+    DEBUG_EXIT();
+}
+
+PixelOutputMulti::~PixelOutputMulti()
+{
+    timer_disable(TIMER7);
+    s_this = nullptr;
+}
+
+void PixelOutputMulti::ApplyConfiguration()
+{
+    DEBUG_ENTRY();
+
+    auto& pixel_configuration = PixelConfiguration::Get();
+
+    pixel_configuration.Validate();
+
+    // The ports have no clock line
+    if (!pixel_configuration.IsRTZProtocol())
+    {
+        pixel_configuration.SetType(pixel::LedType::kWS2812B);
+        pixel_configuration.Validate();
+    }
+
+    // The pixels that do not fit are not sent
+    const auto kLedsPerPixel = pixel_configuration.GetLedsPerPixel();
+    port_bytes_ = std::min(pixel_configuration.GetCount() * kLedsPerPixel, (kMaxPortBytes / kLedsPerPixel) * kLedsPerPixel);
+
+    // T0H and T1H are in 1/8 of a bit slot
+    const auto kLowTicks = (static_cast<uint32_t>(__builtin_popcount(pixel_configuration.GetLowCode())) * kBitTicks) / 8U;
+    const auto kHighTicks = (static_cast<uint32_t>(__builtin_popcount(pixel_configuration.GetHighCode())) * kBitTicks) / 8U;
+
+    DEBUG_PRINTF("port_bytes_=%u, kBitTicks=%u, kLowTicks=%u, kHighTicks=%u", port_bytes_, kBitTicks, kLowTicks, kHighTicks);
+
+    while (IsUpdating())
+    {
+        // wait for completion
+    }
+
+    TimerConfig(kLowTicks, kHighTicks);
+
+    SetOutputPorts(output_ports_);
+
+    DEBUG_EXIT();
+}
+
+void PixelOutputMulti::SetOutputPorts(uint32_t output_ports)
+{
+    output_ports_ = (output_ports == 0 || output_ports > kMaxPorts) ? kMaxPorts : output_ports;
+    mask_ = static_cast<Plane>((1U << output_ports_) - 1);
+
+    s_set = mask_;
+    s_clear = mask_;
+}
+
+bool PixelOutputMulti::IsUpdating()
+{
+    if (DMA_CHCNT(TIMER7_DMAx, kDmaClear) != 0)
+    {
+        return true;
+    }
+
+    if (is_active_)
+    {
+        is_active_ = false;
+        timer_disable(TIMER7);
+        end_micros_ = timing::Micros();
+    }
+
+    // The strips latch after the reset time
+    return (timing::Micros() - end_micros_) < kResetMicros;
+}
+
+void PixelOutputMulti::Start(uint32_t planes)
+{
+    assert(planes <= kMaxPlanes);
+
+    timer_disable(TIMER7);
+    TIMER_CNT(TIMER7) = 0;
+
+    DmaStart(kDmaSet, &s_set, planes);
+    DmaStart(kDmaData, s_planes, planes);
+    DmaStart(kDmaClear, &s_clear, planes);
+
+    is_active_ = true;
+
+    timer_enable(TIMER7);
+}
+
+/**
+ * The port data is transposed when the frame is sent, the ports can be written while the previous frame is sent.
+ */
+void PixelOutputMulti::Update()
+{
+    assert(!IsUpdating());
+
+    Transpose(data_, port_bytes_, mask_, s_planes);
+    Start(port_bytes_ * 8U);
+
+    frames_++;
+}
+
+/**
+ * The frame rate is measured over at least one second.
+ */
+uint32_t PixelOutputMulti::GetUserData()
+{
+    const auto kMillis = timing::Millis();
+    const auto kElapsed = kMillis - frames_millis_;
+
+    if (kElapsed >= 1000U)
+    {
+        frame_rate_ = (frames_ * 1000U) / kElapsed;
+        frames_ = 0;
+        frames_millis_ = kMillis;
+    }
+
+    return frame_rate_;
+}
+
+void PixelOutputMulti::Blackout()
+{
+    DEBUG_ENTRY();
+
+    while (IsUpdating())
+    {
+        // wait for completion
+    }
+
+    // Clear all ports at T0H, the port data is kept
+    const auto kPlanes = port_bytes_ * 8U;
+
+    for (uint32_t i = 0; i < kPlanes; i++)
+    {
+        s_planes[i] = mask_;
+    }
+
+    Start(kPlanes);
+
+    while (IsUpdating())
+    {
+        // A blackout may not be interrupted.
+    }
+
+    DEBUG_EXIT();
+}
+
+void PixelOutputMulti::FullOn()
+{
+    DEBUG_ENTRY();
+
+    while (IsUpdating())
+    {
+        // wait for completion
+    }
+
+    const auto kPlanes = port_bytes_ * 8U;
+
+    for (uint32_t i = 0; i < kPlanes; i++)
+    {
+        s_planes[i] = 0;
+    }
+
+    Start(kPlanes);
+
+    while (IsUpdating())
+    {
+        // May not be interrupted.
+    }
+
+    DEBUG_EXIT();
+}
+
+#endif // PIXEL_MULTI_GPIOx
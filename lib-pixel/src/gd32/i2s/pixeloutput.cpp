@@ -53,7 +53,7 @@ PixelOutput::PixelOutput()
 
 PixelOutput::~PixelOutput()
 {
-    blackout_buffer_ = nullptr;
+    back_buffer_ = nullptr;
     buffer_ = nullptr;
     s_this = nullptr;
 }
@@ -66,6 +66,8 @@ void PixelOutput::ApplyConfiguration()
 
     pixel_configuration.Validate();
 
+    encoder_ = pixel::output::GetEncoder(pixel_configuration.GetType());
+
     if (!pixel_configuration.RefreshNeeded())
     {
         DEBUG_EXIT();
@@ -79,7 +81,7 @@ void PixelOutput::ApplyConfiguration()
     if (pixel_configuration.IsRTZProtocol())
     {
         buf_size_ *= 8;
-        buf_size_ += 1;
+        buf_size_ += pixel::output::kRtzLeadingBytes;
     }
 
     const auto kType = pixel_configuration.GetType();
@@ -92,6 +94,11 @@ void PixelOutput::ApplyConfiguration()
 
     SetupBuffers();
 
+    if (pixel_configuration.IsRTZProtocol())
+    {
+        SetupRtzTable();
+    }
+
     i2s::Gd32SpiDmaSetSpeedHz(pixel_configuration.GetClockSpeedHz());
 
     DEBUG_EXIT();
@@ -109,35 +116,110 @@ void PixelOutput::SetupBuffers()
     const auto kSizeHalf = size / 2;
     assert(buf_size_ <= kSizeHalf);
 
-    blackout_buffer_ = buffer_ + (kSizeHalf & static_cast<uint32_t>(~3));
+    back_buffer_ = buffer_ + (kSizeHalf & static_cast<uint32_t>(~3));
 
-    DEBUG_PRINTF("buf_size_=%u, buffer_=%p, blackout_buffer_=%p", buf_size_, buffer_, blackout_buffer_);
+    DEBUG_PRINTF("buf_size_=%u, buffer_=%p, back_buffer_=%p", buf_size_, buffer_, back_buffer_);
 
     s_tmp = buf_size_;
     buf_size_ = (buf_size_ + 3) & static_cast<uint32_t>(~3);
 
     DEBUG_PRINTF("buf_size_=%u -> %d", buf_size_, buf_size_ - s_tmp);
+
+    // The encoders never write the leading bytes, the start and end frames and the padding
+    memset(buffer_, 0, buf_size_);
+    memset(back_buffer_, 0, buf_size_);
+
+    written_begin_ = UINT32_MAX;
+    written_end_ = 0;
+    stale_begin_ = 0;
+    stale_end_ = 0;
+
     DEBUG_EXIT();
 }
 
-void PixelOutput::Update()
+/**
+ * Copies the pixels [begin, end) from the back half into the render half.
+ */
+void PixelOutput::CopyFromBackBuffer(uint32_t begin, uint32_t end)
 {
-    assert(!IsUpdating());
+    if (begin >= end)
+    {
+        return;
+    }
 
-    for (auto i = s_tmp; i < buf_size_; i++)
+    const auto kSize = pixel::output::GetPixelSize(encoder_);
+    const auto kOffset = pixel::output::GetPixelOffset(encoder_);
+
+    auto first = kOffset + begin * kSize;
+    auto last = kOffset + end * kSize;
+    assert(last <= buf_size_);
+
+    // The WS2801 pixels are 3 bytes, a byte at an odd boundary shares the halfword with its neighbour
+    if ((first & 1) != 0)
+    {
+        buffer_[first ^ pixel::output::kByteSwap] = back_buffer_[first ^ pixel::output::kByteSwap];
+        first++;
+    }
+
+    if (((last & 1) != 0) && (first < last))
+    {
+        last--;
+        buffer_[last ^ pixel::output::kByteSwap] = back_buffer_[last ^ pixel::output::kByteSwap];
+    }
+
+    memcpy(&buffer_[first], &back_buffer_[first], last - first);
+}
+
+/**
+ * Brings the render half up to date with the frame sent last:
+ * the stale pixels are copied from the back half, except the ones written since.
+ */
+void PixelOutput::CatchUp()
+{
+    if (stale_begin_ >= stale_end_)
     {
-        buffer_[i] = 0x00;
+        return;
     }
 
-    const auto* src = reinterpret_cast<uint16_t*>(buffer_);
-    auto* dst = reinterpret_cast<uint16_t*>(blackout_buffer_);
+    auto written_begin = written_begin_;
+    auto written_end = written_end_;
 
-    for (uint32_t i = 0; i < buf_size_ / 2; i++)
+    if (written_begin >= written_end)
     {
-        dst[i] = __builtin_bswap16(src[i]);
+        written_begin = stale_end_;
+        written_end = stale_end_;
     }
 
-    i2s::Gd32SpiDmaTxStart(blackout_buffer_, buf_size_);
+    CopyFromBackBuffer(stale_begin_, written_begin < stale_end_ ? written_begin : stale_end_);
+    CopyFromBackBuffer(written_end > stale_begin_ ? written_end : stale_begin_, stale_end_);
+
+    stale_begin_ = 0;
+    stale_end_ = 0;
+}
+
+/**
+ * The encoders write in wire order, the render half is transmitted as is and the halves are swapped.
+ * The new render half is a frame behind in the pixels written for the frame now sent. A render can update
+ * a part of the pixels only, the pixels it does not write are copied at the next Update().
+ * A render of all pixels copies nothing.
+ */
+void PixelOutput::Update()
+{
+    assert(!IsUpdating());
+
+    CatchUp();
+
+    i2s::Gd32SpiDmaTxStart(buffer_, buf_size_);
+
+    auto* buffer = back_buffer_;
+    back_buffer_ = buffer_;
+    buffer_ = buffer;
+
+    stale_begin_ = written_begin_;
+    stale_end_ = written_end_;
+
+    written_begin_ = UINT32_MAX;
+    written_end_ = 0;
 }
 
 void PixelOutput::Blackout()
@@ -150,8 +232,14 @@ void PixelOutput::Blackout()
         __ISB();
     } while (i2s::Gd32SpiDmaTxIsActive());
 
+    // The frame in the render half is kept, the back half is sent
+    CatchUp();
+
+    const auto kWrittenBegin = written_begin_;
+    const auto kWrittenEnd = written_end_;
+
     auto* buffer = buffer_;
-    buffer_ = blackout_buffer_;
+    buffer_ = back_buffer_;
 
     auto& pixel_configuration = PixelConfiguration::Get();
 
@@ -176,13 +264,17 @@ void PixelOutput::Blackout()
             memset(&buffer_[buf_size_ - 4], 0, 4);
         }
     }
+    else if (pixel_configuration.IsRTZProtocol())
+    {
+        memset(&buffer_[pixel::output::kRtzLeadingBytes], pixel_configuration.GetLowCode(), s_tmp - pixel::output::kRtzLeadingBytes);
+    }
     else
     {
-        buffer_[0] = 0x00;
-        memset(&buffer_[1], kType == pixel::LedType::kWS2801 ? 0 : pixel_configuration.GetLowCode(), buf_size_);
+        // The padding is zero as well
+        memset(buffer_, 0, buf_size_);
     }
 
-    Update();
+    i2s::Gd32SpiDmaTxStart(buffer_, buf_size_);
 
     // A blackout may not be interrupted.
     do
@@ -192,6 +284,12 @@ void PixelOutput::Blackout()
 
     buffer_ = buffer;
 
+    // The back half is the frame in the render half again
+    memcpy(back_buffer_, buffer_, buf_size_);
+
+    written_begin_ = kWrittenBegin;
+    written_end_ = kWrittenEnd;
+
     DEBUG_EXIT();
 }
 
@@ -205,8 +303,14 @@ void PixelOutput::FullOn()
         __ISB();
     } while (i2s::Gd32SpiDmaTxIsActive());
 
+    // The frame in the render half is kept, the back half is sent
+    CatchUp();
+
+    const auto kWrittenBegin = written_begin_;
+    const auto kWrittenEnd = written_end_;
+
     auto* buffer = buffer_;
-    buffer_ = blackout_buffer_;
+    buffer_ = back_buffer_;
 
     auto& pixel_configuration = PixelConfiguration::Get();
 
@@ -231,13 +335,20 @@ void PixelOutput::FullOn()
             memset(&buffer_[buf_size_ - 4], 0, 4);
         }
     }
+    else if (pixel_configuration.IsRTZProtocol())
+    {
+        memset(&buffer_[pixel::output::kRtzLeadingBytes], pixel_configuration.GetHighCode(), s_tmp - pixel::output::kRtzLeadingBytes);
+    }
     else
     {
-        buffer_[0] = 0x00;
-        memset(&buffer_[1], kType == pixel::LedType::kWS2801 ? 0xFF : pixel_configuration.GetHighCode(), buf_size_);
+        // The WS2801 pixels are 3 bytes, the frame can end halfway a halfword
+        for (uint32_t i = 0; i < s_tmp; i++)
+        {
+            SetByte(i, 0xFF);
+        }
     }
 
-    Update();
+    i2s::Gd32SpiDmaTxStart(buffer_, buf_size_);
 
     // May not be interrupted.
     do
@@ -247,5 +358,11 @@ void PixelOutput::FullOn()
 
     buffer_ = buffer;
 
+    // The back half is the frame in the render half again
+    memcpy(back_buffer_, buffer_, buf_size_);
+
+    written_begin_ = kWrittenBegin;
+    written_end_ = kWrittenEnd;
+
     DEBUG_EXIT();
 }
@@ -42,121 +42,117 @@
 #include "gamma/gamma_tables.h"
 #endif
 
-void PixelOutput::SetColorWS28xx(uint32_t offset, uint8_t value)
+/**
+ * Must be called whenever the low/high code changes.
+ */
+void PixelOutput::SetupRtzTable()
 {
     auto& pixel_configuration = PixelConfiguration::Get();
-    assert(pixel_configuration.GetType() != pixel::LedType::kWS2801);
-    assert(buffer_ != nullptr);
-    assert(offset + 7 < buf_size_);
-
-    offset += 1;
 
-    const auto kLowCode = pixel_configuration.GetLowCode();
-    const auto kHighCode = pixel_configuration.GetHighCode();
-
-    for (uint8_t mask = 0x80; mask != 0; mask = static_cast<uint8_t>(mask >> 1))
-    {
-        if (value & mask)
-        {
-            buffer_[offset] = kHighCode;
-        }
-        else
-        {
-            buffer_[offset] = kLowCode;
-        }
-        offset++;
-    }
+    pixel::output::SetupRtzTable(pixel_configuration.GetLowCode(), pixel_configuration.GetHighCode(), rtz_table_);
 }
 
 void PixelOutput::SetPixel(uint32_t pixel_index, uint8_t red, uint8_t green, uint8_t blue)
 {
-    auto& pixel_configuration = PixelConfiguration::Get();
-    assert(pixel_index < pixel_configuration.GetCount());
+    assert(pixel_index < PixelConfiguration::Get().GetCount());
 
 #if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
-    const auto* gamma_table = pixel_configuration.GetGammaTable();
+    const auto* gamma_table = PixelConfiguration::Get().GetGammaTable();
 
     red = gamma_table[red];
     green = gamma_table[green];
     blue = gamma_table[blue];
 #endif
 
-    if (pixel_configuration.IsRTZProtocol())
+    switch (encoder_)
     {
-        const auto kOffset = pixel_index * 24U;
-
-        SetColorWS28xx(kOffset, red);
-        SetColorWS28xx(kOffset + 8, green);
-        SetColorWS28xx(kOffset + 16, blue);
-        return;
+        case pixel::output::Encoder::kRtz:
+            SetPixel<pixel::output::Encoder::kRtz>(pixel_index, red, green, blue, 0);
+            break;
+        case pixel::output::Encoder::kWS2801:
+            SetPixel<pixel::output::Encoder::kWS2801>(pixel_index, red, green, blue, 0);
+            break;
+        case pixel::output::Encoder::kAPA102:
+            SetPixel<pixel::output::Encoder::kAPA102>(pixel_index, red, green, blue, PixelConfiguration::Get().GetGlobalBrightness());
+            break;
+        case pixel::output::Encoder::kP9813:
+            SetPixel<pixel::output::Encoder::kP9813>(pixel_index, red, green, blue, 0);
+            break;
+        case pixel::output::Encoder::kRtzRgbw:
+            SetPixelRgbw(pixel_index, red, green, blue, 0x00);
+            break;
+        default:
+            assert(0);
+            __builtin_unreachable();
+            break;
     }
+}
 
-    assert(buffer_ != nullptr);
+void PixelOutput::SetPixel(uint32_t pixel_index, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
+{
+    assert(pixel_index < PixelConfiguration::Get().GetCount());
+    assert(encoder_ == pixel::output::Encoder::kRtzRgbw);
 
-    const auto kType = pixel_configuration.GetType();
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+    const auto* gamma_table = PixelConfiguration::Get().GetGammaTable();
 
-    if (kType == pixel::LedType::kWS2801)
-    {
-        const auto kOffset = pixel_index * 3U;
-        assert(kOffset + 2U < buf_size_);
+    red = gamma_table[red];
+    green = gamma_table[green];
+    blue = gamma_table[blue];
+    white = gamma_table[white];
+#endif
 
-        buffer_[kOffset] = red;
-        buffer_[kOffset + 1] = green;
-        buffer_[kOffset + 2] = blue;
+    SetPixelRgbw(pixel_index, red, green, blue, white);
+}
 
-        return;
-    }
+void PixelOutput::SetPixels(uint32_t pixel_index, uint32_t count, uint32_t stride, uint8_t red, uint8_t green, uint8_t blue)
+{
+    assert(stride != 0);
 
-    if ((kType == pixel::LedType::kAPA102) || (kType == pixel::LedType::kSK9822))
+    if (count == 0)
     {
-        const auto kOffset = 4U + (pixel_index * 4U);
-        assert(kOffset + 3U < buf_size_);
-
-        buffer_[kOffset] = pixel_configuration.GetGlobalBrightness();
-        buffer_[kOffset + 1] = red;
-        buffer_[kOffset + 2] = green;
-        buffer_[kOffset + 3] = blue;
-
         return;
     }
 
-    if (kType == pixel::LedType::kP9813)
-    {
-        const auto kOffset = 4U + (pixel_index * 4U);
-        assert(kOffset + 3 < buf_size_);
-
-        const auto kFlag = static_cast<uint8_t>(0xC0 | ((~blue & 0xC0) >> 2) | ((~green & 0xC0) >> 4) | ((~red & 0xC0) >> 6));
+    assert(pixel_index + (count - 1) * stride < PixelConfiguration::Get().GetCount());
 
-        buffer_[kOffset] = kFlag;
-        buffer_[kOffset + 1] = blue;
-        buffer_[kOffset + 2] = green;
-        buffer_[kOffset + 3] = red;
+    SetPixel(pixel_index, red, green, blue);
 
-        return;
+    switch (encoder_)
+    {
+        case pixel::output::Encoder::kRtz:
+            CopyPixels<pixel::output::Encoder::kRtz>(pixel_index, count, stride);
+            break;
+        case pixel::output::Encoder::kWS2801:
+            CopyPixels<pixel::output::Encoder::kWS2801>(pixel_index, count, stride);
+            break;
+        case pixel::output::Encoder::kAPA102:
+            CopyPixels<pixel::output::Encoder::kAPA102>(pixel_index, count, stride);
+            break;
+        case pixel::output::Encoder::kP9813:
+            CopyPixels<pixel::output::Encoder::kP9813>(pixel_index, count, stride);
+            break;
+        case pixel::output::Encoder::kRtzRgbw:
+            CopyPixels<pixel::output::Encoder::kRtzRgbw>(pixel_index, count, stride);
+            break;
+        default:
+            assert(0);
+            __builtin_unreachable();
+            break;
     }
-
-    assert(0);
-    __builtin_unreachable();
 }
 
-void PixelOutput::SetPixel(uint32_t pixel_index, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
+void PixelOutput::SetPixels(uint32_t pixel_index, uint32_t count, uint32_t stride, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
 {
-    assert(pixel_index < PixelConfiguration::Get().GetCount());
-    assert(PixelConfiguration::Get().GetType() == pixel::LedType::kSK6812W);
+    assert(stride != 0);
 
-#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
-    const auto* gamma_table = PixelConfiguration::Get().GetGammaTable();
-
-    red = gamma_table[red];
-    green = gamma_table[green];
-    blue = gamma_table[blue];
-    white = gamma_table[white];
-#endif
+    if (count == 0)
+    {
+        return;
+    }
 
-    const auto kOffset = pixel_index * 32U;
+    assert(pixel_index + (count - 1) * stride < PixelConfiguration::Get().GetCount());
 
-    SetColorWS28xx(kOffset, green);
-    SetColorWS28xx(kOffset + 8, red);
-    SetColorWS28xx(kOffset + 16, blue);
-    SetColorWS28xx(kOffset + 24, white);
+    SetPixel(pixel_index, red, green, blue, white);
+    CopyPixels<pixel::output::Encoder::kRtzRgbw>(pixel_index, count, stride);
 }
@@ -39,10 +39,14 @@
 #endif
 
 #include <cstdint>
+#include <cstring>
 #include <algorithm>
 #include <cassert>
 
 #include "pixeloutput.h"
+#if defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
+#include "pixeldither.h"
+#endif
 #include "pixeldmxconfiguration.h"
 #include "pixeldmxstore.h"
 #if defined(PIXELDMXSTARTSTOP_GPIO)
@@ -132,11 +136,15 @@ class PixelDmx final : public PixelDmxConfiguration {
         assert(data != nullptr);
         assert(length <= dmxnode::kUniverseSize);
 
+#if !defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
         if (output_type_.IsUpdating()) {
-            puts("output_type_.IsUpdating()");
+            QueueFrame(port_index, data, length, do_update);
             return;
         }
 
+        DropPendingFrame(port_index);
+#endif
+
         auto& port_info = PixelDmxConfiguration::GetPortInfo();
         uint32_t d = 0;
 
@@ -161,78 +169,19 @@ class PixelDmx final : public PixelDmxConfiguration {
 
         const auto kGroupingCount = PixelDmxConfiguration::GetGroupingCount();
 
-        if (kChannelsPerPixel == 3) {
-            switch (PixelDmxConfiguration::GetMap()) {
-                case pixel::LedMap::kRGB:
-                    for (uint32_t j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
-                        auto const kPixelIndexStart = (j * kGroupingCount);
-                        for (uint32_t k = 0; k < kGroupingCount; k++) {
-                            output_type_.SetPixel(kPixelIndexStart + k, data[d + 0], data[d + 1], data[d + 2]);
-                        }
-                        d = d + 3;
-                    }
-                    break;
-                case pixel::LedMap::kRBG:
-                    for (uint32_t j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
-                        auto const kPixelIndexStart = (j * kGroupingCount);
-                        for (uint32_t k = 0; k < kGroupingCount; k++) {
-                            output_type_.SetPixel(kPixelIndexStart + k, data[d + 0], data[d + 2], data[d + 1]);
-                        }
-                        d = d + 3;
-                    }
-                    break;
-                case pixel::LedMap::kGRB:
-                    for (uint32_t j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
-                        auto const kPixelIndexStart = (j * kGroupingCount);
-                        for (uint32_t k = 0; k < kGroupingCount; k++) {
-                            output_type_.SetPixel(kPixelIndexStart + k, data[d + 1], data[d + 0], data[d + 2]);
-                        }
-                        d = d + 3;
-                    }
-                    break;
-                case pixel::LedMap::kGBR:
-                    for (uint32_t j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
-                        auto const kPixelIndexStart = (j * kGroupingCount);
-                        for (uint32_t k = 0; k < kGroupingCount; k++) {
-                            output_type_.SetPixel(kPixelIndexStart + k, data[d + 2], data[d + 0], data[d + 1]);
-                        }
-                        d = d + 3;
-                    }
-                    break;
-                case pixel::LedMap::kBRG:
-                    for (uint32_t j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
-                        auto const kPixelIndexStart = (j * kGroupingCount);
-                        for (uint32_t k = 0; k < kGroupingCount; k++) {
-                            output_type_.SetPixel(kPixelIndexStart + k, data[d + 1], data[d + 2], data[d + 0]);
-                        }
-                        d = d + 3;
-                    }
-                    break;
-                case pixel::LedMap::kBGR:
-                    for (uint32_t j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
-                        auto const kPixelIndexStart = (j * kGroupingCount);
-                        for (uint32_t k = 0; k < kGroupingCount; k++) {
-                            output_type_.SetPixel(kPixelIndexStart + k, data[d + 2], data[d + 1], data[d + 0]);
-                        }
-                        d = d + 3;
-                    }
-                    break;
-                default:
-                    assert(0);
-                    __builtin_unreachable();
-                    break;
-            }
-        } else {
-            assert(kChannelsPerPixel == 4);
-            for (auto j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
-                auto const kPixelIndexStart = (j * kGroupingCount);
-                for (uint32_t k = 0; k < kGroupingCount; k++) {
-                    output_type_.SetPixel(kPixelIndexStart + k, data[d], data[d + 1], data[d + 2], data[d + 3]);
-                }
-                d = d + 4;
-            }
+        if (kernel_key_ != GetKernelKey()) {
+            SelectKernel();
         }
 
+#if defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
+        // Only the targets are updated, Run() sends the dithered frames
+        dither_.SetData(data, length, d, kBeginIndex, kEndIndex, kGroupingCount);
+        is_dithering_ = true;
+        return;
+#else
+        kernel_(output_type_, data, length, d, kBeginIndex, kEndIndex, kGroupingCount);
+#endif
+
 #if !defined(DMXNODE_PORTS)
         if (do_update) {
             if (__builtin_expect((blackout_), 0)) {
@@ -255,6 +204,51 @@ class PixelDmx final : public PixelDmxConfiguration {
 #endif
     }
 
+#if defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
+    /**
+     * Sends the next dithered frame as soon as the previous transfer has completed,
+     * the refresh rate is the maximum of the strip, not the DMX rate.
+     */
+    void Run() {
+        if (!is_dithering_ || blackout_ || output_type_.IsUpdating()) {
+            return;
+        }
+
+        dither_.Render(output_type_);
+        output_type_.Update();
+    }
+#else
+    /**
+     * Renders the frames that arrived while the output was updating, as soon as the transfer has completed.
+     */
+    void Run() {
+        if (!has_pending_frames_ || output_type_.IsUpdating()) {
+            return;
+        }
+
+        has_pending_frames_ = false;
+
+        for (uint32_t port_index = 0; port_index < dmxnode::kMaxPorts; port_index++) {
+            auto& frame = pending_frames_[port_index];
+
+            if (!frame.is_pending) {
+                continue;
+            }
+
+            frame.is_pending = false;
+#if defined(SETDATA)
+            if (frame.do_update) {
+                SetDataImpl<true>(port_index, frame.data, frame.length);
+            } else {
+                SetDataImpl<false>(port_index, frame.data, frame.length);
+            }
+#else
+            SetDataImpl(port_index, frame.data, frame.length, frame.do_update);
+#endif
+        }
+    }
+#endif
+
     void Sync([[maybe_unused]] uint32_t port_index) {}
 
     void Sync() { output_type_.Update(); }
@@ -279,6 +273,9 @@ class PixelDmx final : public PixelDmxConfiguration {
     }
 
     void FullOn() {
+#if defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
+        is_dithering_ = false;
+#endif
         while (output_type_.IsUpdating()) {
             // wait for completion
         }
@@ -352,9 +349,178 @@ class PixelDmx final : public PixelDmxConfiguration {
         return *s_this;
     }
 
+   private:
+    using SetPixelsKernel = void (*)(PixelOutputType& output, const uint8_t* data, uint32_t length, uint32_t d, uint32_t begin_index, uint32_t end_index, uint32_t grouping_count);
+
+    template <pixel::output::Encoder kEncoder, pixel::LedMap kMap, bool kGamma>
+    static void SetPixels(PixelOutputType& output, const uint8_t* data, uint32_t length, uint32_t d, uint32_t begin_index, uint32_t end_index, uint32_t grouping_count) {
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+        [[maybe_unused]] const auto* gamma_table = PixelConfiguration::Get().GetGammaTable();
+#endif
+        [[maybe_unused]] const auto kGlobalBrightness = PixelConfiguration::Get().GetGlobalBrightness();
+
+        for (auto j = begin_index; (j < end_index) && (d < length); j++) {
+            const auto kPixelIndexStart = j * grouping_count;
+
+            if constexpr (kEncoder == pixel::output::Encoder::kRtzRgbw) {
+                auto red = data[d];
+                auto green = data[d + 1];
+                auto blue = data[d + 2];
+                auto white = data[d + 3];
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+                if constexpr (kGamma) {
+                    red = gamma_table[red];
+                    green = gamma_table[green];
+                    blue = gamma_table[blue];
+                    white = gamma_table[white];
+                }
+#endif
+                output.SetPixelRgbw(kPixelIndexStart, red, green, blue, white);
+                d = d + 4;
+            } else {
+                auto red = data[d + pixel::GetMapOffset(kMap, 0)];
+                auto green = data[d + pixel::GetMapOffset(kMap, 1)];
+                auto blue = data[d + pixel::GetMapOffset(kMap, 2)];
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+                if constexpr (kGamma) {
+                    red = gamma_table[red];
+                    green = gamma_table[green];
+                    blue = gamma_table[blue];
+                }
+#endif
+                output.template SetPixel<kEncoder>(kPixelIndexStart, red, green, blue, kGlobalBrightness);
+                d = d + 3;
+            }
+
+            for (uint32_t k = 1; k < grouping_count; k++) {
+                output.template CopyPixel<kEncoder>(kPixelIndexStart, kPixelIndexStart + k);
+            }
+        }
+    }
+
+    template <pixel::output::Encoder kEncoder, bool kGamma> static SetPixelsKernel GetKernel(pixel::LedMap map) {
+        switch (map) {
+            case pixel::LedMap::kRBG:
+                return &SetPixels<kEncoder, pixel::LedMap::kRBG, kGamma>;
+            case pixel::LedMap::kGRB:
+                return &SetPixels<kEncoder, pixel::LedMap::kGRB, kGamma>;
+            case pixel::LedMap::kGBR:
+                return &SetPixels<kEncoder, pixel::LedMap::kGBR, kGamma>;
+            case pixel::LedMap::kBRG:
+                return &SetPixels<kEncoder, pixel::LedMap::kBRG, kGamma>;
+            case pixel::LedMap::kBGR:
+                return &SetPixels<kEncoder, pixel::LedMap::kBGR, kGamma>;
+            default:
+                return &SetPixels<kEncoder, pixel::LedMap::kRGB, kGamma>;
+        }
+    }
+
+    template <bool kGamma> static SetPixelsKernel GetKernel(pixel::output::Encoder encoder, pixel::LedMap map) {
+        switch (encoder) {
+            case pixel::output::Encoder::kRtzRgbw:
+                return &SetPixels<pixel::output::Encoder::kRtzRgbw, pixel::LedMap::kRGBW, kGamma>;
+            case pixel::output::Encoder::kWS2801:
+                return GetKernel<pixel::output::Encoder::kWS2801, kGamma>(map);
+            case pixel::output::Encoder::kAPA102:
+                return GetKernel<pixel::output::Encoder::kAPA102, kGamma>(map);
+            case pixel::output::Encoder::kP9813:
+                return GetKernel<pixel::output::Encoder::kP9813, kGamma>(map);
+            default:
+                return GetKernel<pixel::output::Encoder::kRtz, kGamma>(map);
+        }
+    }
+
+    uint32_t GetKernelKey() const {
+        auto key = static_cast<uint32_t>(PixelDmxConfiguration::GetType()) | (static_cast<uint32_t>(PixelDmxConfiguration::GetMap()) << 8);
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+        if (PixelDmxConfiguration::IsEnableGammaCorrection()) {
+            key |= (1U << 16) | (static_cast<uint32_t>(PixelDmxConfiguration::GetGammaTableValue()) << 24);
+        }
+#endif
+        return key;
+    }
+
+    /**
+     * Selects the kernel once per configuration, instead of branching on type, map and gamma for each pixel.
+     */
+    void SelectKernel() {
+        kernel_key_ = GetKernelKey();
+#if defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
+        dither_.ApplyConfiguration();
+#else
+        const auto kEncoder = pixel::output::GetEncoder(PixelDmxConfiguration::GetType());
+        const auto kMap = PixelDmxConfiguration::GetMap();
+
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+        if (PixelDmxConfiguration::IsEnableGammaCorrection()) {
+            kernel_ = GetKernel<true>(kEncoder, kMap);
+            return;
+        }
+#endif
+        kernel_ = GetKernel<false>(kEncoder, kMap);
+#endif
+    }
+
+#if !defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
+    /**
+     * Latest wins: a newer frame for the same port replaces the pending one.
+     */
+    void QueueFrame(uint32_t port_index, const uint8_t* data, uint32_t length, bool do_update) {
+        assert(port_index < dmxnode::kMaxPorts);
+
+        auto& frame = pending_frames_[port_index];
+
+        // Run() replays a pending frame from frame.data, it is queued again when the output is still updating
+        if (data != frame.data) {
+            memcpy(frame.data, data, length);
+        }
+        frame.length = length;
+        frame.do_update = frame.is_pending ? (frame.do_update || do_update) : do_update;
+        frame.is_pending = true;
+
+        has_pending_frames_ = true;
+    }
+
+    /**
+     * The frame rendered now is newer than the pending one, Run() must not render the older frame after it.
+     */
+    void DropPendingFrame(uint32_t port_index) {
+        assert(port_index < dmxnode::kMaxPorts);
+
+        if (!pending_frames_[port_index].is_pending) {
+            return;
+        }
+
+        pending_frames_[port_index].is_pending = false;
+
+        has_pending_frames_ = false;
+
+        for (const auto& frame : pending_frames_) {
+            has_pending_frames_ |= frame.is_pending;
+        }
+    }
+#endif
+
    private:
     PixelOutputType output_type_;
 
+    struct PendingFrame {
+        uint8_t data[dmxnode::kUniverseSize];
+        uint32_t length;
+        bool do_update;
+        bool is_pending;
+    };
+
+#if defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
+    PixelDither dither_;
+    bool is_dithering_{false};
+#else
+    PendingFrame pending_frames_[dmxnode::kMaxPorts]{};
+    SetPixelsKernel kernel_{nullptr};
+    bool has_pending_frames_{false};
+#endif
+    uint32_t kernel_key_{UINT32_MAX};
+
     bool started_{false};
     bool blackout_{false};
 
@@ -148,7 +148,7 @@ void PixelDmxParams::SetDmxStartAddress(const char* val, uint32_t len) {
 #if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
 void PixelDmxParams::SetGammaCorrection(const char* val, uint32_t len) {
     if (len == 1) {
-        store_dmxled.flags = common::SetFlagValue(store_dmxled.flags, Flags::Flag::kEnableGamma, v[0] != '0');
+        store_dmxled.flags = common::SetFlagValue(store_dmxled.flags, Flags::Flag::kEnableGamma, val[0] != '0');
     }
 }
 
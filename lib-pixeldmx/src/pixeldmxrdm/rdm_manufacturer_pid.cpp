@@ -73,7 +73,7 @@ constexpr char PixelCount::kDescription[];
 constexpr char PixelGroupingCount::kDescription[];
 constexpr char PixelMap::kDescription[];
 
-const rdmhandler::ParameterDescription RDMHandler::PARAMETER_DESCRIPTIONS[] = {
+constexpr rdmhandler::ParameterDescription RDMHandler::PARAMETER_DESCRIPTIONS[] = {
     {E120_MANUFACTURER_PIXEL_TYPE::kCode, rdmhandler::kDeviceDescriptionMaxLength, E120_DS_ASCII,
 #if defined(CONFIG_RDM_MANUFACTURER_PIDS_SET)
      E120_CC_GET_SET,
@@ -110,6 +110,11 @@ const rdmhandler::ParameterDescription RDMHandler::PARAMETER_DESCRIPTIONS[] = {
 
 uint32_t RDMHandler::GetParameterDescriptionCount() const
 {
+    static_assert(rdmhandler::IsPidTableSorted(RDMHandler::PARAMETER_DESCRIPTIONS,
+                                               [](const rdmhandler::ParameterDescription& description) { return __builtin_bswap16(description.pid); }),
+                  "PARAMETER_DESCRIPTIONS must be sorted on PID");
+    static_assert(sizeof(RDMHandler::PARAMETER_DESCRIPTIONS) / sizeof(RDMHandler::PARAMETER_DESCRIPTIONS[0]) <= rdmhandler::kManufacturerPidsMax,
+                  "PARAMETER_DESCRIPTIONS does not fit SUPPORTED_PARAMETERS");
     return sizeof(RDMHandler::PARAMETER_DESCRIPTIONS) / sizeof(RDMHandler::PARAMETER_DESCRIPTIONS[0]);
 }
 
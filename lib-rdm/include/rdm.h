@@ -32,6 +32,7 @@
 #include "dmx.h" // IWYU pragma: keep
 #include "e120.h"
 #include "rdmconst.h"
+#include "rdmchecksum.h"
 #include "timing.h"
 
 class Rdm {
@@ -48,17 +49,14 @@ class Rdm {
         assert(rdm_command != nullptr);
 
         auto* data = reinterpret_cast<uint8_t*>(rdm_command);
-        uint32_t i;
-        uint16_t checksum = 0;
 
         rdm_command->transaction_number = s_transaction_number[port_index];
 
-        for (i = 0; i < rdm_command->message_length; i++) {
-            checksum = static_cast<uint16_t>(checksum + data[i]);
-        }
+        uint32_t i = rdm_command->message_length;
+        const auto kChecksum = rdm::Checksum(data, i);
 
-        data[i++] = static_cast<uint8_t>(checksum >> 8);
-        data[i] = static_cast<uint8_t>(checksum & 0XFF);
+        data[i++] = static_cast<uint8_t>(kChecksum >> 8);
+        data[i] = static_cast<uint8_t>(kChecksum & 0XFF);
 
         TransmitRaw(port_index, reinterpret_cast<const uint8_t*>(rdm_command), rdm_command->message_length + rdm::kMessageChecksumSize);
 
@@ -80,7 +78,8 @@ class Rdm {
     static void TransmitDiscoveryRespondMessage(uint32_t port_index, const uint8_t* rdm_data, uint32_t length) { Dmx::Get()->RdmTransmitDiscoveryRespondMessage(port_index, rdm_data, length); }
 
     static const uint8_t* Receive(uint32_t port_index) { return Dmx::Get()->RdmReceive(port_index); }
-    static const uint8_t* ReceiveTimeOut(uint32_t port_index, uint16_t time_out) { return Dmx::Get()->RdmReceiveTimeOut(port_index, time_out); }
+    static void ReceiveStart(uint32_t port_index, uint16_t time_out) { Dmx::Get()->RdmReceiveStart(port_index, time_out); }
+    static dmx::RdmReceiveStatus ReceivePoll(uint32_t port_index, const uint8_t*& rdm_data) { return Dmx::Get()->RdmReceivePoll(port_index, rdm_data); }
 
    private:
     static uint8_t s_transaction_number[dmx::config::max::kPorts];
@@ -208,6 +208,17 @@
 #define E120_STATUS_ERROR_CLEARED                         0x14  /* Added in E1.20-2010 version                                  */
 
 
+/********************************************************/
+/* Appendix B: Status Message ID Definitions (subset)   */
+/********************************************************/
+#define E120_STS_CAL_FAIL                                 0x0001 /* Slot %d1 failed calibration                                 */
+#define E120_STS_SENS_NOT_FOUND                           0x0002 /* Sensor %d1 not found                                        */
+#define E120_STS_SENS_ALWAYS_ON                           0x0003 /* Sensor %d1 always on                                        */
+#define E120_STS_OVERTEMP                                 0x0021 /* Sensor %d1 Overtemp at %d2 degrees C                        */
+#define E120_STS_UNDERTEMP                                0x0022 /* Sensor %d1 Undertemp at %d2 degrees C                       */
+#define E120_STS_SENS_OUT_RANGE                           0x0023 /* Sensor %d1 out of range                                     */
+
+
 
 /********************************************************/
 /* Table A-5: Product Category Defines                  */
@@ -0,0 +1,85 @@
+/**
+ * @file rdmchecksum.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef RDMCHECKSUM_H_
+#define RDMCHECKSUM_H_
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#endif
+
+namespace rdm {
+/**
+ * E1.20 6.2.11 Checksum: the 16-bit sum of all bytes of the message, START Code included.
+ * @param checksum The checksum of the preceding bytes, for an incremental update when only the tail of a message changes.
+ */
+inline uint16_t Checksum(const uint8_t* data, uint32_t length, uint16_t checksum = 0) {
+    uint32_t sum = checksum;
+
+    while ((length != 0) && ((reinterpret_cast<uintptr_t>(data) & 3U) != 0)) {
+        sum += *data++;
+        length--;
+    }
+
+    auto words = length / 4;
+    length &= 3U;
+
+#if defined(__ARM_FEATURE_SIMD32)
+    while (words-- != 0) {
+        uint32_t word;
+        memcpy(&word, data, sizeof(uint32_t));
+        data += sizeof(uint32_t);
+        sum = __usada8(word, 0, sum);
+    }
+#else
+    while (words != 0) {
+        // Two 16-bit lanes, each lane adds at most 2 * 0xFF per word
+        const auto kBlock = (words < 128) ? words : 128;
+        uint32_t lanes = 0;
+
+        for (uint32_t i = 0; i < kBlock; i++) {
+            uint32_t word;
+            memcpy(&word, data, sizeof(uint32_t));
+            data += sizeof(uint32_t);
+            lanes += (word & 0x00FF00FF) + ((word >> 8) & 0x00FF00FF);
+        }
+
+        sum += (lanes & 0xFFFF) + (lanes >> 16);
+        words -= kBlock;
+    }
+#endif
+
+    while (length-- != 0) {
+        sum += *data++;
+    }
+
+    return static_cast<uint16_t>(sum);
+}
+} // namespace rdm
+
+#endif // RDMCHECKSUM_H_
@@ -46,6 +46,10 @@ namespace responder {
 inline constexpr uint32_t kPacketSpacing = 200;    ///< Min 176us, Max 2ms
 inline constexpr uint32_t kDataDirectionDelay = 4; ///<
 } // namespace responder
+namespace controller {
+/// 3.2.1 Controller Packet spacing, request to start of response
+inline constexpr uint32_t kResponseTimeOut = 2800;
+} // namespace controller
 
 inline constexpr uint16_t kRootDevice = 0;
 ///< 5 Device Addressing
@@ -37,6 +37,10 @@
 #include "rdmpersonality.h"
 #include "rdmsensors.h"
 #include "rdmsubdevices.h"
+#if defined(ENABLE_RDM_QUEUED_MSG)
+#include "rdmhandler.h"
+#include "rdm_e120.h"
+#endif
 #include "dmxnode.h"
 #include "dmxnode_outputtype.h"
 
@@ -179,6 +183,7 @@ class RDMDeviceResponder
 
         SetPersonalityCurrent(rdm::kRootDevice, kDefaultCurrentPersonality);
         SetDmxStartAddress(rdm::kRootDevice, dmx_start_address_factory_default_);
+        QueueDmxStartAddress();
 
         memcpy(&sub_device_info_, rdm_device.GetDeviceInfo(), sizeof(struct rdm::device::Info));
 
@@ -354,6 +359,7 @@ class RDMDeviceResponder
         {
             rdm_device.SetDmxFootprint(dmx_node_output_type->GetDmxFootprint());
             rdm_device.SetDmxStartAddress(dmx_node_output_type->GetDmxStartAddress());
+            QueueDmxStartAddress();
 
             PersonalityUpdate(dmx_node_output_type);
         }
@@ -384,6 +390,20 @@ class RDMDeviceResponder
         return checksum;
     }
 
+    /**
+     * The DMX start address changed as a side effect of another SET (personality, factory defaults),
+     * the controller is told through QUEUED_MESSAGE.
+     */
+    void QueueDmxStartAddress()
+    {
+#if defined(ENABLE_RDM_QUEUED_MSG)
+        const auto kDmxStartAddress = rdm::device::Device::Instance().GetDmxStartAddress();
+        const uint8_t kParamData[2] = {static_cast<uint8_t>(kDmxStartAddress >> 8), static_cast<uint8_t>(kDmxStartAddress)};
+
+        RDMHandler::Instance().QueueMessage(E120_DMX_START_ADDRESS, kParamData, sizeof(kParamData));
+#endif
+    }
+
    private:
     RDMSensors sensors_;
     RdmSubDevices sub_devices_;
@@ -28,6 +28,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <cassert>
 #if defined(CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
 #include <cstring>
 #endif
@@ -88,6 +89,128 @@ template <typename T, size_t N> struct Description
     static_assert(kSize <= kDeviceDescriptionMaxLength, "Description is too long");
     static constexpr char const* kValue = T::kDescription;
 };
+
+template <size_t N> struct PidIndex
+{
+    uint8_t index[N];
+};
+
+/**
+ * Builds, at compile time, an index into a PID table ordered on PID.
+ * The table itself keeps its SUPPORTED_PARAMETERS order; the index is used for a binary search.
+ */
+template <typename T, size_t N, typename Key> constexpr PidIndex<N> SortPidIndex(const T (&table)[N], Key key)
+{
+    static_assert(N <= UINT8_MAX, "PID table is too large for an 8-bit index");
+
+    PidIndex<N> sorted{};
+
+    for (size_t i = 0; i < N; i++)
+    {
+        auto j = i;
+
+        while ((j > 0) && (key(table[i]) < key(table[sorted.index[j - 1]])))
+        {
+            sorted.index[j] = sorted.index[j - 1];
+            j--;
+        }
+
+        sorted.index[j] = static_cast<uint8_t>(i);
+    }
+
+    return sorted;
+}
+
+template <typename T, size_t N, typename Key> constexpr bool IsPidIndexUnique(const T (&table)[N], const PidIndex<N>& sorted, Key key)
+{
+    for (size_t i = 1; i < N; i++)
+    {
+        if (key(table[sorted.index[i - 1]]) == key(table[sorted.index[i]]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * The table must be strictly ascending on PID, so that it can be binary searched directly.
+ */
+template <typename T, size_t N, typename Key> constexpr bool IsPidTableSorted(const T (&table)[N], Key key)
+{
+    for (size_t i = 1; i < N; i++)
+    {
+        if (!(key(table[i - 1]) < key(table[i])))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T, size_t N, typename Predicate> constexpr size_t CountPids(const T (&table)[N], Predicate predicate)
+{
+    size_t count = 0;
+
+    for (size_t i = 0; i < N; i++)
+    {
+        if (predicate(table[i]))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * The manufacturer PIDs that SUPPORTED_PARAMETERS reserves room for, next to the E1.20 PIDs.
+ * The PARAMETER_DESCRIPTIONS table is checked against it at compile time, so the reply never needs ACK_OVERFLOW.
+ */
+inline constexpr uint32_t kManufacturerPidsMax = 16;
+
+/**
+ * The SUPPORTED_PARAMETERS payload, built on the first request and then copied as is.
+ */
+struct SupportedParameters
+{
+    uint8_t param_data_length;
+    uint8_t param_data[231];
+    bool is_built;
+};
+
+/**
+ * The PIDs of table for which is_supported holds, in table order, followed by the manufacturer PIDs.
+ * The manufacturer PIDs are stored byte swapped, see ManufacturerPid.
+ */
+template <typename T, size_t N, typename Predicate, typename Key>
+void BuildSupportedParameters(const T (&table)[N], Predicate is_supported, Key key, const ParameterDescription* descriptions, uint32_t description_count,
+                              SupportedParameters& supported_parameters)
+{
+    assert(description_count <= kManufacturerPidsMax);
+    uint32_t j = 0;
+
+    for (size_t i = 0; i < N; i++)
+    {
+        if (is_supported(table[i]))
+        {
+            supported_parameters.param_data[j++] = static_cast<uint8_t>(key(table[i]) >> 8);
+            supported_parameters.param_data[j++] = static_cast<uint8_t>(key(table[i]));
+        }
+    }
+
+    for (uint32_t i = 0; i < description_count; i++)
+    {
+        supported_parameters.param_data[j++] = static_cast<uint8_t>(descriptions[i].pid);
+        supported_parameters.param_data[j++] = static_cast<uint8_t>(descriptions[i].pid >> 8);
+    }
+
+    assert(j <= sizeof(supported_parameters.param_data));
+    supported_parameters.param_data_length = static_cast<uint8_t>(j);
+    supported_parameters.is_built = true;
+}
 } // namespace rdmhandler
 
 class RDMHandler
@@ -107,6 +230,33 @@ class RDMHandler
 
     void HandleData(const uint8_t* data_in, uint8_t* data_out, Type type = Type::kTypeRdm);
 
+#if defined(RDM_RESPONDER)
+    /**
+     * The SUPPORTED_PARAMETERS reply is rebuilt on the next request.
+     */
+    void InvalidateSupportedParameters()
+    {
+        supported_parameters_[0].is_built = false;
+        supported_parameters_[1].is_built = false;
+    }
+#endif
+
+#if defined(ENABLE_RDM_QUEUED_MSG)
+    /**
+     * Queue a GET response for a parameter that changed locally (status, sensor threshold, DMX start address, ...).
+     * A pending message for the same PID is replaced.
+     * @return false when the queue is full.
+     */
+    bool QueueMessage(uint16_t param_id, const uint8_t* param_data, uint8_t param_data_length);
+
+    /**
+     * Queue a status message for GET STATUS_MESSAGES, see E1.20 Appendix B for the status message ids.
+     * A pending message with the same sub device, status message id and data value 1 is replaced.
+     * @return false when the queue is full.
+     */
+    bool QueueStatusMessage(uint16_t sub_device, uint8_t status_type, uint16_t status_message_id, int16_t data_value1, int16_t data_value2);
+#endif
+
    private:
     explicit RDMHandler();
     void CreateRespondMessage(uint8_t type, uint16_t reason);
@@ -118,6 +268,7 @@ class RDMHandler
     // Get
 #if defined(ENABLE_RDM_QUEUED_MSG)
     void GetQueuedMessage(uint16_t subdevice);
+    void GetStatusMessages(uint16_t subdevice);
 #endif
     void GetSupportedParameters(uint16_t subdevice);
 #if defined(CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
@@ -213,6 +364,9 @@ class RDMHandler
 #if defined(ENABLE_RDM_QUEUED_MSG)
     RDMQueuedMessage m_RDMQueuedMessage;
 #endif
+#if defined(RDM_RESPONDER)
+    rdmhandler::SupportedParameters supported_parameters_[2]{}; ///< [0] root device, [1] sub-devices
+#endif
 
     struct PidDefinition
     {
@@ -232,11 +386,45 @@ class RDMHandler
 
     static const PidDefinition PID_DEFINITIONS[];
     static const PidDefinition PID_DEFINITIONS_SUB_DEVICES[];
+    static const PidDefinition* FindPidDefinition(uint16_t pid);
 #if defined(CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
     static const PidDefinition PID_DEFINITION_MANUFACTURER_GENERAL;
     static const rdmhandler::ParameterDescription PARAMETER_DESCRIPTIONS[];
 
     uint32_t GetParameterDescriptionCount() const;
+    /**
+     * @param pid The manufacturer PID as stored in PARAMETER_DESCRIPTIONS (byte swapped).
+     * @return Index in PARAMETER_DESCRIPTIONS, or GetParameterDescriptionCount() when not found.
+     */
+    uint32_t FindParameterDescription(uint16_t pid) const
+    {
+        const auto kPid = __builtin_bswap16(pid);
+        uint32_t first = 0;
+        uint32_t last = GetParameterDescriptionCount();
+
+        while (first < last)
+        {
+            const auto kMiddle = (first + last) / 2;
+            const auto kMiddlePid = __builtin_bswap16(PARAMETER_DESCRIPTIONS[kMiddle].pid);
+
+            if (kMiddlePid == kPid)
+            {
+                return kMiddle;
+            }
+
+            if (kMiddlePid < kPid)
+            {
+                first = kMiddle + 1;
+            }
+            else
+            {
+                last = kMiddle;
+            }
+        }
+
+        return GetParameterDescriptionCount();
+    }
+
     void CopyParameterDescription(uint32_t nIndex, uint8_t* pParamData)
     {
         const auto kSize = sizeof(struct rdmhandler::ParameterDescription) - sizeof(const char*) - sizeof(const uint8_t);
@@ -38,26 +38,86 @@ struct TRdmQueuedMessage
     uint8_t param_data[231];   ///< 25,,,,	PD	6.2.3 Message Length
 };
 
+/**
+ * E1.20 STATUS_MESSAGES, one status message
+ */
+struct TRdmStatusMessage
+{
+    uint8_t sub_device[2];
+    uint8_t status_type;
+    uint8_t status_message_id[2];
+    uint8_t data_value1[2];
+    uint8_t data_value2[2];
+} __attribute__((packed));
+
+static_assert(sizeof(struct TRdmStatusMessage) == 9);
+
+namespace rdm::queuedmessage
+{
+inline constexpr uint32_t kCapacity = 8;
+static_assert((kCapacity & (kCapacity - 1)) == 0, "kCapacity must be a power of 2");
+inline constexpr uint32_t kStatusCapacity = 8;
+static_assert((kStatusCapacity & (kStatusCapacity - 1)) == 0, "kStatusCapacity must be a power of 2");
+static_assert(kStatusCapacity * sizeof(struct TRdmStatusMessage) <= sizeof(TRdmQueuedMessage::param_data), "The status messages must fit one response");
+} // namespace rdm::queuedmessage
+
+/**
+ * Fixed-capacity FIFO ring of responder generated messages.
+ * A message for a PID that is already queued replaces the pending one (coalescing),
+ * so a controller only sees the latest value and the queue does not fill up with stale changes.
+ * Add() and Handler() run in the main loop; the ring is not shared with interrupt handlers.
+ *
+ * Status messages have their own ring. While any are pending they count as one queued message,
+ * a STATUS_MESSAGES response, that GET QUEUED_MESSAGE sends after the queued PIDs.
+ * GET STATUS_MESSAGES takes them from the same ring, so the message count is the same for both PIDs.
+ */
 class RDMQueuedMessage
 {
    public:
-    RDMQueuedMessage();
-    ~RDMQueuedMessage();
+    uint8_t GetMessageCount() const { return static_cast<uint8_t>((head_ - tail_) + ((status_head_ != status_tail_) ? 1 : 0)); }
 
-    uint8_t GetMessageCount() const;
+    /**
+     * GET QUEUED_MESSAGE
+     * @param status_type The requested status type, E120_STATUS_GET_LAST_MESSAGE resends the previous message.
+     * @param rdm_data The response, command class, PID and parameter data are set.
+     */
+    void Handler(uint8_t status_type, uint8_t* rdm_data);
 
-    void Handler(uint8_t* rdm_data);
+    /**
+     * @return false when the queue is full and the PID is not already queued.
+     */
+    bool Add(const struct TRdmQueuedMessage* queued_message);
 
-    bool Add(const struct TRdmQueuedMessage* msg);
+    /**
+     * GET STATUS_MESSAGES
+     * @param status_type The requested status type, the messages of this severity and higher are sent and removed.
+     * E120_STATUS_GET_LAST_MESSAGE resends the previous status messages, E120_STATUS_NONE sends none.
+     * @param rdm_data The response, command class, PID and parameter data are set.
+     */
+    void StatusHandler(uint8_t status_type, uint8_t* rdm_data);
 
-   private:
-    void Copy(struct TRdmMessage* rdm_message, uint32_t index);
+    /**
+     * A pending message with the same sub device, status message id and data value 1 is replaced.
+     * @return false when the status ring is full.
+     */
+    bool AddStatus(const struct TRdmStatusMessage* status_message);
 
    private:
-    uint8_t message_count_{0};
-    bool is_never_queued_{true};
+    static void Copy(struct TRdmMessage* rdm_message, const struct TRdmQueuedMessage& queued_message);
+    static void Save(struct TRdmQueuedMessage* queued_message, const struct TRdmMessage* rdm_message);
+    static void SetStatusMessages(struct TRdmMessage* rdm_message);
+    void CopyStatusMessages(struct TRdmMessage* rdm_message, uint8_t status_type);
 
-    struct TRdmQueuedMessage* queued_message_;
+   private:
+    TRdmQueuedMessage queued_message_[rdm::queuedmessage::kCapacity];
+    TRdmQueuedMessage last_message_;
+    TRdmQueuedMessage last_status_messages_{};
+    TRdmStatusMessage status_message_[rdm::queuedmessage::kStatusCapacity];
+    uint32_t head_{0};
+    uint32_t tail_{0};
+    uint32_t status_head_{0};
+    uint32_t status_tail_{0};
+    bool has_last_message_{false};
 };
 
 #endif  // RDMQUEUEDMESSAGE_H_
@@ -58,6 +58,23 @@ struct Values {
     uint8_t sensor_requested;
 };
 
+inline constexpr uint32_t kValuesParamDataLength = 9;
+
+/**
+ * SENSOR_VALUE parameter data, shared by the GET response and the queued message.
+ */
+inline void ValuesToParamData(const Values& values, uint8_t* param_data) {
+    param_data[0] = values.sensor_requested;
+    param_data[1] = static_cast<uint8_t>(values.present >> 8);
+    param_data[2] = static_cast<uint8_t>(values.present);
+    param_data[3] = static_cast<uint8_t>(values.lowest_detected >> 8);
+    param_data[4] = static_cast<uint8_t>(values.lowest_detected);
+    param_data[5] = static_cast<uint8_t>(values.highest_detected >> 8);
+    param_data[6] = static_cast<uint8_t>(values.highest_detected);
+    param_data[7] = static_cast<uint8_t>(values.recorded >> 8);
+    param_data[8] = static_cast<uint8_t>(values.recorded);
+}
+
 inline constexpr int16_t RANGE_MIN = -32768;
 inline constexpr int16_t RANGE_MAX = +32767;
 inline constexpr int16_t NORMAL_MIN = -32768;
@@ -148,38 +165,52 @@ class RDMSensor {
 
     const struct rdm::sensor::Defintion* GetDefintion() { return &sensor_defintion_; }
 
-    const struct rdm::sensor::Values* GetValues() {
-        DEBUG_ENTRY();
-        const auto kValue = this->GetValue();
+    /**
+     * Reads the sensor and updates the cached values.
+     * Called from the superloop, see RDMSensors, so that the RDM GET path only reads RAM.
+     * @return true when the value has left, or returned to, the normal range.
+     */
+    bool Sample() {
+        Read();
 
-        sensor_values_.present = kValue;
-        sensor_values_.lowest_detected = std::min(sensor_values_.lowest_detected, kValue);
-        sensor_values_.highest_detected = std::max(sensor_values_.highest_detected, kValue);
+        const auto kValue = sensor_values_.present;
+        const auto kIsNormal = (kValue >= sensor_defintion_.normal_min) && (kValue <= sensor_defintion_.normal_max);
+        const auto kIsChanged = (kIsNormal != is_normal_);
+        is_normal_ = kIsNormal;
+
+        return kIsChanged;
+    }
+
+    bool IsNormal() const { return is_normal_; }
+
+    const struct rdm::sensor::Values* GetValues() {
+        if (!is_sampled_) [[unlikely]] {
+            Read();
+        }
 
-        DEBUG_EXIT();
         return &sensor_values_;
     }
 
     void SetValues() {
         DEBUG_ENTRY();
-        const auto kValue = this->GetValue();
+        if (!is_sampled_) [[unlikely]] {
+            Read();
+        }
 
-        sensor_values_.present = kValue;
-        sensor_values_.lowest_detected = kValue;
-        sensor_values_.highest_detected = kValue;
-        sensor_values_.recorded = kValue;
+        sensor_values_.lowest_detected = sensor_values_.present;
+        sensor_values_.highest_detected = sensor_values_.present;
+        sensor_values_.recorded = sensor_values_.present;
 
         DEBUG_EXIT();
     }
 
     void Record() {
         DEBUG_ENTRY();
-        const auto kValue = this->GetValue();
+        if (!is_sampled_) [[unlikely]] {
+            Read();
+        }
 
-        sensor_values_.present = kValue;
-        sensor_values_.recorded = kValue;
-        sensor_values_.lowest_detected = std::min(sensor_values_.lowest_detected, kValue);
-        sensor_values_.highest_detected = std::max(sensor_values_.highest_detected, kValue);
+        sensor_values_.recorded = sensor_values_.present;
 
         DEBUG_EXIT();
     }
@@ -188,9 +219,24 @@ class RDMSensor {
     virtual int16_t GetValue() = 0;
 
    private:
+    /**
+     * The normal range is only checked by Sample(), so that a GET before the first sample does not hide the transition.
+     */
+    void Read() {
+        const auto kValue = this->GetValue();
+
+        sensor_values_.present = kValue;
+        sensor_values_.lowest_detected = std::min(sensor_values_.lowest_detected, kValue);
+        sensor_values_.highest_detected = std::max(sensor_values_.highest_detected, kValue);
+
+        is_sampled_ = true;
+    }
+
     uint8_t sensor_;
     rdm::sensor::Defintion sensor_defintion_;
     rdm::sensor::Values sensor_values_;
+    bool is_sampled_{false};
+    bool is_normal_{true};
 };
 
 #endif // RDMSENSOR_H_
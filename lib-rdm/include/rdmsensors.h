@@ -31,6 +31,12 @@
 
 #include "configurationstore.h"
 #include "rdmsensor.h"
+#if defined(ENABLE_RDM_QUEUED_MSG)
+#include "rdmhandler.h"
+#include "rdmconst.h"
+#include "rdm_e120.h"
+#endif
+#include "softwaretimers.h"
 #include "firmware/debug/debug_debug.h"
 
 #if !defined(__APPLE__)
@@ -45,6 +51,18 @@
 #if defined(CONFIG_RDM_ENABLE_CPU_SENSOR)
 #include "sensor/cputemperature.h"
 #endif
+
+namespace rdm::sensors {
+/**
+ * One sensor is sampled per tick, round robin.
+ */
+inline constexpr uint32_t kSampleIntervalMillis =
+#if defined(CONFIG_RDM_SENSORS_SAMPLE_INTERVAL_MS)
+    CONFIG_RDM_SENSORS_SAMPLE_INTERVAL_MS;
+#else
+    100;
+#endif
+} // namespace rdm::sensors
 #if defined(CONFIG_RDM_ENABLE_SENSORS)
 #include "json/rdmsensorsparams.h"
 #endif
@@ -74,6 +92,10 @@ class RDMSensors {
 
     ~RDMSensors() {
         DEBUG_ENTRY();
+        if (timer_id_ != kTimerIdNone) {
+            SoftwareTimerDelete(timer_id_);
+        }
+
         for (uint32_t i = 0; i < count_; i++) {
             if (rdm_sensor_[i] != nullptr) {
                 delete rdm_sensor_[i];
@@ -101,6 +123,10 @@ class RDMSensors {
         assert(rdm_sensor != nullptr);
         rdm_sensor_[count_++] = rdm_sensor;
 
+        if (timer_id_ == kTimerIdNone) {
+            timer_id_ = SoftwareTimerAdd(rdm::sensors::kSampleIntervalMillis, SampleTimer);
+        }
+
         DEBUG_PRINTF("count_=%u", count_);
         DEBUG_EXIT();
         return true;
@@ -144,9 +170,43 @@ class RDMSensors {
 
     static RDMSensors* Get() { return s_this; }
 
+   private:
+    static void SampleTimer([[maybe_unused]] TimerHandle_t timer_handle) {
+        assert(s_this != nullptr);
+        s_this->SampleNext();
+    }
+
+    void SampleNext() {
+        if (count_ == 0) {
+            return;
+        }
+
+        if (sample_index_ >= count_) {
+            sample_index_ = 0;
+        }
+
+        auto* rdm_sensor = rdm_sensor_[sample_index_++];
+
+        if (rdm_sensor->Sample()) {
+#if defined(ENABLE_RDM_QUEUED_MSG)
+            // Leaving or returning to the normal range is reported to the controller
+            const auto* values = rdm_sensor->GetValues();
+            uint8_t param_data[rdm::sensor::kValuesParamDataLength];
+            rdm::sensor::ValuesToParamData(*values, param_data);
+
+            auto& rdm_handler = RDMHandler::Instance();
+            rdm_handler.QueueMessage(E120_SENSOR_VALUE, param_data, sizeof(param_data));
+            rdm_handler.QueueStatusMessage(rdm::kRootDevice, rdm_sensor->IsNormal() ? E120_STATUS_WARNING_CLEARED : E120_STATUS_WARNING, E120_STS_SENS_OUT_RANGE,
+                                           values->sensor_requested, 0);
+#endif
+        }
+    }
+
    private:
     RDMSensor** rdm_sensor_{nullptr};
+    TimerHandle_t timer_id_{kTimerIdNone};
     uint8_t count_{0};
+    uint8_t sample_index_{0};
 
     inline static RDMSensors* s_this;
 };
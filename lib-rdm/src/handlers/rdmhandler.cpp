@@ -34,6 +34,7 @@
 #include "rdmidentify.h"
 #include "rdmslotinfo.h"
 #include "rdmconst.h"
+#include "rdmchecksum.h"
 #include "rdm_message_print.h"
 #include "rdmconst.h"
 #include "e120.h"
@@ -63,7 +64,7 @@ enum class ResetMode : uint8_t {
     kCold = 0xFF ///< A cold reset is the equivalent of removing and reapplying power to the device.
 };
 
-const RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS[]{
+constexpr RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS[]{
     {E120_DEVICE_INFO, &RDMHandler::GetDeviceInfo, nullptr, 0, false, true, true},
     {E120_DEVICE_MODEL_DESCRIPTION, &RDMHandler::GetDeviceModelDescription, nullptr, 0, true, true, true},
     {E120_MANUFACTURER_LABEL, &RDMHandler::GetManufacturerLabel, nullptr, 0, true, true, true},
@@ -73,7 +74,8 @@ const RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS[]{
     {E120_RESET_DEVICE, nullptr, &RDMHandler::SetResetDevice, 0, true, true, true},
 #if defined(RDM_RESPONDER)
 #if defined(ENABLE_RDM_QUEUED_MSG)
-    {E120_QUEUED_MESSAGE, &RDMHandler::GetQueuedMessage, nullptr, 1, true, false},
+    {E120_QUEUED_MESSAGE, &RDMHandler::GetQueuedMessage, nullptr, 1, true, true, false},
+    {E120_STATUS_MESSAGES, &RDMHandler::GetStatusMessages, nullptr, 1, true, true, false},
 #endif
     {E120_SUPPORTED_PARAMETERS, &RDMHandler::GetSupportedParameters, nullptr, 0, false, true, false},
 #if defined(CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
@@ -126,7 +128,7 @@ const RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS[]{
 #endif
 };
 
-const RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS_SUB_DEVICES[]{
+constexpr RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS_SUB_DEVICES[]{
     {E120_DEVICE_INFO, &RDMHandler::GetDeviceInfo, nullptr, 0, true, true, false},
     {E120_SOFTWARE_VERSION_LABEL, &RDMHandler::GetSoftwareVersionLabel, nullptr, 0, true, true, false},
     {E120_IDENTIFY_DEVICE, &RDMHandler::GetIdentifyDevice, &RDMHandler::SetIdentifyDevice, 0, true, true, false},
@@ -139,6 +141,38 @@ const RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS_SUB_DEVICES[]{
 #endif
 };
 
+const RDMHandler::PidDefinition* RDMHandler::FindPidDefinition(uint16_t pid)
+{
+    static constexpr auto kKey = [](const PidDefinition& definition) { return definition.nPid; };
+    static constexpr auto kIndex = rdmhandler::SortPidIndex(PID_DEFINITIONS, kKey);
+    static_assert(rdmhandler::IsPidIndexUnique(PID_DEFINITIONS, kIndex, kKey), "Duplicate PID in PID_DEFINITIONS");
+
+    uint32_t first = 0;
+    uint32_t last = sizeof(kIndex.index);
+
+    while (first < last)
+    {
+        const auto kMiddle = (first + last) / 2;
+        const auto& definition = PID_DEFINITIONS[kIndex.index[kMiddle]];
+
+        if (definition.nPid == pid)
+        {
+            return &definition;
+        }
+
+        if (definition.nPid < pid)
+        {
+            first = kMiddle + 1;
+        }
+        else
+        {
+            last = kMiddle;
+        }
+    }
+
+    return nullptr;
+}
+
 #if defined(CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
 #if defined(CONFIG_RDM_MANUFACTURER_PIDS_SET)
 const RDMHandler::PidDefinition RDMHandler::PID_DEFINITION_MANUFACTURER_GENERAL{
@@ -185,12 +219,24 @@ void RDMHandler::CreateRespondMessage(uint8_t type, uint16_t reason)
     out->start_code = E120_SC_RDM;
     out->sub_start_code = in->sub_start_code;
     out->transaction_number = in->transaction_number;
-    out->message_count = 0; // rdm_queued_message_get_count(); //FIXME rdm_queued_message_get_count
+#if defined(ENABLE_RDM_QUEUED_MSG)
+    out->message_count = m_RDMQueuedMessage.GetMessageCount();
+#else
+    out->message_count = 0;
+#endif
     out->sub_device[0] = in->sub_device[0];
     out->sub_device[1] = in->sub_device[1];
-    out->command_class = static_cast<uint8_t>(in->command_class + 1);
-    out->param_id[0] = in->param_id[0];
-    out->param_id[1] = in->param_id[1];
+#if defined(ENABLE_RDM_QUEUED_MSG)
+    // The ACK for QUEUED_MESSAGE carries the command class and PID of the queued message itself
+    const auto kIsQueuedMessage = (type == E120_RESPONSE_TYPE_ACK) && (in->param_id[0] == static_cast<uint8_t>(E120_QUEUED_MESSAGE >> 8)) &&
+                                  (in->param_id[1] == static_cast<uint8_t>(E120_QUEUED_MESSAGE & 0xFF));
+    if (!kIsQueuedMessage)
+#endif
+    {
+        out->command_class = static_cast<uint8_t>(in->command_class + 1);
+        out->param_id[0] = in->param_id[0];
+        out->param_id[1] = in->param_id[1];
+    }
 
     switch (type)
     {
@@ -220,16 +266,11 @@ void RDMHandler::CreateRespondMessage(uint8_t type, uint16_t reason)
         out->source_uid[i] = kUid[i];
     }
 
-    uint16_t rdm_checksum = 0;
-    uint32_t i;
+    uint32_t i = out->message_length;
+    const auto kRdmChecksum = rdm::Checksum(m_pRdmDataOut, i);
 
-    for (i = 0; i < out->message_length; i++)
-    {
-        rdm_checksum = static_cast<uint16_t>(rdm_checksum + m_pRdmDataOut[i]);
-    }
-
-    m_pRdmDataOut[i++] = static_cast<uint8_t>(rdm_checksum >> 8);
-    m_pRdmDataOut[i] = static_cast<uint8_t>(rdm_checksum & 0XFF);
+    m_pRdmDataOut[i++] = static_cast<uint8_t>(kRdmChecksum >> 8);
+    m_pRdmDataOut[i] = static_cast<uint8_t>(kRdmChecksum & 0XFF);
 }
 
 void RDMHandler::RespondMessageAck()
@@ -440,30 +481,17 @@ void RDMHandler::Handlers(Type type, bool bIsBroadcast, uint8_t nCommandClass, u
     auto is_rdm = false;
     auto is_rdm_net = false;
 
-    for (auto& defintion : PID_DEFINITIONS)
+    if ((pid_handler = FindPidDefinition(nParamId)) != nullptr)
     {
-        if (defintion.nPid == nParamId)
-        {
-            pid_handler = &defintion;
-            is_rdm = defintion.bRDM;
-            is_rdm_net = defintion.bRDMNet;
-            break;
-        }
+        is_rdm = pid_handler->bRDM;
+        is_rdm_net = pid_handler->bRDMNet;
     }
-
 #if defined(CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
-    if (!pid_handler)
+    else if (FindParameterDescription(__builtin_bswap16(nParamId)) < GetParameterDescriptionCount())
     {
-        for (uint32_t i = 0; i < GetParameterDescriptionCount(); i++)
-        {
-            if (PARAMETER_DESCRIPTIONS[i].pid == __builtin_bswap16(nParamId))
-            {
-                pid_handler = &PID_DEFINITION_MANUFACTURER_GENERAL;
-                is_rdm = true;
-                is_rdm_net = false;
-                break;
-            }
-        }
+        pid_handler = &PID_DEFINITION_MANUFACTURER_GENERAL;
+        is_rdm = true;
+        is_rdm_net = false;
     }
 #endif
 
@@ -546,57 +574,111 @@ void RDMHandler::Handlers(Type type, bool bIsBroadcast, uint8_t nCommandClass, u
 #if defined(ENABLE_RDM_QUEUED_MSG)
 void RDMHandler::GetQueuedMessage([[maybe_unused]] uint16_t sub_device)
 {
-    m_RDMQueuedMessage.Handler(m_pRdmDataOut);
+    const auto* in = reinterpret_cast<struct TRdmMessageNoSc*>(m_pRdmDataIn);
+    const auto kStatusType = in->param_data[0];
+
+    if ((kStatusType < E120_STATUS_GET_LAST_MESSAGE) || (kStatusType > E120_STATUS_ERROR))
+    {
+        RespondMessageNack(E120_NR_DATA_OUT_OF_RANGE);
+        return;
+    }
+
+    m_RDMQueuedMessage.Handler(kStatusType, m_pRdmDataOut);
     RespondMessageAck();
 }
-#endif
 
-#if defined(RDM_RESPONDER)
-void RDMHandler::GetSupportedParameters(uint16_t sub_device)
+/**
+ * The status messages are taken from the same ring as the ones GET QUEUED_MESSAGE sends.
+ */
+void RDMHandler::GetStatusMessages([[maybe_unused]] uint16_t sub_device)
 {
-    uint8_t nSupportedParams = 0;
-    PidDefinition* pid_definitions;
-    uint32_t table_size = 0;
+    const auto* in = reinterpret_cast<struct TRdmMessageNoSc*>(m_pRdmDataIn);
+    const auto kStatusType = in->param_data[0];
 
-    if (sub_device != 0)
-    {
-        pid_definitions = const_cast<PidDefinition*>(&PID_DEFINITIONS_SUB_DEVICES[0]);
-        table_size = sizeof(PID_DEFINITIONS_SUB_DEVICES) / sizeof(PID_DEFINITIONS_SUB_DEVICES[0]);
-    }
-    else
+    if (kStatusType > E120_STATUS_ERROR)
     {
-        pid_definitions = const_cast<PidDefinition*>(&PID_DEFINITIONS[0]);
-        table_size = sizeof(PID_DEFINITIONS) / sizeof(PID_DEFINITIONS[0]);
+        RespondMessageNack(E120_NR_DATA_OUT_OF_RANGE);
+        return;
     }
 
-    auto* out = reinterpret_cast<struct TRdmMessage*>(m_pRdmDataOut);
-    uint32_t j = 0;
+    m_RDMQueuedMessage.StatusHandler(kStatusType, m_pRdmDataOut);
+    RespondMessageAck();
+}
+
+bool RDMHandler::QueueMessage(uint16_t param_id, const uint8_t* param_data, uint8_t param_data_length)
+{
+    assert(param_data_length <= sizeof(TRdmQueuedMessage::param_data));
+    assert((param_data != nullptr) || (param_data_length == 0));
+
+    TRdmQueuedMessage queued_message;
+
+    queued_message.command_class = E120_GET_COMMAND_RESPONSE;
+    queued_message.param_id[0] = static_cast<uint8_t>(param_id >> 8);
+    queued_message.param_id[1] = static_cast<uint8_t>(param_id);
+    queued_message.param_data_length = param_data_length;
 
-    for (uint32_t i = 0; i < table_size; i++)
+    if (param_data_length != 0)
     {
-        if (pid_definitions[i].bIncludeInSupportedParams)
-        {
-            nSupportedParams++;
-            out->param_data[j + j] = static_cast<uint8_t>(pid_definitions[i].nPid >> 8);
-            out->param_data[j + j + 1] = static_cast<uint8_t>(pid_definitions[i].nPid);
-            j++;
-        }
+        memcpy(queued_message.param_data, param_data, param_data_length);
     }
 
-#if defined(CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
-    const auto nSupportedParamsManufacturer = GetParameterDescriptionCount();
+    return m_RDMQueuedMessage.Add(&queued_message);
+}
+
+bool RDMHandler::QueueStatusMessage(uint16_t sub_device, uint8_t status_type, uint16_t status_message_id, int16_t data_value1, int16_t data_value2)
+{
+    TRdmStatusMessage status_message;
+
+    status_message.sub_device[0] = static_cast<uint8_t>(sub_device >> 8);
+    status_message.sub_device[1] = static_cast<uint8_t>(sub_device);
+    status_message.status_type = status_type;
+    status_message.status_message_id[0] = static_cast<uint8_t>(status_message_id >> 8);
+    status_message.status_message_id[1] = static_cast<uint8_t>(status_message_id);
+    status_message.data_value1[0] = static_cast<uint8_t>(static_cast<uint16_t>(data_value1) >> 8);
+    status_message.data_value1[1] = static_cast<uint8_t>(data_value1);
+    status_message.data_value2[0] = static_cast<uint8_t>(static_cast<uint16_t>(data_value2) >> 8);
+    status_message.data_value2[1] = static_cast<uint8_t>(data_value2);
+
+    return m_RDMQueuedMessage.AddStatus(&status_message);
+}
+#endif
+
+#if defined(RDM_RESPONDER)
+void RDMHandler::GetSupportedParameters(uint16_t sub_device)
+{
+    static constexpr auto kIsSupported = [](const PidDefinition& definition) { return definition.bIncludeInSupportedParams; };
+    static constexpr auto kKey = [](const PidDefinition& definition) { return definition.nPid; };
+    static_assert((rdmhandler::CountPids(PID_DEFINITIONS, kIsSupported) + rdmhandler::kManufacturerPidsMax) * 2 <= sizeof(rdmhandler::SupportedParameters::param_data),
+                  "PID_DEFINITIONS does not fit SUPPORTED_PARAMETERS");
+    static_assert((rdmhandler::CountPids(PID_DEFINITIONS_SUB_DEVICES, kIsSupported) + rdmhandler::kManufacturerPidsMax) * 2 <=
+                      sizeof(rdmhandler::SupportedParameters::param_data),
+                  "PID_DEFINITIONS_SUB_DEVICES does not fit SUPPORTED_PARAMETERS");
 
-    nSupportedParams = static_cast<uint8_t>(nSupportedParams + nSupportedParamsManufacturer);
+    auto& supported_parameters = supported_parameters_[(sub_device != 0) ? 1 : 0];
 
-    for (uint32_t i = 0; i < nSupportedParamsManufacturer; i++)
+    if (!supported_parameters.is_built) [[unlikely]]
     {
-        out->param_data[j + j] = static_cast<uint8_t>(PARAMETER_DESCRIPTIONS[i].pid); ///< The PIDs are swapped
-        out->param_data[j + j + 1] = static_cast<uint8_t>(PARAMETER_DESCRIPTIONS[i].pid >> 8);
-        j++;
-    }
+#if defined(CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
+        const auto* descriptions = &PARAMETER_DESCRIPTIONS[0];
+        const auto kDescriptionCount = GetParameterDescriptionCount();
+#else
+        const rdmhandler::ParameterDescription* descriptions = nullptr;
+        const uint32_t kDescriptionCount = 0;
 #endif
+        if (sub_device != 0)
+        {
+            rdmhandler::BuildSupportedParameters(PID_DEFINITIONS_SUB_DEVICES, kIsSupported, kKey, descriptions, kDescriptionCount, supported_parameters);
+        }
+        else
+        {
+            rdmhandler::BuildSupportedParameters(PID_DEFINITIONS, kIsSupported, kKey, descriptions, kDescriptionCount, supported_parameters);
+        }
+    }
+
+    auto* out = reinterpret_cast<struct TRdmMessage*>(m_pRdmDataOut);
 
-    out->param_data_length = static_cast<uint8_t>(2 * nSupportedParams);
+    out->param_data_length = supported_parameters.param_data_length;
+    memcpy(out->param_data, supported_parameters.param_data, supported_parameters.param_data_length);
 
     RespondMessageAck();
 }
@@ -611,18 +693,16 @@ void RDMHandler::GetParameterDescription([[maybe_unused]] uint16_t sub_device) {
         return;
     }
 
-    const auto nSupportedParamsManufacturer = GetParameterDescriptionCount();
+    const auto kIndex = FindParameterDescription(nPid);
 
-    for (uint32_t i = 0; i < nSupportedParamsManufacturer; i++) {
-        if (PARAMETER_DESCRIPTIONS[i].pid == nPid) {
-            auto* pRdmDataOut = reinterpret_cast<struct TRdmMessage*>(m_pRdmDataOut);
+    if (kIndex < GetParameterDescriptionCount()) {
+        auto* pRdmDataOut = reinterpret_cast<struct TRdmMessage*>(m_pRdmDataOut);
 
-            pRdmDataOut->param_data_length = PARAMETER_DESCRIPTIONS[i].pdl;
-            CopyParameterDescription(i, pRdmDataOut->param_data);
+        pRdmDataOut->param_data_length = PARAMETER_DESCRIPTIONS[kIndex].pdl;
+        CopyParameterDescription(kIndex, pRdmDataOut->param_data);
 
-            RespondMessageAck();
-            return;
-        }
+        RespondMessageAck();
+        return;
     }
 
     RespondMessageNack(E120_NR_DATA_OUT_OF_RANGE);
@@ -655,13 +735,13 @@ void RDMHandler::SetManufacturerPid(bool is_broadcast, [[maybe_unused]] uint16_t
     struct rdmhandler::ManufacturerParamData pOut = {0, pRdmDataOut->param_data};
     uint16_t nReason = E120_NR_UNKNOWN_PID;
 
-    for (uint32_t nIndex = 0; nIndex < GetParameterDescriptionCount(); nIndex++) {
-        if (PARAMETER_DESCRIPTIONS[nIndex].pid == nPid) {
-            if (rdmhandler::HandleManufactureerPidSet(is_broadcast, nPid, PARAMETER_DESCRIPTIONS[nIndex], &pIn, &pOut, nReason)) {
-                pRdmDataOut->param_data_length = pOut.nPdl;
-                RespondMessageAck();
-                return;
-            }
+    const auto kIndex = FindParameterDescription(nPid);
+
+    if (kIndex < GetParameterDescriptionCount()) {
+        if (rdmhandler::HandleManufactureerPidSet(is_broadcast, nPid, PARAMETER_DESCRIPTIONS[kIndex], &pIn, &pOut, nReason)) {
+            pRdmDataOut->param_data_length = pOut.nPdl;
+            RespondMessageAck();
+            return;
         }
     }
 
@@ -708,6 +788,7 @@ void RDMHandler::SetFactoryDefaults(bool is_broadcast, [[maybe_unused]] uint16_t
 
 #if defined(RDM_RESPONDER)
     RDMDeviceResponder::Get()->SetFactoryDefaults();
+    InvalidateSupportedParameters();
 #else
     rdm::device::Device::Instance().SetFactoryDefaults();
 #endif
@@ -960,6 +1041,7 @@ void RDMHandler::SetPersonality([[maybe_unused]] bool is_broadcast, uint16_t sub
     }
 
     RDMDeviceResponder::Get()->SetPersonalityCurrent(sub_device, kPersonality);
+    InvalidateSupportedParameters();
 
     auto* out = reinterpret_cast<struct TRdmMessage*>(m_pRdmDataOut);
     out->param_data_length = 0;
@@ -1115,17 +1197,9 @@ void RDMHandler::GetSensorValue([[maybe_unused]] uint16_t sub_device)
         return;
     }
 
-    pRdmDataOut->param_data_length = 9;
-    pRdmDataOut->message_length = rdm::kMessageMinimumSize + 9;
-    pRdmDataOut->param_data[0] = pSensorValues->sensor_requested;
-    pRdmDataOut->param_data[1] = static_cast<uint8_t>(pSensorValues->present >> 8);
-    pRdmDataOut->param_data[2] = static_cast<uint8_t>(pSensorValues->present);
-    pRdmDataOut->param_data[3] = static_cast<uint8_t>(pSensorValues->lowest_detected >> 8);
-    pRdmDataOut->param_data[4] = static_cast<uint8_t>(pSensorValues->lowest_detected);
-    pRdmDataOut->param_data[5] = static_cast<uint8_t>(pSensorValues->highest_detected >> 8);
-    pRdmDataOut->param_data[6] = static_cast<uint8_t>(pSensorValues->highest_detected);
-    pRdmDataOut->param_data[7] = static_cast<uint8_t>(pSensorValues->recorded >> 8);
-    pRdmDataOut->param_data[8] = static_cast<uint8_t>(pSensorValues->recorded);
+    pRdmDataOut->param_data_length = rdm::sensor::kValuesParamDataLength;
+    pRdmDataOut->message_length = rdm::kMessageMinimumSize + rdm::sensor::kValuesParamDataLength;
+    rdm::sensor::ValuesToParamData(*pSensorValues, pRdmDataOut->param_data);
 
     RespondMessageAck();
 }
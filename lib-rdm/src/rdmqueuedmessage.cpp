@@ -24,6 +24,7 @@
  */
 
 #include <cstdint>
+#include <cstring>
 #include <cassert>
 
 #include "rdmqueuedmessage.h"
@@ -31,86 +32,220 @@
 #include "e120.h"
 #include "rdm_e120.h"
 
-RDMQueuedMessage::RDMQueuedMessage()
+static_assert(rdm::queuedmessage::kCapacity <= rdm::kMessageCountMax);
+
+// SENSOR_VALUE messages are kept per sensor
+static bool IsSameSensor(const struct TRdmQueuedMessage& pending, const struct TRdmQueuedMessage& queued_message)
 {
-    queued_message_ = new TRdmQueuedMessage[rdm::kMessageCountMax];
-    assert(queued_message_ != nullptr);
+    if ((queued_message.param_id[0] != static_cast<uint8_t>(E120_SENSOR_VALUE >> 8)) || (queued_message.param_id[1] != static_cast<uint8_t>(E120_SENSOR_VALUE & 0xFF)))
+    {
+        return true;
+    }
+
+    return pending.param_data[0] == queued_message.param_data[0];
 }
 
-RDMQueuedMessage::~RDMQueuedMessage()
+void RDMQueuedMessage::Copy(struct TRdmMessage* rdm_message, const struct TRdmQueuedMessage& queued_message)
 {
-    assert(queued_message_ == nullptr);
-    delete[] queued_message_;
+    rdm_message->command_class = queued_message.command_class;
+    rdm_message->param_id[0] = queued_message.param_id[0];
+    rdm_message->param_id[1] = queued_message.param_id[1];
+    rdm_message->param_data_length = queued_message.param_data_length;
+
+    memcpy(rdm_message->param_data, queued_message.param_data, queued_message.param_data_length);
 }
 
-void RDMQueuedMessage::Copy(struct TRdmMessage* rdm_message, uint32_t index)
+void RDMQueuedMessage::Save(struct TRdmQueuedMessage* queued_message, const struct TRdmMessage* rdm_message)
 {
-    assert(index < rdm::kMessageCountMax);
-
-    rdm_message->command_class = queued_message_[index].command_class;
-    rdm_message->param_id[0] = queued_message_[index].param_id[0];
-    rdm_message->param_id[1] = queued_message_[index].param_id[1];
-    rdm_message->param_data_length = queued_message_[index].param_data_length;
+    queued_message->command_class = rdm_message->command_class;
+    queued_message->param_id[0] = rdm_message->param_id[0];
+    queued_message->param_id[1] = rdm_message->param_id[1];
+    queued_message->param_data_length = rdm_message->param_data_length;
 
-    for (uint32_t i = 0; i < rdm_message->param_data_length; i++)
-    {
-        rdm_message->param_data[i] = queued_message_[index].param_data[i];
-    }
+    memcpy(queued_message->param_data, rdm_message->param_data, rdm_message->param_data_length);
 }
 
-uint8_t RDMQueuedMessage::GetMessageCount() const
+/**
+ * An empty queue is answered with an empty STATUS_MESSAGES response.
+ */
+void RDMQueuedMessage::SetStatusMessages(struct TRdmMessage* rdm_message)
 {
-    return message_count_;
+    rdm_message->command_class = E120_GET_COMMAND_RESPONSE;
+    rdm_message->param_id[0] = static_cast<uint8_t>(E120_STATUS_MESSAGES >> 8);
+    rdm_message->param_id[1] = static_cast<uint8_t>(E120_STATUS_MESSAGES & 0xFF);
+    rdm_message->param_data_length = 0;
 }
 
-void RDMQueuedMessage::Handler(uint8_t* rdm_data)
+/**
+ * Sends the pending status messages of status_type and higher severity, the others stay queued in order.
+ * The _CLEARED types have the severity of the type they clear.
+ */
+void RDMQueuedMessage::CopyStatusMessages(struct TRdmMessage* rdm_message, uint8_t status_type)
 {
-    auto rdm_response = reinterpret_cast<struct TRdmMessage*>(rdm_data);
+    SetStatusMessages(rdm_message);
 
-    if (is_never_queued_)
+    if (status_type == E120_STATUS_NONE)
     {
-        rdm_response->slot16.response_type = E120_STATUS_MESSAGES;
-        rdm_response->param_data_length = 0;
+        return;
     }
-    else if (rdm_response->param_data[0] == E120_STATUS_GET_LAST_MESSAGE)
+
+    uint32_t length = 0;
+    auto kept = status_tail_;
+
+    for (auto i = status_tail_; i != status_head_; i++)
     {
-        Copy(rdm_response, message_count_);
+        const auto& status_message = status_message_[i & (rdm::queuedmessage::kStatusCapacity - 1)];
+
+        if ((status_message.status_type & 0x0F) >= status_type)
+        {
+            memcpy(&rdm_message->param_data[length], &status_message, sizeof(struct TRdmStatusMessage));
+            length += sizeof(struct TRdmStatusMessage);
+        }
+        else
+        {
+            if (kept != i)
+            {
+                status_message_[kept & (rdm::queuedmessage::kStatusCapacity - 1)] = status_message;
+            }
+            kept++;
+        }
     }
-    else
+
+    status_head_ = kept;
+
+    if (length != 0)
+    {
+        rdm_message->param_data_length = static_cast<uint8_t>(length);
+        Save(&last_status_messages_, rdm_message);
+    }
+}
+
+void RDMQueuedMessage::Handler(uint8_t status_type, uint8_t* rdm_data)
+{
+    auto* rdm_response = reinterpret_cast<struct TRdmMessage*>(rdm_data);
+
+    if (status_type == E120_STATUS_GET_LAST_MESSAGE)
     {
-        if (message_count_ != 0)
+        if (has_last_message_)
         {
-            message_count_--;
-            Copy(rdm_response, message_count_);
+            Copy(rdm_response, last_message_);
         }
         else
         {
-            rdm_response->slot16.response_type = E120_STATUS_MESSAGES;
-            rdm_response->param_data_length = 0;
+            SetStatusMessages(rdm_response);
         }
+
+        return;
+    }
+
+    if (head_ == tail_)
+    {
+        CopyStatusMessages(rdm_response, status_type);
+
+        if (rdm_response->param_data_length != 0)
+        {
+            Save(&last_message_, rdm_response);
+            has_last_message_ = true;
+        }
+
+        return;
     }
+
+    const auto& queued_message = queued_message_[tail_ & (rdm::queuedmessage::kCapacity - 1)];
+
+    Copy(rdm_response, queued_message);
+    memcpy(&last_message_, &queued_message, sizeof(last_message_));
+    has_last_message_ = true;
+
+    tail_++;
+}
+
+void RDMQueuedMessage::StatusHandler(uint8_t status_type, uint8_t* rdm_data)
+{
+    auto* rdm_response = reinterpret_cast<struct TRdmMessage*>(rdm_data);
+
+    if (status_type == E120_STATUS_GET_LAST_MESSAGE)
+    {
+        SetStatusMessages(rdm_response);
+        rdm_response->param_data_length = last_status_messages_.param_data_length;
+        memcpy(rdm_response->param_data, last_status_messages_.param_data, last_status_messages_.param_data_length);
+        return;
+    }
+
+    CopyStatusMessages(rdm_response, status_type);
 }
 
 bool RDMQueuedMessage::Add(const struct TRdmQueuedMessage* queued_message)
 {
-    is_never_queued_ = false;
+    assert(queued_message != nullptr);
+    assert(queued_message->param_data_length <= sizeof(queued_message->param_data));
+
+    TRdmQueuedMessage* slot = nullptr;
 
-    if (message_count_ != rdm::kMessageCountMax)
+    for (auto i = tail_; i != head_; i++)
     {
-        queued_message_[message_count_].command_class = queued_message->command_class;
-        queued_message_[message_count_].param_id[0] = queued_message->param_id[0];
-        queued_message_[message_count_].param_id[1] = queued_message->param_id[1];
-        queued_message_[message_count_].param_data_length = queued_message->param_data_length;
+        auto& pending = queued_message_[i & (rdm::queuedmessage::kCapacity - 1)];
 
-        for (uint32_t i = 0; i < queued_message->param_data_length; i++)
+        if ((pending.command_class == queued_message->command_class) && (pending.param_id[0] == queued_message->param_id[0]) &&
+            (pending.param_id[1] == queued_message->param_id[1]) && IsSameSensor(pending, *queued_message))
         {
-            queued_message_[message_count_].param_data[i] = queued_message->param_data[i];
+            slot = &pending;
+            break;
         }
+    }
 
-        message_count_++;
+    if (slot == nullptr)
+    {
+        if ((head_ - tail_) == rdm::queuedmessage::kCapacity)
+        {
+            return false;
+        }
 
-        return true;
+        slot = &queued_message_[head_ & (rdm::queuedmessage::kCapacity - 1)];
+        head_++;
+    }
+
+    slot->command_class = queued_message->command_class;
+    slot->param_id[0] = queued_message->param_id[0];
+    slot->param_id[1] = queued_message->param_id[1];
+    slot->param_data_length = queued_message->param_data_length;
+
+    memcpy(slot->param_data, queued_message->param_data, queued_message->param_data_length);
+
+    return true;
+}
+
+bool RDMQueuedMessage::AddStatus(const struct TRdmStatusMessage* status_message)
+{
+    assert(status_message != nullptr);
+
+    TRdmStatusMessage* slot = nullptr;
+
+    for (auto i = status_tail_; i != status_head_; i++)
+    {
+        auto& pending = status_message_[i & (rdm::queuedmessage::kStatusCapacity - 1)];
+
+        if ((memcmp(pending.sub_device, status_message->sub_device, sizeof(pending.sub_device)) == 0) &&
+            (memcmp(pending.status_message_id, status_message->status_message_id, sizeof(pending.status_message_id)) == 0) &&
+            (memcmp(pending.data_value1, status_message->data_value1, sizeof(pending.data_value1)) == 0))
+        {
+            slot = &pending;
+            break;
+        }
     }
 
-    return false;
+    if (slot == nullptr)
+    {
+        if ((status_head_ - status_tail_) == rdm::queuedmessage::kStatusCapacity)
+        {
+            return false;
+        }
+
+        slot = &status_message_[status_head_ & (rdm::queuedmessage::kStatusCapacity - 1)];
+        status_head_++;
+    }
+
+    memcpy(slot, status_message, sizeof(struct TRdmStatusMessage));
+
+    return true;
 }
@@ -35,11 +35,14 @@
 #include "thermistor.h"
 #include "firmware/debug/debug_debug.h"
 
-class RDMSensorThermistor final : public RDMSensor, MCP3424 {
+/**
+ * One sensor per MCP3424 input, the sensors of a chip share its MCP3424 instance.
+ */
+class RDMSensorThermistor final : public RDMSensor {
    public:
-    explicit RDMSensorThermistor(uint8_t sensor, uint8_t address = 0, uint8_t channel = 0, int32_t calibration = 0) : RDMSensor(sensor), MCP3424(address), calibration_(calibration), channel_(channel) {
+    RDMSensorThermistor(uint8_t sensor, MCP3424& mcp3424, uint8_t channel = 0, int32_t calibration = 0) : RDMSensor(sensor), mcp3424_(mcp3424), calibration_(calibration), channel_(channel) {
         DEBUG_ENTRY();
-        DEBUG_PRINTF("nSensor=%u, address=0x%.2x, channel=%u, nCalibration=%d", sensor, address, channel, calibration);
+        DEBUG_PRINTF("nSensor=%u, channel=%u, nCalibration=%d", sensor, channel, calibration);
 
         SetType(E120_SENS_TEMPERATURE);
         SetUnit(E120_UNITS_CENTIGRADE);
@@ -53,12 +56,21 @@ class RDMSensorThermistor final : public RDMSensor, MCP3424 {
         DEBUG_EXIT();
     }
 
-    bool Initialize() override { return MCP3424::IsConnected(); }
+    bool Initialize() override {
+        if (!mcp3424_.IsConnected()) {
+            return false;
+        }
+
+        // Non-blocking, the first result collected by GetValue() seeds the temperature
+        mcp3424_.SetChannelMask(static_cast<uint8_t>(mcp3424_.GetChannelMask() | (1U << channel_)));
+
+        return true;
+    }
 
     bool Calibrate(float f) {
         const auto kCalibrate = static_cast<int32_t>(f * 10);
         uint32_t resistor;
-        const auto kMeasure = static_cast<int32_t>(GetValue(resistor) * 10);
+        const auto kMeasure = GetTemperature(resistor);
 
         DEBUG_PRINTF("kCalibrate=%d, kMeasure=%d", kCalibrate, kMeasure);
 
@@ -74,7 +86,7 @@ class RDMSensorThermistor final : public RDMSensor, MCP3424 {
 
         for (int32_t i = 1; i < 128; i++) {
             calibration_ = i * offset;
-            const auto kMeasures = static_cast<int32_t>(GetValue(resistor) * 10);
+            const auto kMeasures = GetTemperature(resistor);
             DEBUG_PRINTF("kCalibrate=%d, kMeasures=%d, m_nCalibration=%d, resistor=%u", kCalibrate, kMeasures, calibration_, resistor);
             if (kCalibrate == kMeasures) {
                 rdmsensors_store::SaveCalibration(RDMSensor::GetSensor(), calibration_);
@@ -92,28 +104,72 @@ class RDMSensorThermistor final : public RDMSensor, MCP3424 {
 
     int32_t GetCalibration() const { return calibration_; }
 
-    float GetValue(uint32_t& resistor) {
-        double sum = 0;
+    /**
+     * Blocking, reads that time out are not averaged.
+     * @return Temperature in 0.1 degree Celcius, the previous value when all reads time out
+     */
+    int32_t GetTemperature(uint32_t& resistor) {
+        uint32_t sum = 0;
+        uint32_t samples = 0;
         for (uint32_t i = 0; i < 4; i++) {
-            const auto kV = MCP3424::GetVoltage(channel_);
-            sum += kV;
+            const auto kRaw = mcp3424_.GetRaw(channel_);
+            if (kRaw != UINT32_MAX) {
+                sum += mcp3424_.ToMicroVolt(kRaw);
+                samples++;
+            }
+        }
+
+        if (samples == 0) {
+            resistor = UINT32_MAX;
+            return temperature_;
         }
-        const auto kV = sum / 4;
-        const auto kR = Resistor(kV);
-        const auto kT = sensor::thermistor::Temperature(kR);
-        DEBUG_PRINTF("v=%1.3f, r=%u, t=%3.1f", kV, kR, kT);
+
+        const auto kMicroVolt = sum / samples;
+        const auto kR = Resistor(kMicroVolt);
+        const auto kT = sensor::thermistor::TemperatureDeci(kR);
+        DEBUG_PRINTF("uv=%u, r=%u, t=%d", kMicroVolt, kR, kT);
         resistor = kR;
         return kT;
     }
 
+    /**
+     * Non-blocking, every call advances the shared round robin.
+     * The results of this channel are collected and 4 of them are averaged,
+     * the first result is taken as is.
+     */
     int16_t GetValue() override {
-        uint32_t resistor;
-        return static_cast<int16_t>(GetValue(resistor));
+        mcp3424_.Run();
+
+        uint32_t raw;
+
+        if (mcp3424_.GetResult(channel_, raw)) {
+            const auto kMicroVolt = mcp3424_.ToMicroVolt(raw);
+
+            if (!is_seeded_) {
+                temperature_ = sensor::thermistor::TemperatureDeci(Resistor(kMicroVolt));
+                is_seeded_ = true;
+            }
+
+            micro_volt_sum_ += kMicroVolt;
+
+            if (++samples_ == 4) {
+                temperature_ = sensor::thermistor::TemperatureDeci(Resistor(micro_volt_sum_ / 4));
+                micro_volt_sum_ = 0;
+                samples_ = 0;
+            }
+        }
+
+        return static_cast<int16_t>(temperature_ / 10);
     }
 
    private:
+    MCP3424& mcp3424_;
     int32_t calibration_;
+    int32_t temperature_{0};
+    uint32_t micro_volt_sum_{0};
+    uint32_t samples_{0};
     uint8_t channel_;
+    bool is_seeded_{false};
 
     /*
      * The R values are based on:
@@ -122,8 +178,17 @@ class RDMSensorThermistor final : public RDMSensor, MCP3424 {
     static constexpr int32_t kRGnd = 6800;   // 6K8
     static constexpr int32_t kRHigh = 10000; // 10K
 
-    uint32_t Resistor(double vin) {
-        const double kD = (5 * kRGnd) / vin;
+    uint32_t Resistor(uint32_t micro_volt) {
+        if (micro_volt == 0) {
+            return UINT32_MAX;
+        }
+
+        const auto kD = (UINT64_C(5000000) * kRGnd) / micro_volt;
+
+        if (kD > INT32_MAX) {
+            return UINT32_MAX;
+        }
+
         const auto kR = static_cast<int32_t>(kD) - kRGnd - kRHigh + calibration_;
         return static_cast<uint32_t>(kR);
     }
@@ -252,21 +252,31 @@ void RdmSensorsParams::Set() {
                 break;
 #endif
 #if !defined(CONFIG_RDM_SENSORS_DISABLE_THERMISTOR)
-            case rdm::sensors::Types::kMCP3424:
-                if (!Add(new RDMSensorThermistor(sensor_number, kAddress, 0, store_rdmsensors.calibrate[sensor_number]))) {
+            case rdm::sensors::Types::kMCP3424: {
+                // The four inputs are converted in turn by one shared instance
+                auto* mcp3424 = new MCP3424(kAddress);
+
+                if (!mcp3424->IsConnected()) {
+                    delete mcp3424;
                     continue;
                 }
-                sensor_number++;
-                if (!Add(new RDMSensorThermistor(sensor_number, kAddress, 1, store_rdmsensors.calibrate[sensor_number]))) {
-                    continue;
+
+                mcp3424->SetChannelMask(0);
+
+                uint8_t channel = 0;
+
+                for (; channel < 4; channel++) {
+                    if (!Add(new RDMSensorThermistor(sensor_number, *mcp3424, channel, store_rdmsensors.calibrate[sensor_number]))) {
+                        break;
+                    }
+                    sensor_number++;
                 }
-                sensor_number++;
-                if (!Add(new RDMSensorThermistor(sensor_number, kAddress, 2, store_rdmsensors.calibrate[sensor_number]))) {
-                    continue;
+
+                // The added thermistors keep a reference, the instance is only owned when none was added
+                if (channel == 0) {
+                    delete mcp3424;
                 }
-                sensor_number++;
-                Add(new RDMSensorThermistor(sensor_number, kAddress, 3, store_rdmsensors.calibrate[sensor_number]));
-                break;
+            } break;
 #endif
             default:
                 break;
@@ -28,6 +28,7 @@
  */
 
 #include <cstdint>
+#include <algorithm>
 
 #include "widget.h"
 #include "widgetconfiguration.h"
@@ -36,6 +37,7 @@
 #endif
 #include "timing.h"
 #include "dmx.h"
+#include "dmxconst.h"
 #include "rdm.h"
 #include "rdmdevice.h"
 #include "rdm_e120.h"
@@ -187,7 +189,25 @@ void Widget::ReceivedRdmPacket()
         return;
     }
 
-    const auto* rdm_data = Rdm::Receive(0);
+    const uint8_t* rdm_data = nullptr;
+    auto status = dmx::RdmReceiveStatus::kIdle;
+
+    // The response to our own request is polled, its timeout does not block the loop
+    if (send_rdm_packet_start_millis_ != 0)
+    {
+        status = Rdm::ReceivePoll(0, rdm_data);
+    }
+
+    if (status == dmx::RdmReceiveStatus::kTimeOut)
+    {
+        RdmTimeOutMessage(); // Send message to host Label=12 RDM_TIMEOUT
+        return;
+    }
+
+    if (status == dmx::RdmReceiveStatus::kIdle)
+    {
+        rdm_data = Rdm::Receive(0);
+    }
 
     if (rdm_data == nullptr)
     {
@@ -258,22 +278,19 @@ void Widget::ReceivedRdmPacket()
  * when the Widget receives any request message other than the Output Only Send DMX Packet
  * request, or the Get Widget Parameters request.
  *
+ * The DMX data has already been read into the acquired transmit buffer by ReceiveDataFromHost.
+ *
  * @param data_length DMX data to send, beginning with the start code.
  */
 void Widget::SendDmxPacketRequestOutputOnly(uint16_t data_length)
 {
-    if (send_rdm_packet_start_millis_ != 0)
-    {
-        return;
-    }
-
 #if !defined(NO_HDMI_OUTPUT)
     WidgetMonitor::Line(widgetmonitor::MonitorLine::kInfo, "OUTPUT_ONLY_SEND_DMX_PACKET_REQUEST");
     WidgetMonitor::Line(widgetmonitor::MonitorLine::kStatus, nullptr);
 #endif
 
     Dmx::SetPortDirection(0, dmx::Direction::kOutput, false);
-    Dmx::SetTransmitDataWithSC<dmx::SendStyle::kDirect>(0, data_, data_length);
+    Dmx::CommitTransmitBuffer<dmx::SendStyle::kDirect>(0, (data_length != 0) ? data_length - 1U : 0);
     Dmx::SetPortDirection(0, dmx::Direction::kOutput, true);
 }
 
@@ -298,6 +315,8 @@ void Widget::SendRdmPacketRequest(uint16_t data_length)
     is_rdm_discovery_running_ = (data->command_class == E120_DISCOVERY_COMMAND);
 
     Rdm::TransmitRaw(0, data_, data_length);
+    // Request to response, plus the longest response: 257 slots of 44 us
+    Rdm::ReceiveStart(0, static_cast<uint16_t>(rdm::controller::kResponseTimeOut + (257U * 44U)));
 
     send_rdm_packet_start_millis_ = timing::Millis();
 
@@ -310,6 +329,7 @@ void Widget::SendRdmPacketRequest(uint16_t data_length)
  *
  * This function is called from Run
  *
+ * Fallback for the modes in which ReceivedRdmPacket does not poll the response.
  */
 void Widget::RdmTimeout()
 {
@@ -429,6 +449,8 @@ void Widget::SendRdmDiscoveryRequest(uint16_t data_length)
 #endif
 
     Rdm::TransmitRaw(0, data_, data_length);
+    // Request to response, plus the discovery response: 24 slots of 44 us, it is complete at the IDLE frame after
+    Rdm::ReceiveStart(0, static_cast<uint16_t>(rdm::controller::kResponseTimeOut + (25U * 44U)));
 
     is_rdm_discovery_running_ = true;
     send_rdm_packet_start_millis_ = timing::Millis();
@@ -542,11 +564,21 @@ void Widget::ReceiveDataFromHost()
             const auto kMsb = usb_read_byte();
             const auto kDataLength = static_cast<uint16_t>((kMsb << 8) | kLsb);
 
+            // The DMX packet is read straight into the transmit buffer, while an RDM request is pending it is dropped
+            const auto kIsDmxOutput = (kLabel == kOutputOnlySendDmxPacketRequest) && (send_rdm_packet_start_millis_ == 0);
+            auto* data = kIsDmxOutput ? Dmx::AcquireTransmitBuffer(0) : data_;
+            const auto kLength = kIsDmxOutput ? std::min(kDataLength, static_cast<uint16_t>(dmx::kChannelsMax + 1)) : kDataLength;
+
             uint32_t i;
 
-            for (i = 0; i < kDataLength; i++)
+            for (i = 0; i < kLength; i++)
+            {
+                data[i] = usb_read_byte();
+            }
+
+            for (; i < kDataLength; i++)
             {
-                data_[i] = usb_read_byte();
+                static_cast<void>(usb_read_byte());
             }
 
             while ((static_cast<uint8_t>(widget::Amf::kEndCode) != usb_read_byte()) && (i++ < (sizeof(data_) / sizeof(data_[0]))));
@@ -573,7 +605,10 @@ void Widget::ReceiveDataFromHost()
                     GetManufacturerReply();
                     break;
                 case kOutputOnlySendDmxPacketRequest:
-                    SendDmxPacketRequestOutputOnly(kDataLength);
+                    if (kIsDmxOutput)
+                    {
+                        SendDmxPacketRequestOutputOnly(kLength);
+                    }
                     break;
                 case kReceiveDmxOnChange:
                     ReceiveDmxOnChange();
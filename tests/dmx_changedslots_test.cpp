@@ -0,0 +1,143 @@
+/**
+ * @file dmx_changedslots_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+
+#include "dmxchangedslots.h"
+#include "test.h"
+
+/**
+ * As the receiver marks a slot
+ */
+static void Mark(dmx::ChangedSlots& changed_slots, uint32_t slot) {
+    const auto kBit = slot - 1;
+    changed_slots.dirty[kBit >> 5] |= (1U << (kBit & 31));
+
+    if ((changed_slots.first == 0) || (slot < changed_slots.first)) {
+        changed_slots.first = slot;
+    }
+
+    if (slot > changed_slots.last) {
+        changed_slots.last = slot;
+    }
+}
+
+static void TestEmpty() {
+    dmx::ChangedSlots changed_slots{};
+    uint32_t slot = 1;
+    dmx::SlotRange range;
+
+    CHECK(!changed_slots.NextRange(slot, range));
+    CHECK(!changed_slots.IsChanged(1));
+}
+
+static void TestBounds() {
+    dmx::ChangedSlots changed_slots{};
+    Mark(changed_slots, 1);
+    Mark(changed_slots, dmx::kChannelsMax);
+
+    CHECK(changed_slots.IsChanged(1));
+    CHECK(changed_slots.IsChanged(dmx::kChannelsMax));
+    CHECK(!changed_slots.IsChanged(0));
+    CHECK(!changed_slots.IsChanged(dmx::kChannelsMax + 1));
+
+    uint32_t slot = 1;
+    dmx::SlotRange range;
+
+    CHECK(changed_slots.NextRange(slot, range) && (range.first == 1) && (range.last == 1));
+    CHECK(changed_slots.NextRange(slot, range) && (range.first == dmx::kChannelsMax) && (range.last == dmx::kChannelsMax));
+    CHECK(!changed_slots.NextRange(slot, range));
+}
+
+/**
+ * The ranges are the maximal runs of changed slots, in order
+ */
+static void TestRanges() {
+    for (uint32_t run = 0; run < 2000; run++) {
+        dmx::ChangedSlots changed_slots{};
+        bool is_changed[dmx::kChannelsMax + 2]{};
+        const auto kDensity = 1 + (test::Random() % 16);
+
+        for (uint32_t slot = 1; slot <= dmx::kChannelsMax; slot++) {
+            if ((test::Random() % 32) < kDensity) {
+                Mark(changed_slots, slot);
+                is_changed[slot] = true;
+            }
+        }
+
+        for (uint32_t slot = 0; slot <= dmx::kChannelsMax + 1; slot++) {
+            CHECK(changed_slots.IsChanged(slot) == is_changed[slot]);
+        }
+
+        bool is_seen[dmx::kChannelsMax + 2]{};
+        uint32_t slot = 1;
+        uint32_t previous_last = 0;
+        dmx::SlotRange range;
+
+        while (changed_slots.NextRange(slot, range)) {
+            CHECK(range.first > previous_last);
+            CHECK(range.first <= range.last);
+            CHECK(!is_changed[range.first - 1]);
+            CHECK(!is_changed[range.last + 1]);
+
+            for (auto i = range.first; i <= range.last; i++) {
+                CHECK(is_changed[i]);
+                is_seen[i] = true;
+            }
+
+            previous_last = range.last;
+        }
+
+        for (uint32_t i = 1; i <= dmx::kChannelsMax; i++) {
+            CHECK(is_seen[i] == is_changed[i]);
+        }
+    }
+}
+
+/**
+ * The search can start in the middle of a run
+ */
+static void TestStartSlot() {
+    dmx::ChangedSlots changed_slots{};
+
+    for (uint32_t slot = 30; slot <= 70; slot++) {
+        Mark(changed_slots, slot);
+    }
+
+    uint32_t slot = 40;
+    dmx::SlotRange range;
+
+    CHECK(changed_slots.NextRange(slot, range) && (range.first == 40) && (range.last == 70) && (slot == 71));
+    CHECK(!changed_slots.NextRange(slot, range));
+}
+
+int main() {
+    TestEmpty();
+    TestBounds();
+    TestRanges();
+    TestStartSlot();
+
+    return test::Result("dmx_changedslots_test");
+}
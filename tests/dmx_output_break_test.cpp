@@ -0,0 +1,232 @@
+/**
+ * @file dmx_output_break_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * lib-dmx dmx.cpp BREAK and MAB generation on the TIMER1 compare channel, on the model in mock/gd32f30x_dmx.cpp.
+ * The BREAK waits for USART_FLAG_TC in the compare interrupt, the caller never does.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "gd32/dmx.h"
+#include "dmxconst.h"
+#include "rdmconst.h"
+#include "gd32f30x_dmx.h"
+#include "test.h"
+
+namespace {
+constexpr uint32_t kRdmLength = 26;
+constexpr uint32_t kDmxSlots = 24;
+constexpr uint32_t kTimerCompareMin = 4;
+constexpr uint32_t kTransmitCompletePollTime = 44;
+constexpr uint32_t kTransmitCompleteRetriesMax = 8;
+
+using Type = mock::dmx::Event::Type;
+
+struct Packet {
+    uint64_t break_start;
+    uint64_t mark_start;
+    uint64_t first_slot;
+    uint64_t last_slot_end; ///< Of the packet before
+    std::vector<uint8_t> slots;
+};
+
+/**
+ * The packets on the line, as a receiver sees them.
+ */
+std::vector<Packet> GetPackets() {
+    std::vector<Packet> packets;
+    uint64_t last_slot_end = 0;
+
+    for (const auto& event : mock::dmx::GetEvents()) {
+        switch (event.type) {
+            case Type::kBreak:
+                packets.push_back({event.micros, 0, 0, last_slot_end, {}});
+                break;
+            case Type::kMark:
+                if (!packets.empty()) {
+                    packets.back().mark_start = event.micros;
+                }
+                break;
+            case Type::kSlot:
+                if (!packets.empty()) {
+                    if (packets.back().slots.empty()) {
+                        packets.back().first_slot = event.micros;
+                    }
+                    packets.back().slots.push_back(event.data);
+                }
+                last_slot_end = event.micros + mock::dmx::kSlotMicros;
+                break;
+            default:
+                break;
+        }
+    }
+
+    return packets;
+}
+
+void CheckPacket(const Packet& packet, uint32_t break_min, uint32_t break_max, uint32_t mab_min, uint32_t mab_max) {
+    CHECK(packet.break_start >= packet.last_slot_end);
+    CHECK(packet.mark_start >= packet.break_start + break_min);
+    CHECK(packet.mark_start <= packet.break_start + break_max);
+    CHECK(packet.first_slot >= packet.mark_start + mab_min);
+    CHECK(packet.first_slot <= packet.mark_start + mab_max);
+}
+
+bool WaitReleased() {
+    for (uint32_t micros = 0; micros < 10000; micros++) {
+        mock::dmx::Step(1);
+
+        const auto& events = mock::dmx::GetEvents();
+
+        if (!events.empty() && (events.back().type == Type::kDriverOff)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Sends the RDM request and returns the time spent in Dmx::RdmTransmit, and the BREAK start.
+ */
+uint64_t RdmTransmit(Dmx& dmx, const uint8_t* request, uint64_t& break_start) {
+    mock::dmx::ClearEvents();
+
+    const auto kStart = mock::dmx::GetMicros();
+    dmx.RdmTransmit(0, request, kRdmLength);
+    const auto kBlocked = mock::dmx::GetMicros() - kStart;
+
+    CHECK(WaitReleased());
+
+    const auto kPackets = GetPackets();
+    CHECK(kPackets.size() == 1);
+
+    if (kPackets.size() != 1) {
+        break_start = 0;
+        return kBlocked;
+    }
+
+    const auto& packet = kPackets.front();
+    CheckPacket(packet, rdm::transmit::kBreakTimeMin, rdm::transmit::kBreakTimeMax, rdm::transmit::kMabTimeMin, rdm::transmit::kMabTimeMax);
+    CHECK(packet.slots.size() == kRdmLength);
+    CHECK((packet.slots.size() == kRdmLength) && (memcmp(packet.slots.data(), request, kRdmLength) == 0));
+    CHECK(mock::dmx::GetEvents().front().type == Type::kDriverOn);
+    CHECK(mock::dmx::GetEvents().front().micros <= packet.break_start);
+
+    break_start = packet.break_start - kStart;
+    return kBlocked;
+}
+} // namespace
+
+int main() {
+    mock::dmx::Init();
+
+    Dmx dmx;
+    dmx.SetPortDirection(0, dmx::Direction::kInput, true);
+    mock::dmx::Step(100);
+
+    uint8_t request[kRdmLength];
+    for (uint32_t i = 0; i < kRdmLength; i++) {
+        request[i] = static_cast<uint8_t>(0xCC - i);
+    }
+
+    const auto& statistics = dmx.GetTotalStatistics(0);
+    uint64_t break_start;
+
+    // The USART is idle: the BREAK starts at the first compare
+    CHECK(RdmTransmit(dmx, request, break_start) == 0);
+    CHECK(break_start <= kTimerCompareMin + 1);
+    CHECK(statistics.dmx.transmit_timeout == 0);
+
+    // A slot is still shifted out: the BREAK starts at the poll after TC
+    constexpr uint32_t kHold = 100;
+    mock::dmx::Step(1000);
+    mock::dmx::HoldTransmitComplete(kHold);
+
+    CHECK(RdmTransmit(dmx, request, break_start) == 0);
+    CHECK(break_start >= kHold);
+    CHECK(break_start <= kHold + kTransmitCompletePollTime + 1);
+    CHECK(statistics.dmx.transmit_timeout == 0);
+
+    // A wedged USART: the BREAK is forced after the retries, the caller still does not wait
+    mock::dmx::Step(1000);
+    mock::dmx::HoldTransmitComplete(UINT32_MAX);
+
+    CHECK(RdmTransmit(dmx, request, break_start) == 0);
+    CHECK(break_start >= kTimerCompareMin + (kTransmitCompleteRetriesMax - 1) * kTransmitCompletePollTime);
+    CHECK(break_start <= kTimerCompareMin + (kTransmitCompleteRetriesMax - 1) * kTransmitCompletePollTime + 1);
+    CHECK(statistics.dmx.transmit_timeout == 1);
+
+    mock::dmx::HoldTransmitComplete(0);
+    mock::dmx::Step(1000);
+
+    // DMX at the shortest period: the inter time is shorter than the last two slots take
+    uint8_t data[1 + kDmxSlots] = {dmx::kStartCode};
+    for (uint32_t i = 1; i <= kDmxSlots; i++) {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    dmx.SetTransmitSlots(kDmxSlots);
+    dmx.SetTransmitPeriodTime(0);
+    dmx.SetOutputStyle(0, dmx::OutputStyle::kConstant);
+    dmx.SetTransmitDataWithSC<dmx::SendStyle::kDirect>(0, data, sizeof(data));
+    dmx.SetPortDirection(0, dmx::Direction::kOutput, true);
+    mock::dmx::ClearEvents();
+
+    mock::dmx::Step(20000);
+
+    auto packets = GetPackets();
+    CHECK(packets.size() >= 10);
+
+    for (size_t i = 1; i < packets.size(); i++) {
+        CheckPacket(packets[i], dmx.TransmitBreakTime(), dmx.TransmitBreakTime() + 1, dmx.TransmitMabTime(), dmx.TransmitMabTime() + 1);
+        CHECK(packets[i].break_start <= packets[i].last_slot_end + kTransmitCompletePollTime + 1);
+        CHECK((i + 1 == packets.size()) || (packets[i].slots.size() == sizeof(data)));
+    }
+
+    CHECK(statistics.dmx.transmit_timeout == 1);
+
+    // DMX on a wedged USART: every BREAK is forced, the output goes on
+    mock::dmx::HoldTransmitComplete(UINT32_MAX);
+    mock::dmx::ClearEvents();
+    mock::dmx::Step(20000);
+
+    packets = GetPackets();
+    CHECK(packets.size() >= 10);
+
+    for (size_t i = 1; i < packets.size(); i++) {
+        CheckPacket(packets[i], dmx.TransmitBreakTime(), dmx.TransmitBreakTime() + 1, dmx.TransmitMabTime(), dmx.TransmitMabTime() + 1);
+        CHECK(packets[i].break_start <= packets[i].last_slot_end + kTransmitCompleteRetriesMax * kTransmitCompletePollTime);
+    }
+
+    CHECK(statistics.dmx.transmit_timeout > packets.size());
+    CHECK(mock::dmx::GetStatistics().irq_storms == 0);
+
+    return test::Result("dmx_output_break_test");
+}
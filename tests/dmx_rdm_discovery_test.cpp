@@ -0,0 +1,207 @@
+/**
+ * @file dmx_rdm_discovery_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * lib-dmx dmx.cpp RDM discovery response timing, on the USART2/DMA0/TIMER1 model in mock/gd32f30x_dmx.cpp.
+ * E1.20 3.2.2: a responder must not drive the line before 176 us after the end of the request, and must answer within 2 ms.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include "gd32/dmx.h"
+#include "e120.h"
+#include "rdm_e120.h"
+#include "rdmchecksum.h"
+#include "gd32f30x_dmx.h"
+#include "test.h"
+
+namespace {
+constexpr uint32_t kSpacingMin = 176;
+constexpr uint32_t kSpacingMax = 2000;
+constexpr uint32_t kResponseLength = 24;
+
+using Type = mock::dmx::Event::Type;
+
+uint32_t MakeDiscUniqueBranch(uint8_t* data) {
+    auto* request = reinterpret_cast<TRdmMessage*>(data);
+    memset(data, 0, sizeof(TRdmMessage));
+
+    request->start_code = E120_SC_RDM;
+    request->sub_start_code = E120_SC_SUB_MESSAGE;
+    request->message_length = 24 + 12;
+    memset(request->destination_uid, 0xFF, sizeof(request->destination_uid));
+    request->source_uid[0] = 0x7F;
+    request->source_uid[5] = 0x01;
+    request->slot16.port_id = 1;
+    request->command_class = E120_DISCOVERY_COMMAND;
+    request->param_id[1] = E120_DISC_UNIQUE_BRANCH;
+    request->param_data_length = 12;
+    memset(&request->param_data[6], 0xFF, 6);
+
+    const auto kChecksum = rdm::Checksum(data, request->message_length);
+    data[request->message_length] = static_cast<uint8_t>(kChecksum >> 8);
+    data[request->message_length + 1] = static_cast<uint8_t>(kChecksum);
+
+    return request->message_length + 2U;
+}
+
+void MakeResponse(uint8_t* data) {
+    memset(data, 0xFE, 7);
+    data[7] = 0xAA;
+
+    for (uint32_t i = 8; i < kResponseLength; i++) {
+        data[i] = static_cast<uint8_t>(0xAA | (i * 0x11));
+    }
+}
+
+/**
+ * Runs until the request is in, as the responder main loop polls for it.
+ */
+bool ReceiveRequest(Dmx& dmx) {
+    uint8_t request[sizeof(TRdmMessage)];
+    const auto kLength = MakeDiscUniqueBranch(request);
+
+    mock::dmx::Receive(request, kLength);
+
+    for (uint32_t micros = 0; micros < 20000; micros++) {
+        mock::dmx::Step(1);
+
+        if (dmx.RdmReceive(0) != nullptr) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Runs until the driver is off again, the port back to receive.
+ */
+bool WaitReleased() {
+    for (uint32_t micros = 0; micros < 10000; micros++) {
+        mock::dmx::Step(1);
+
+        const auto& events = mock::dmx::GetEvents();
+
+        if (!events.empty() && (events.back().type == Type::kDriverOff) && (dmx::Direction::kInput == Dmx::Get()->PortDirection(0))) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * The line, from the end of the request: the driver on, the response slots, the driver off.
+ */
+void CheckResponse(const uint8_t* response, uint64_t receive_end) {
+    const auto& events = mock::dmx::GetEvents();
+
+    CHECK(!events.empty());
+    if (events.empty()) {
+        return;
+    }
+
+    CHECK(events.front().type == Type::kDriverOn);
+    const auto kDriverOn = events.front().micros;
+    CHECK(kDriverOn >= receive_end + kSpacingMin);
+    CHECK(kDriverOn <= receive_end + kSpacingMax);
+
+    uint32_t slots = 0;
+    uint64_t last_slot = 0;
+
+    for (const auto& event : events) {
+        CHECK(event.type != Type::kBreak);
+
+        if (event.type == Type::kSlot) {
+            CHECK(event.micros >= kDriverOn);
+            CHECK((slots == 0) || (event.micros == last_slot + mock::dmx::kSlotMicros));
+            CHECK(slots < kResponseLength);
+            if (slots < kResponseLength) {
+                CHECK(event.data == response[slots]);
+            }
+            last_slot = event.micros;
+            slots++;
+        }
+    }
+
+    CHECK(slots == kResponseLength);
+    CHECK(events.back().type == Type::kDriverOff);
+    CHECK(events.back().micros >= last_slot + mock::dmx::kSlotMicros);
+}
+} // namespace
+
+int main() {
+    mock::dmx::Init();
+
+    Dmx dmx;
+    dmx.SetPortDirection(0, dmx::Direction::kInput, true);
+    mock::dmx::Step(1000);
+
+    uint8_t response[kResponseLength];
+    MakeResponse(response);
+
+    // Answered right away: the driver waits for the packet spacing
+    CHECK(ReceiveRequest(dmx));
+    const auto kReceiveEnd = mock::dmx::GetReceiveEnd();
+    CHECK(mock::dmx::GetMicros() < kReceiveEnd + 100);
+    mock::dmx::ClearEvents();
+
+    dmx.RdmTransmitDiscoveryRespondMessage(0, response, kResponseLength);
+    CHECK(!mock::dmx::IsDriving());
+    CHECK(WaitReleased());
+    CheckResponse(response, kReceiveEnd);
+
+    // Answered late: the line is taken at the next compare
+    mock::dmx::Step(1000);
+    CHECK(ReceiveRequest(dmx));
+    const auto kLateReceiveEnd = mock::dmx::GetReceiveEnd();
+    mock::dmx::Step(400);
+    mock::dmx::ClearEvents();
+
+    const auto kRespondAt = mock::dmx::GetMicros();
+    dmx.RdmTransmitDiscoveryRespondMessage(0, response, kResponseLength);
+    CHECK(WaitReleased());
+    CheckResponse(response, kLateReceiveEnd);
+    CHECK(mock::dmx::GetEvents().front().micros <= kRespondAt + 10);
+
+    // Back to receive: the next request is in, and answered the same way while the 16-bit TIMER1 wraps in the packet spacing
+    mock::dmx::Step(0x10000U - static_cast<uint32_t>(mock::dmx::GetMicros() & 0xFFFFU) - 1900U);
+    CHECK(ReceiveRequest(dmx));
+    const auto kNextReceiveEnd = mock::dmx::GetReceiveEnd();
+    mock::dmx::ClearEvents();
+
+    dmx.RdmTransmitDiscoveryRespondMessage(0, response, kResponseLength);
+    CHECK(WaitReleased());
+    CheckResponse(response, kNextReceiveEnd);
+
+    const auto& statistics = mock::dmx::GetStatistics();
+    CHECK(statistics.overruns == 0);
+    CHECK(statistics.irq_storms == 0);
+    CHECK(dmx.GetTotalStatistics(0).rdm.sent.discovery_response == 3);
+
+    return test::Result("dmx_rdm_discovery_test");
+}
@@ -0,0 +1,215 @@
+/**
+ * @file dmx_rdm_receive_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * lib-dmx dmx.cpp RdmReceiveStart/RdmReceivePoll on the model in mock/gd32f30x_dmx.cpp.
+ * The timeout is the TIMER1 compare of the port, armed at the data direction turnaround after the request.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include "gd32/dmx.h"
+#include "rdmconst.h"
+#include "rdmchecksum.h"
+#include "gd32f30x_dmx.h"
+#include "test.h"
+
+namespace {
+constexpr uint32_t kRequestLength = 26;
+constexpr uint32_t kResponseLength = 40;
+constexpr uint32_t kDiscoveryResponseLength = 24;
+// As the widget: request to response, plus the longest response, or the discovery response and its IDLE frame
+constexpr auto kTimeOut = static_cast<uint16_t>(rdm::controller::kResponseTimeOut + (257U * 44U));
+constexpr auto kDiscoveryTimeOut = static_cast<uint16_t>(rdm::controller::kResponseTimeOut + (25U * 44U));
+
+using Type = mock::dmx::Event::Type;
+
+uint32_t s_callbacks;
+const uint8_t* s_callback_data;
+
+void Callback([[maybe_unused]] uint32_t port_index, const uint8_t* rdm_data) {
+    s_callbacks++;
+    s_callback_data = rdm_data;
+}
+
+void SetChecksum(uint8_t* response) {
+    const auto kChecksum = rdm::Checksum(response, kResponseLength - 2);
+    response[kResponseLength - 2] = static_cast<uint8_t>(kChecksum >> 8);
+    response[kResponseLength - 1] = static_cast<uint8_t>(kChecksum);
+}
+
+struct Transaction {
+    dmx::RdmReceiveStatus status;
+    uint64_t turnaround; ///< The driver off after the request
+    uint64_t completed;  ///< The poll that returned the status
+    uint32_t polls;      ///< While pending
+    const uint8_t* data;
+};
+
+/**
+ * The response is sent respond_after us after the turnaround, a discovery response without a BREAK.
+ * The poll runs every microsecond, as the superloop would.
+ */
+Transaction Run(Dmx& dmx, uint16_t time_out, const uint8_t* response, uint32_t length, uint32_t respond_after, bool is_discovery = false) {
+    uint8_t request[kRequestLength];
+    for (uint32_t i = 0; i < kRequestLength; i++) {
+        request[i] = static_cast<uint8_t>(0xCC + i);
+    }
+
+    Transaction transaction{dmx::RdmReceiveStatus::kPending, 0, 0, 0, nullptr};
+
+    mock::dmx::ClearEvents();
+    dmx.RdmTransmit(0, request, kRequestLength);
+    dmx.RdmReceiveStart(0, time_out);
+
+    bool is_responded = false;
+
+    for (uint32_t micros = 0; micros < 100000; micros++) {
+        const auto kBefore = mock::dmx::GetMicros();
+        const uint8_t* rdm_data;
+        const auto kStatus = dmx.RdmReceivePoll(0, rdm_data);
+        CHECK(mock::dmx::GetMicros() == kBefore);
+
+        if (kStatus != dmx::RdmReceiveStatus::kPending) {
+            transaction.status = kStatus;
+            transaction.completed = kBefore;
+            transaction.data = rdm_data;
+            break;
+        }
+
+        transaction.polls++;
+        mock::dmx::Step(1);
+
+        const auto& events = mock::dmx::GetEvents();
+
+        if ((transaction.turnaround == 0) && !events.empty() && (events.back().type == Type::kDriverOff)) {
+            transaction.turnaround = events.back().micros;
+        }
+
+        if (!is_responded && (transaction.turnaround != 0) && (mock::dmx::GetMicros() >= transaction.turnaround + respond_after)) {
+            mock::dmx::Receive(response, length, is_discovery ? 0 : 176);
+            is_responded = true;
+        }
+    }
+
+    return transaction;
+}
+} // namespace
+
+int main() {
+    mock::dmx::Init();
+
+    Dmx dmx;
+    dmx.SetPortDirection(0, dmx::Direction::kInput, true);
+    dmx.SetRdmReceiveCallback(Callback);
+    mock::dmx::Step(100);
+
+    uint8_t response[kResponseLength] = {0xCC, 0x01, kResponseLength - 2};
+    for (uint32_t i = 3; i < kResponseLength; i++) {
+        response[i] = static_cast<uint8_t>(i);
+    }
+    SetChecksum(response);
+
+    uint8_t discovery_response[kDiscoveryResponseLength];
+    memset(discovery_response, 0xFE, 7);
+    discovery_response[7] = 0xAA;
+    for (uint32_t i = 8; i < kDiscoveryResponseLength; i++) {
+        discovery_response[i] = static_cast<uint8_t>(0xAA | i);
+    }
+
+    // Early response: received as soon as it is complete, long before the timeout
+    auto transaction = Run(dmx, kTimeOut, response, kResponseLength, 200);
+    CHECK(transaction.status == dmx::RdmReceiveStatus::kReceived);
+    CHECK(transaction.data != nullptr);
+    CHECK((transaction.data != nullptr) && (memcmp(transaction.data, response, kResponseLength) == 0));
+    CHECK(transaction.completed <= mock::dmx::GetReceiveEnd() + 1);
+    CHECK(transaction.completed < transaction.turnaround + kTimeOut);
+    CHECK(s_callbacks == 1);
+    CHECK(s_callback_data == transaction.data);
+
+    // The status is reported once
+    const uint8_t* rdm_data;
+    CHECK(dmx.RdmReceivePoll(0, rdm_data) == dmx::RdmReceiveStatus::kIdle);
+    CHECK(rdm_data == nullptr);
+
+    // Late response: the timeout is reported at the compare, measured from the turnaround
+    mock::dmx::Step(1000);
+    transaction = Run(dmx, kTimeOut, response, 0, 0);
+    CHECK(transaction.status == dmx::RdmReceiveStatus::kTimeOut);
+    CHECK(transaction.data == nullptr);
+    CHECK(transaction.completed >= transaction.turnaround + kTimeOut);
+    CHECK(transaction.completed <= transaction.turnaround + kTimeOut + 2);
+    CHECK(transaction.polls >= kTimeOut);
+    CHECK(s_callbacks == 2);
+    CHECK(s_callback_data == nullptr);
+
+    // The late response comes in after the timeout, it is not taken for the response of the next request
+    mock::dmx::Step(static_cast<uint32_t>(transaction.turnaround + kTimeOut + 500U - mock::dmx::GetMicros()));
+    mock::dmx::Receive(response, kResponseLength);
+    mock::dmx::Step(static_cast<uint32_t>(mock::dmx::GetReceiveEnd() + 100U - mock::dmx::GetMicros()));
+    CHECK(dmx.RdmReceivePoll(0, rdm_data) == dmx::RdmReceiveStatus::kIdle);
+    CHECK(dmx.GetTotalStatistics(0).rdm.received.good == 1);
+    mock::dmx::Step(1000);
+
+    uint8_t next_response[kResponseLength];
+    memcpy(next_response, response, kResponseLength);
+
+    // Back-to-back: each request gets its own response
+    for (uint32_t i = 0; i < 4; i++) {
+        next_response[kResponseLength - 3] = static_cast<uint8_t>(0x80 + i);
+        SetChecksum(next_response);
+        transaction = Run(dmx, kTimeOut, next_response, kResponseLength, 176 + (i * 500));
+        CHECK(transaction.status == dmx::RdmReceiveStatus::kReceived);
+        CHECK((transaction.data != nullptr) && (memcmp(transaction.data, next_response, kResponseLength) == 0));
+    }
+
+    CHECK(s_callbacks == 6);
+
+    // Back-to-back with a timeout in between
+    transaction = Run(dmx, kTimeOut, response, 0, 0);
+    CHECK(transaction.status == dmx::RdmReceiveStatus::kTimeOut);
+    transaction = Run(dmx, kTimeOut, response, kResponseLength, 1000);
+    CHECK(transaction.status == dmx::RdmReceiveStatus::kReceived);
+    CHECK((transaction.data != nullptr) && (memcmp(transaction.data, response, kResponseLength) == 0));
+
+    // Discovery, as the widget's SEND_RDM_DISCOVERY_REQUEST: the response at the end of the request to response time
+    mock::dmx::Step(1000);
+    transaction = Run(dmx, kDiscoveryTimeOut, discovery_response, kDiscoveryResponseLength, rdm::controller::kResponseTimeOut - 100U, true);
+    CHECK(transaction.status == dmx::RdmReceiveStatus::kReceived);
+    CHECK((transaction.data != nullptr) && (memcmp(transaction.data, discovery_response, kDiscoveryResponseLength) == 0));
+    CHECK(transaction.completed < transaction.turnaround + kDiscoveryTimeOut);
+
+    // No discovery response: the timeout after 3.9 ms instead of the second of the widget's fallback
+    mock::dmx::Step(1000);
+    transaction = Run(dmx, kDiscoveryTimeOut, discovery_response, 0, 0, true);
+    CHECK(transaction.status == dmx::RdmReceiveStatus::kTimeOut);
+    CHECK(transaction.completed <= transaction.turnaround + kDiscoveryTimeOut + 2);
+
+    CHECK(s_callbacks == 10);
+    CHECK(mock::dmx::GetStatistics().irq_storms == 0);
+
+    return test::Result("dmx_rdm_receive_test");
+}
@@ -0,0 +1,238 @@
+/**
+ * @file dmx_rx_replay_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * lib-dmx dmx.cpp DMX/RDM receive on the model in mock/gd32f30x_dmx.cpp.
+ * Built twice: with an interrupt per slot, and with CONFIG_DMX_RX_DMA, the ring buffer drained at the DMA and IDLE interrupts.
+ * Both replay the same streams and must give the same frames and the same statistics.
+ * The interrupts per frame and the host time in the handlers are printed, for the comparison of both.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "gd32/dmx.h"
+#include "dmxconst.h"
+#include "rdm_e120.h"
+#include "rdmchecksum.h"
+#include "gd32f30x_dmx.h"
+#include "test.h"
+
+namespace {
+#if defined(CONFIG_DMX_RX_DMA)
+constexpr char kName[] = "dmx_rx_dma_replay_test";
+#else
+constexpr char kName[] = "dmx_rx_replay_test";
+#endif
+
+constexpr uint32_t kRdmLength = 40;
+constexpr uint32_t kDiscoveryResponseLength = 24;
+
+struct Counters {
+    uint32_t frames;
+    uint32_t irqs;
+    uint64_t handler_nanos;
+};
+
+/**
+ * Sends the packet and runs until the line has been idle for a while, the IDLE frame included.
+ */
+void Replay(const uint8_t* data, uint32_t length, uint32_t break_micros, uint32_t mab_micros, Counters& counters) {
+    const auto& statistics = mock::dmx::GetStatistics();
+    const auto kIrqs = statistics.usart_irqs + statistics.rx_dma_irqs;
+    const auto kHandlerNanos = statistics.handler_nanos;
+
+    mock::dmx::Receive(data, length, break_micros, mab_micros);
+    mock::dmx::Step(static_cast<uint32_t>(mock::dmx::GetReceiveEnd() + 100U - mock::dmx::GetMicros()));
+
+    counters.frames++;
+    counters.irqs += statistics.usart_irqs + statistics.rx_dma_irqs - kIrqs;
+    counters.handler_nanos += statistics.handler_nanos - kHandlerNanos;
+}
+
+void ReplayDmx(Dmx& dmx, const uint8_t* data, uint32_t length, uint32_t break_micros, uint32_t mab_micros, Counters& counters) {
+    Replay(data, length, break_micros, mab_micros, counters);
+
+    const auto* dmx_data = dmx.GetDmxAvailable(0);
+    CHECK(dmx_data != nullptr);
+
+    if (dmx_data == nullptr) {
+        return;
+    }
+
+    const auto kSlotsInPacket = reinterpret_cast<const struct Data*>(dmx_data)->statistics.slots_in_packet;
+    CHECK(kSlotsInPacket == length - 1);
+    CHECK(memcmp(dmx_data, data, length) == 0);
+
+    // Reported once
+    CHECK(dmx.GetDmxAvailable(0) == nullptr);
+}
+
+void SetChecksum(uint8_t* rdm_data) {
+    const auto kChecksum = rdm::Checksum(rdm_data, kRdmLength - 2);
+    rdm_data[kRdmLength - 2] = static_cast<uint8_t>(kChecksum >> 8);
+    rdm_data[kRdmLength - 1] = static_cast<uint8_t>(kChecksum);
+}
+
+void Print(const char* stream, const Counters& counters) {
+    printf(" %-24s %6u %8.1f %10.1f\n", stream, counters.frames, static_cast<double>(counters.irqs) / counters.frames,
+           static_cast<double>(counters.handler_nanos) / counters.frames);
+}
+} // namespace
+
+int main() {
+    mock::dmx::Init();
+
+    Dmx dmx;
+    dmx.SetPortDirection(0, dmx::Direction::kInput, true);
+    mock::dmx::Step(100);
+    mock::dmx::ResetStatistics();
+
+    uint8_t data[dmx::kChannelsMax + 1];
+    data[0] = dmx::kStartCode;
+
+    printf("%s, per frame\n", kName);
+    printf(" %-24s %6s %8s %10s\n", "stream", "frames", "irqs", "handler ns");
+
+    // Full frames, the BREAK and the MAB from the minimum to well above the typical
+    Counters full{};
+
+    for (uint32_t i = 0; i < 32; i++) {
+        for (uint32_t slot = 1; slot <= dmx::kChannelsMax; slot++) {
+            data[slot] = static_cast<uint8_t>(test::Random());
+        }
+
+        ReplayDmx(dmx, data, dmx::kChannelsMax + 1, 92 + (test::Random() % 400), 12 + (test::Random() % 80), full);
+    }
+
+    Print("513 slots", full);
+
+    // Short frames, completed at the IDLE frame, the lengths across the half and the full ring buffer
+    Counters short_frames{};
+
+    for (uint32_t i = 0; i < 64; i++) {
+        const auto kLength = 2 + (test::Random() % 300);
+
+        for (uint32_t slot = 1; slot < kLength; slot++) {
+            data[slot] = static_cast<uint8_t>(test::Random());
+        }
+
+        ReplayDmx(dmx, data, kLength, 176, 12 + (test::Random() % 80), short_frames);
+    }
+
+    Print("2..301 slots", short_frames);
+
+    // Frames that end exactly at the ring buffer boundaries
+    Counters boundaries{};
+
+    for (const uint32_t kLength : {128U, 129U, 255U, 256U, 257U, 384U, 512U}) {
+        for (uint32_t slot = 1; slot < kLength; slot++) {
+            data[slot] = static_cast<uint8_t>(kLength + slot);
+        }
+
+        ReplayDmx(dmx, data, kLength, 176, 12, boundaries);
+    }
+
+    Print("ring boundaries", boundaries);
+
+    // RDM, good and with a bad checksum
+    uint8_t rdm_data[kRdmLength] = {E120_SC_RDM, E120_SC_SUB_MESSAGE, kRdmLength - 2};
+    for (uint32_t i = 3; i < kRdmLength; i++) {
+        rdm_data[i] = static_cast<uint8_t>(i);
+    }
+
+    Counters rdm{};
+
+    for (uint32_t i = 0; i < 8; i++) {
+        rdm_data[kRdmLength - 3] = static_cast<uint8_t>(i);
+        SetChecksum(rdm_data);
+
+        const auto kIsBad = (i & 1) != 0;
+
+        if (kIsBad) {
+            rdm_data[kRdmLength - 1] ^= 0xFF;
+        }
+
+        Replay(rdm_data, kRdmLength, 176, 12, rdm);
+
+        const auto* p = dmx.RdmReceive(0);
+
+        if (kIsBad) {
+            CHECK(p == nullptr);
+        } else {
+            CHECK((p != nullptr) && (memcmp(p, rdm_data, kRdmLength) == 0));
+        }
+
+        CHECK(dmx.RdmReceive(0) == nullptr);
+    }
+
+    Print("rdm", rdm);
+
+    // Discovery responses, without a BREAK, complete at the IDLE frame
+    uint8_t discovery_response[kDiscoveryResponseLength];
+    memset(discovery_response, 0xFE, 7);
+    discovery_response[7] = 0xAA;
+
+    Counters discovery{};
+
+    for (uint32_t i = 0; i < 4; i++) {
+        for (uint32_t j = 8; j < kDiscoveryResponseLength; j++) {
+            discovery_response[j] = static_cast<uint8_t>(0xAA | (i + j));
+        }
+
+        Replay(discovery_response, kDiscoveryResponseLength, 0, 0, discovery);
+
+        const auto* p = dmx.RdmReceive(0);
+        CHECK((p != nullptr) && (memcmp(p, discovery_response, kDiscoveryResponseLength) == 0));
+    }
+
+    Print("discovery response", discovery);
+
+    // A DMX frame after all that is still received
+    for (uint32_t slot = 1; slot <= dmx::kChannelsMax; slot++) {
+        data[slot] = static_cast<uint8_t>(slot);
+    }
+
+    Counters last{};
+    ReplayDmx(dmx, data, dmx::kChannelsMax + 1, 176, 12, last);
+
+    const auto& total_statistics = dmx.GetTotalStatistics(0);
+    CHECK(total_statistics.dmx.received == 32 + 64 + 7 + 1);
+    CHECK(total_statistics.rdm.received.good == 4);
+    CHECK(total_statistics.rdm.received.bad == 4);
+    CHECK(total_statistics.rdm.received.discovery_response == 4);
+
+    const auto& statistics = mock::dmx::GetStatistics();
+    CHECK(statistics.overruns == 0);
+    CHECK(statistics.irq_storms == 0);
+#if defined(CONFIG_DMX_RX_DMA)
+    CHECK(statistics.rx_dma_slots == statistics.rx_slots);
+#else
+    CHECK(statistics.rx_dma_slots == 0);
+#endif
+
+    return test::Result(kName);
+}
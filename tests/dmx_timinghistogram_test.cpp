@@ -0,0 +1,111 @@
+/**
+ * @file dmx_timinghistogram_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+
+#include "dmxtimingstatistics.h"
+#include "test.h"
+
+static void TestBucketIndex() {
+    CHECK(dmx::TimingHistogram::BucketIndex(0) == 0);
+
+    // Bucket n holds 2^(n-1) .. 2^n - 1
+    for (uint32_t n = 1; n < dmx::TimingHistogram::kBuckets - 1; n++) {
+        CHECK(dmx::TimingHistogram::BucketIndex(1U << (n - 1)) == n);
+        CHECK(dmx::TimingHistogram::BucketIndex((1U << n) - 1) == n);
+    }
+
+    CHECK(dmx::TimingHistogram::BucketIndex(1U << 14) == dmx::TimingHistogram::kBuckets - 1);
+    CHECK(dmx::TimingHistogram::BucketIndex(UINT32_MAX) == dmx::TimingHistogram::kBuckets - 1);
+}
+
+static void TestEmpty() {
+    dmx::TimingHistogram histogram;
+    histogram.Reset();
+
+    CHECK(histogram.count == 0);
+    CHECK(histogram.Min() == 0);
+    CHECK(histogram.max == 0);
+    CHECK(histogram.Mean() == 0);
+
+    for (const auto kBucket : histogram.bucket) {
+        CHECK(kBucket == 0);
+    }
+}
+
+static void TestAdd() {
+    static constexpr uint32_t kConfigured = 176;
+    dmx::TimingHistogram histogram;
+    histogram.Reset();
+
+    histogram.Add(176, kConfigured); // exact
+    histogram.Add(177, kConfigured); // +1
+    histogram.Add(175, kConfigured); // -1
+    histogram.Add(180, kConfigured); // +4
+    histogram.Add(92, kConfigured);  // -84
+
+    CHECK(histogram.count == 5);
+    CHECK(histogram.Min() == 92);
+    CHECK(histogram.max == 180);
+    CHECK(histogram.Mean() == (176 + 177 + 175 + 180 + 92) / 5);
+    CHECK(histogram.bucket[0] == 1);
+    CHECK(histogram.bucket[1] == 2);
+    CHECK(histogram.bucket[3] == 1);
+    CHECK(histogram.bucket[7] == 1);
+
+    uint32_t total = 0;
+
+    for (const auto kBucket : histogram.bucket) {
+        total += kBucket;
+    }
+
+    CHECK(total == histogram.count);
+
+    histogram.Reset();
+    CHECK(histogram.count == 0);
+    CHECK(histogram.bucket[1] == 0);
+}
+
+static void TestLargeSum() {
+    // One second periods for longer than a 32-bit sum can hold
+    dmx::TimingHistogram histogram;
+    histogram.Reset();
+
+    for (uint32_t i = 0; i < 10000; i++) {
+        histogram.Add(1000000, 25000);
+    }
+
+    CHECK(histogram.Mean() == 1000000);
+    CHECK(histogram.bucket[dmx::TimingHistogram::kBuckets - 1] == 10000);
+}
+
+int main() {
+    TestBucketIndex();
+    TestEmpty();
+    TestAdd();
+    TestLargeSum();
+
+    return test::Result("dmx_timinghistogram_test");
+}
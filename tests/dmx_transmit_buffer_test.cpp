@@ -0,0 +1,304 @@
+/**
+ * @file dmx_transmit_buffer_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * lib-dmx dmx.cpp AcquireTransmitBuffer/CommitTransmitBuffer on the model in mock/gd32f30x_dmx.cpp.
+ * The frame is rendered slot by slot, the model runs in between, so that the TIMER1 interrupt that restarts
+ * the transmit DMA comes at any point of the acquire, render and commit. No frame on the line may be torn.
+ * Reports the bytes copied per frame, with SetTransmitDataWithoutSC and with the transmit buffer rendered in place.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstddef>
+#include <vector>
+
+#include "gd32/dmx.h"
+#include "dmxconst.h"
+#include "gd32f30x_dmx.h"
+#include "test.h"
+
+/*
+ * Counts the bytes copied while the driver is called.
+ * The test is built with -fno-builtin-memcpy, so that all copies come here.
+ */
+static bool s_is_counting;
+static uint32_t s_bytes_copied;
+
+// The loop must not be turned into a call of memcpy
+extern "C" __attribute__((optimize("no-tree-loop-distribute-patterns"))) void* memcpy(void* destination, const void* source, size_t length) {
+    auto* dst = static_cast<uint8_t*>(destination);
+    const auto* src = static_cast<const uint8_t*>(source);
+
+    if (s_is_counting) {
+        s_bytes_copied += static_cast<uint32_t>(length);
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        dst[i] = src[i];
+    }
+
+    return destination;
+}
+
+namespace {
+constexpr uint32_t kSlots = 32;
+
+using Type = mock::dmx::Event::Type;
+
+/*
+ * Slot 1 and 2 hold the frame number, the others are derived from it.
+ * A frame that is picked up while it is rendered has slots of two frame numbers.
+ */
+uint8_t GetSlot(uint32_t frame, uint32_t slot) {
+    switch (slot) {
+        case 1:
+            return static_cast<uint8_t>(frame);
+        case 2:
+            return static_cast<uint8_t>(frame >> 8);
+        default:
+            return static_cast<uint8_t>((frame * 31U) + slot);
+    }
+}
+
+/**
+ * The frame numbers on the line, in order. A frame that is not complete yet, at the end, is left out.
+ */
+std::vector<uint32_t> GetFrames() {
+    std::vector<std::vector<uint8_t>> packets;
+
+    for (const auto& event : mock::dmx::GetEvents()) {
+        if (event.type == Type::kBreak) {
+            packets.emplace_back();
+        } else if ((event.type == Type::kSlot) && !packets.empty()) {
+            packets.back().push_back(event.data);
+        }
+    }
+
+    if (!packets.empty() && (packets.back().size() != 1 + kSlots)) {
+        packets.pop_back();
+    }
+
+    std::vector<uint32_t> frames;
+
+    for (const auto& packet : packets) {
+        CHECK(packet.size() == 1 + kSlots);
+
+        if (packet.size() != 1 + kSlots) {
+            continue;
+        }
+
+        CHECK(packet[0] == dmx::kStartCode);
+
+        const auto kFrame = static_cast<uint32_t>(packet[1] | (packet[2] << 8));
+
+        for (uint32_t slot = 3; slot <= kSlots; slot++) {
+            if (packet[slot] != GetSlot(kFrame, slot)) {
+                printf("frame %u is torn at slot %u\n", kFrame, slot);
+                CHECK(false);
+                break;
+            }
+        }
+
+        frames.push_back(kFrame);
+    }
+
+    return frames;
+}
+
+/**
+ * Renders in place, the TIMER1 interrupt may come before and after every slot.
+ * With is_slow the buffer is held for several frame times.
+ */
+void Render(Dmx& dmx, uint32_t frame, bool is_slow) {
+    auto* data = dmx.AcquireTransmitBuffer(0);
+    mock::dmx::Step(test::Random() % 3);
+
+    CHECK(data[0] == dmx::kStartCode);
+
+    for (uint32_t slot = 1; slot <= kSlots; slot++) {
+        data[slot] = GetSlot(frame, slot);
+        mock::dmx::Step(is_slow ? 300 : test::Random() % 3);
+    }
+}
+
+void Copy(Dmx& dmx, uint32_t frame) {
+    uint8_t data[kSlots];
+
+    for (uint32_t slot = 1; slot <= kSlots; slot++) {
+        data[slot - 1] = GetSlot(frame, slot);
+    }
+
+    dmx.SetTransmitDataWithoutSC<dmx::SendStyle::kSync>(0, data, kSlots);
+}
+
+void CheckOrder(const std::vector<uint32_t>& frames) {
+    for (size_t i = 1; i < frames.size(); i++) {
+        CHECK(frames[i] >= frames[i - 1]);
+    }
+}
+
+struct Copied {
+    uint32_t frames;
+    uint32_t bytes;
+};
+
+void Print(const char* name, const Copied& copied) {
+    printf(" %-34s %6u %8u %6u\n", name, copied.frames, copied.bytes, copied.bytes / copied.frames);
+}
+} // namespace
+
+int main() {
+    mock::dmx::Init();
+
+    Dmx dmx;
+    dmx.SetPortDirection(0, dmx::Direction::kInput, true);
+    mock::dmx::Step(100);
+
+    dmx.SetTransmitSlots(kSlots);
+    dmx.SetTransmitPeriodTime(0);
+    dmx.SetOutputStyle(0, dmx::OutputStyle::kDelta);
+    dmx.SetPortDirection(0, dmx::Direction::kOutput, true);
+    mock::dmx::Step(100);
+
+    // Delta: one frame per Sync(), the commit itself does not start the output
+    uint32_t frame = 1;
+
+    for (; frame <= 64; frame++) {
+        mock::dmx::ClearEvents();
+
+        if ((frame & 3) == 0) {
+            Copy(dmx, frame);
+        } else {
+            Render(dmx, frame, false);
+            dmx.CommitTransmitBuffer<dmx::SendStyle::kSync>(0, kSlots);
+        }
+
+        mock::dmx::Step(test::Random() % 200);
+        CHECK(GetFrames().empty());
+
+        dmx.Sync();
+        mock::dmx::Step(3000);
+
+        const auto kFrames = GetFrames();
+        CHECK((kFrames.size() == 1) && (kFrames.front() == frame));
+    }
+
+    // Constant at the shortest period: the DMA restarts every frame, during the acquire, the render and the commit
+    dmx.SetOutputStyle(0, dmx::OutputStyle::kConstant);
+    mock::dmx::ClearEvents();
+
+    std::vector<uint32_t> committed;
+
+    for (; frame <= 64 + 400; frame++) {
+        const auto kPick = test::Random() % 16;
+
+        if (kPick < 4) {
+            Copy(dmx, frame);
+        } else {
+            Render(dmx, frame, kPick == 15);
+            mock::dmx::Step(test::Random() % 3);
+            dmx.CommitTransmitBuffer<dmx::SendStyle::kDirect>(0, kSlots);
+        }
+
+        committed.push_back(frame);
+        mock::dmx::Step(test::Random() % 2000);
+    }
+
+    mock::dmx::Step(5000);
+
+    const auto kFrames = GetFrames();
+    CHECK(kFrames.size() > 200);
+    CheckOrder(kFrames);
+    CHECK(!kFrames.empty() && (kFrames.back() == committed.back()));
+
+    // Most committed frames are on the line, the others were superseded before the next DMA restart
+    uint32_t sent = 0;
+    for (const auto kCommitted : committed) {
+        for (const auto kFrame : kFrames) {
+            if (kFrame == kCommitted) {
+                sent++;
+                break;
+            }
+        }
+    }
+    CHECK(sent > committed.size() / 2);
+
+    // The bytes copied per 512 slot frame, while the output runs
+    dmx.SetTransmitSlots(dmx::kChannelsMax);
+    mock::dmx::Step(30000);
+
+    uint8_t data[1 + dmx::kChannelsMax] = {dmx::kStartCode};
+    Copied with_sc{}, without_sc{}, in_place{};
+
+    for (uint32_t i = 0; i < 16; i++) {
+        for (uint32_t slot = 1; slot <= dmx::kChannelsMax; slot++) {
+            data[slot] = static_cast<uint8_t>(i + slot);
+        }
+
+        s_bytes_copied = 0;
+        s_is_counting = true;
+        dmx.SetTransmitDataWithSC<dmx::SendStyle::kDirect>(0, data, sizeof(data));
+        s_is_counting = false;
+        with_sc.frames++;
+        with_sc.bytes += s_bytes_copied;
+        mock::dmx::Step(test::Random() % 30000);
+
+        s_bytes_copied = 0;
+        s_is_counting = true;
+        dmx.SetTransmitDataWithoutSC<dmx::SendStyle::kDirect>(0, &data[1], dmx::kChannelsMax);
+        s_is_counting = false;
+        without_sc.frames++;
+        without_sc.bytes += s_bytes_copied;
+        mock::dmx::Step(test::Random() % 30000);
+
+        s_bytes_copied = 0;
+        s_is_counting = true;
+        auto* buffer = dmx.AcquireTransmitBuffer(0);
+        for (uint32_t slot = 1; slot <= dmx::kChannelsMax; slot++) {
+            buffer[slot] = static_cast<uint8_t>(i + slot);
+        }
+        dmx.CommitTransmitBuffer<dmx::SendStyle::kDirect>(0, dmx::kChannelsMax);
+        s_is_counting = false;
+        in_place.frames++;
+        in_place.bytes += s_bytes_copied;
+        mock::dmx::Step(test::Random() % 30000);
+    }
+
+    printf("DMX transmit, bytes copied per 512 slot frame\n");
+    printf(" %-34s %6s %8s %6s\n", "api", "frames", "bytes", "/frame");
+    Print("SetTransmitDataWithSC", with_sc);
+    Print("SetTransmitDataWithoutSC", without_sc);
+    Print("AcquireTransmitBuffer, Commit", in_place);
+
+    CHECK(with_sc.bytes == with_sc.frames * dmx::kChannelsMax);
+    CHECK(without_sc.bytes == without_sc.frames * dmx::kChannelsMax);
+    CHECK(in_place.bytes == 0);
+
+    CHECK(dmx.GetTotalStatistics(0).dmx.transmit_timeout == 0);
+    CHECK(mock::dmx::GetStatistics().irq_storms == 0);
+
+    return test::Result("dmx_transmit_buffer_test");
+}
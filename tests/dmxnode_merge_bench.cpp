@@ -0,0 +1,97 @@
+/**
+ * @file dmxnode_merge_bench.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Host cycles for a 512 slot HTP merge: the word kernel against the byte-wise std::max loop,
+ * and a partial merge of 16 changed slots.
+ * The GD32 build uses UQSUB8/UADD8 instead of the SWAR fallback measured here.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "dmxnodedata.h"
+#include "test.h"
+
+static inline uint64_t Now() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+__attribute__((noinline)) static void HtpBytes(uint8_t* out, const uint8_t* a, const uint8_t* b, uint32_t offset, uint32_t length) {
+    for (auto i = offset; i < offset + length; i++) {
+        out[i] = std::max(a[i], b[i]);
+    }
+}
+
+__attribute__((noinline)) static void HtpWords(uint8_t* out, const uint8_t* a, const uint8_t* b, uint32_t offset, uint32_t length) {
+    dmxnode::merge::Htp(out, a, b, offset, length);
+}
+
+template <typename F> static uint64_t Measure(F&& merge) {
+    static constexpr uint32_t kRuns = 100000;
+    auto best = UINT64_MAX;
+
+    for (uint32_t run = 0; run < kRuns; run++) {
+        const auto kStart = Now();
+        merge();
+        const auto kTicks = Now() - kStart;
+        best = std::min(best, kTicks);
+    }
+
+    return best;
+}
+
+int main() {
+    alignas(4) static uint8_t a[dmxnode::kUniverseSize];
+    alignas(4) static uint8_t b[dmxnode::kUniverseSize];
+    alignas(4) static uint8_t out[dmxnode::kUniverseSize];
+
+    for (uint32_t i = 0; i < dmxnode::kUniverseSize; i++) {
+        a[i] = static_cast<uint8_t>(test::Random());
+        b[i] = static_cast<uint8_t>(test::Random());
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    const char* unit = "TSC cycles";
+#else
+    const char* unit = "ns";
+#endif
+
+    printf("HTP merge, best of 100000 runs, %s\n", unit);
+    printf(" 512 slots, bytes : %llu\n", static_cast<unsigned long long>(Measure([&] { HtpBytes(out, a, b, 0, 512); })));
+    printf(" 512 slots, words : %llu\n", static_cast<unsigned long long>(Measure([&] { HtpWords(out, a, b, 0, 512); })));
+    printf("  16 slots, words : %llu\n", static_cast<unsigned long long>(Measure([&] { HtpWords(out, a, b, 101, 16); })));
+
+    return 0;
+}
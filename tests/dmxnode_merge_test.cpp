@@ -0,0 +1,176 @@
+/**
+ * @file dmxnode_merge_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include "dmxnodedata.h"
+#include "dmxchangedslots.h"
+#include "test.h"
+
+static void TestHtpWord() {
+    // Every pair of byte values, in every lane
+    for (uint32_t a = 0; a < 256; a++) {
+        for (uint32_t b = 0; b < 256; b++) {
+            for (uint32_t lane = 0; lane < 4; lane++) {
+                const auto kShift = lane * 8;
+                const auto kA = (a << kShift) | (0x5AU << ((kShift + 8) & 31));
+                const auto kB = (b << kShift) | (0xA5U << ((kShift + 8) & 31));
+                const auto kResult = dmxnode::merge::Htp(kA, kB);
+                CHECK(((kResult >> kShift) & 0xFF) == std::max(a, b));
+            }
+        }
+    }
+}
+
+static void TestHtpBuffer() {
+    alignas(4) uint8_t a[dmxnode::kUniverseSize];
+    alignas(4) uint8_t b[dmxnode::kUniverseSize];
+    alignas(4) uint8_t out[dmxnode::kUniverseSize];
+
+    for (uint32_t run = 0; run < 10000; run++) {
+        for (uint32_t i = 0; i < dmxnode::kUniverseSize; i++) {
+            a[i] = static_cast<uint8_t>(test::Random());
+            b[i] = static_cast<uint8_t>(test::Random());
+            out[i] = 0x55;
+        }
+
+        const auto kOffset = test::Random() % dmxnode::kUniverseSize;
+        const auto kLength = test::Random() % (dmxnode::kUniverseSize - kOffset + 1);
+
+        dmxnode::merge::Htp(out, a, b, kOffset, kLength);
+
+        for (uint32_t i = 0; i < dmxnode::kUniverseSize; i++) {
+            const auto kExpected = ((i >= kOffset) && (i < kOffset + kLength)) ? std::max(a[i], b[i]) : 0x55;
+            CHECK(out[i] == kExpected);
+        }
+    }
+}
+
+static void SetChanged(dmx::ChangedSlots& changed_slots, const uint8_t* previous, const uint8_t* data, uint32_t length) {
+    memset(&changed_slots, 0, sizeof(changed_slots));
+
+    for (uint32_t i = 0; i < length; i++) {
+        if (previous[i] != data[i]) {
+            const auto kSlot = i + 1;
+            changed_slots.dirty[i >> 5] |= (1U << (i & 31));
+            if (changed_slots.first == 0) {
+                changed_slots.first = kSlot;
+            }
+            changed_slots.last = kSlot;
+        }
+    }
+}
+
+static void TestDataRange() {
+    dmx::ChangedSlots changed_slots{};
+    uint32_t offset, count;
+
+    CHECK(!changed_slots.GetDataRange(512, offset, count));
+
+    changed_slots.first = 10;
+    changed_slots.last = 20;
+    CHECK(changed_slots.GetDataRange(512, offset, count) && (offset == 9) && (count == 11));
+    CHECK(changed_slots.GetDataRange(15, offset, count) && (offset == 9) && (count == 6));
+    CHECK(!changed_slots.GetDataRange(9, offset, count));
+}
+
+/**
+ * Two sources with a few changed slots per packet, merged as DMXReceiver does:
+ * the changed range only, all slots when the length changes.
+ * The output must equal the full merge of the latest packets.
+ */
+static void TestPartialMerge(dmxnode::MergeMode merge_mode) {
+    static constexpr uint32_t kPort = 0;
+    uint8_t source[2][dmxnode::kUniverseSize]{};
+    uint32_t length[2]{dmxnode::kUniverseSize, dmxnode::kUniverseSize};
+
+    dmxnode::Data::Clear(kPort);
+    dmxnode::Data::MergeSourceA(kPort, source[0], length[0], merge_mode);
+    dmxnode::Data::MergeSourceB(kPort, source[1], length[1], merge_mode);
+
+    for (uint32_t packet = 0; packet < 20000; packet++) {
+        const auto kSource = test::Random() & 1;
+        uint8_t data[dmxnode::kUniverseSize];
+        memcpy(data, source[kSource], sizeof(data));
+
+        auto new_length = length[kSource];
+
+        if ((test::Random() % 64) == 0) {
+            new_length = dmx::kChannelsMin + test::Random() % (dmxnode::kUniverseSize - dmx::kChannelsMin + 1);
+        }
+
+        const auto kChanges = test::Random() % 8;
+
+        for (uint32_t i = 0; i < kChanges; i++) {
+            data[test::Random() % new_length] = static_cast<uint8_t>(test::Random());
+        }
+
+        dmx::ChangedSlots changed_slots;
+        SetChanged(changed_slots, source[kSource], data, new_length);
+
+        uint32_t offset = 0;
+        uint32_t count = new_length;
+        auto do_merge = true;
+
+        if (dmxnode::Data::GetLength(kPort) == new_length) {
+            do_merge = changed_slots.GetDataRange(new_length, offset, count);
+        }
+
+        if (do_merge) {
+            if (kSource == 0) {
+                dmxnode::Data::MergeSourceA(kPort, data, new_length, merge_mode, offset, count);
+            } else {
+                dmxnode::Data::MergeSourceB(kPort, data, new_length, merge_mode, offset, count);
+            }
+        }
+
+        // Slots past the new length keep their value in the source buffer
+        memcpy(source[kSource], data, new_length);
+        length[kSource] = new_length;
+
+        if (merge_mode == dmxnode::MergeMode::kHtp) {
+            const auto* output = dmxnode::Data::Backup(kPort);
+
+            for (uint32_t i = 0; i < new_length; i++) {
+                CHECK(output[i] == std::max(source[0][i], source[1][i]));
+            }
+        } else if (do_merge) {
+            const auto* output = dmxnode::Data::Backup(kPort);
+            CHECK(memcmp(&output[offset], &data[offset], count) == 0);
+        }
+    }
+}
+
+int main() {
+    TestHtpWord();
+    TestHtpBuffer();
+    TestDataRange();
+    TestPartialMerge(dmxnode::MergeMode::kHtp);
+    TestPartialMerge(dmxnode::MergeMode::kLtp);
+
+    return test::Result("dmxnode_merge_test");
+}
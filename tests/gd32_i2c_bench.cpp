@@ -0,0 +1,124 @@
+/**
+ * @file gd32_i2c_bench.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * CPU time to write 128 bytes with lib-gd32 gd32_i2c.cpp, on the I2C0 model in mock/gd32f30x_i2c.cpp:
+ * the blocking Gd32I2cWrite() against a Gd32I2cAsyncSubmit() transaction.
+ *
+ * The blocking write polls for the whole transfer, its CPU time is the bus time.
+ * The interrupt driven write is counted in interrupts and register accesses, the cycles are an estimate for the Cortex-M4:
+ * 12 cycles to enter and 12 to leave an exception, 20 for the handler code and 4 per (APB) register access.
+ */
+
+#include <cstdint>
+#include <cstdio>
+
+#include "gd32_i2c.h"
+#include "gd32.h"
+#include "test.h"
+
+namespace {
+class Sink final : public mock::i2c0::Target {
+   public:
+    bool Address([[maybe_unused]] bool is_read) override { return true; }
+    bool Write([[maybe_unused]] uint8_t data) override {
+        bytes++;
+        return true;
+    }
+    uint8_t Read() override { return 0; }
+
+    uint32_t bytes{0};
+};
+
+constexpr uint8_t kAddress = 0x3C;
+constexpr uint32_t kLength = 128;
+constexpr uint32_t kCoreMHz = 120;
+constexpr uint32_t kCyclesPerIrq = 12 + 12 + 20;
+constexpr uint32_t kCyclesPerAccess = 4;
+
+Sink s_sink;
+uint8_t s_data[kLength];
+
+void Measure(uint32_t speed) {
+    Gd32I2cSetBaudrate(speed);
+    Gd32I2cSetAddress(kAddress);
+
+    // Blocking
+    s_sink.bytes = 0;
+    mock::i2c0::ResetStatistics();
+    auto start = mock::GetMicros();
+    CHECK(Gd32I2cWrite(reinterpret_cast<const char*>(s_data), kLength) == GD32_I2C_OK);
+    const auto kBlockingMicros = mock::GetMicros() - start;
+    const auto kBlockingAccesses = mock::i2c0::GetStatistics().thread_accesses;
+    CHECK(s_sink.bytes == kLength);
+
+    // Interrupt driven
+    gd32::i2c::Transaction transaction{};
+    transaction.write_data = s_data;
+    transaction.write_length = kLength;
+    transaction.address = kAddress;
+
+    s_sink.bytes = 0;
+    mock::i2c0::ResetStatistics();
+    start = mock::GetMicros();
+    CHECK(Gd32I2cAsyncSubmit(transaction));
+    const auto kSubmitAccesses = mock::i2c0::GetStatistics().thread_accesses;
+
+    while (!transaction.is_done) {
+        mock::i2c0::Step(1);
+    }
+
+    const auto kBusMicros = mock::GetMicros() - start;
+    const auto& kStatistics = mock::i2c0::GetStatistics();
+    CHECK(transaction.result == GD32_I2C_OK);
+    CHECK(s_sink.bytes == kLength);
+
+    const auto kAsyncCycles = kStatistics.irqs * kCyclesPerIrq + (kStatistics.irq_accesses + kSubmitAccesses) * kCyclesPerAccess;
+
+    printf(" %3u kHz blocking : %5u us CPU (%7u cycles), %5u register accesses\n", speed / 1000, static_cast<uint32_t>(kBlockingMicros),
+           static_cast<uint32_t>(kBlockingMicros) * kCoreMHz, kBlockingAccesses);
+    printf(" %3u kHz async    : %5.1f us CPU (%7u cycles), %5u register accesses, %u interrupts, bus %u us\n", speed / 1000,
+           static_cast<double>(kAsyncCycles) / kCoreMHz, kAsyncCycles, kStatistics.irq_accesses + kSubmitAccesses, kStatistics.irqs,
+           static_cast<uint32_t>(kBusMicros));
+
+    // Let the STOP finish
+    mock::i2c0::Step(100);
+}
+} // namespace
+
+int main() {
+    mock::i2c0::Attach(kAddress, &s_sink);
+    Gd32I2cBegin();
+
+    for (uint32_t i = 0; i < kLength; i++) {
+        s_data[i] = static_cast<uint8_t>(test::Random());
+    }
+
+    printf("I2C write of %u bytes, CPU time at %u MHz\n", kLength, kCoreMHz);
+    Measure(gd32::kI2CNormalSpeed);
+    Measure(gd32::kI2CFullSpeed);
+
+    return test::Result("gd32_i2c_bench");
+}
@@ -0,0 +1,294 @@
+/**
+ * @file gd32_i2c_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * lib-gd32 gd32_i2c.cpp, blocking and interrupt driven, on the I2C0 model in mock/gd32f30x_i2c.cpp.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "gd32_i2c.h"
+#include "gd32.h"
+#include "test.h"
+
+namespace {
+class Memory final : public mock::i2c0::Target {
+   public:
+    bool Address([[maybe_unused]] bool is_read) override { return true; }
+
+    bool Write(uint8_t data) override {
+        written.push_back(data);
+        return written.size() != nack_after;
+    }
+
+    uint8_t Read() override { return static_cast<uint8_t>(next++); }
+
+    std::vector<uint8_t> written;
+    uint32_t nack_after{0}; ///< 0 acknowledges all
+    uint32_t next{0x10};
+};
+
+constexpr uint8_t kAddress = 0x3C;
+constexpr uint8_t kAbsent = 0x3D;
+
+Memory s_memory;
+std::vector<uint32_t> s_completed;
+
+bool IsBusIdle() {
+    return (I2C_STAT1(I2C0) & (I2C_STAT1_MASTER | I2C_STAT1_I2CBSY)) == 0;
+}
+
+bool Wait(gd32::i2c::Transaction& transaction, uint32_t max_micros = 20000) {
+    for (uint32_t micros = 0; micros < max_micros; micros += 10) {
+        mock::i2c0::Step(10);
+        Gd32I2cAsyncRun();
+
+        if (transaction.is_done && Gd32I2cAsyncIsIdle()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+gd32::i2c::Transaction MakeTransaction(uint8_t address, const uint8_t* write_data, uint32_t write_length, uint8_t* read_data, uint32_t read_length) {
+    gd32::i2c::Transaction transaction{};
+    transaction.write_data = write_data;
+    transaction.write_length = write_length;
+    transaction.read_data = read_data;
+    transaction.read_length = read_length;
+    transaction.address = address;
+    return transaction;
+}
+
+void OnDone(gd32::i2c::Transaction& transaction) {
+    s_completed.push_back(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(transaction.context)));
+}
+
+void CheckClean() {
+    const auto& kStatistics = mock::i2c0::GetStatistics();
+    CHECK(kStatistics.last_byte_acked == 0);
+    CHECK(kStatistics.irq_storms == 0);
+    CHECK(IsBusIdle());
+}
+
+void TestBlocking() {
+    const char kData[] = {1, 2, 3, 4};
+
+    s_memory.written.clear();
+    Gd32I2cSetAddress(kAddress);
+    CHECK(Gd32I2cWrite(kData, 4) == GD32_I2C_OK);
+    CHECK((s_memory.written == std::vector<uint8_t>{1, 2, 3, 4}));
+
+    for (uint32_t length = 1; length <= 6; length++) {
+        char buffer[6] = {};
+        s_memory.next = 0x20;
+        CHECK(Gd32I2cRead(kAddress, buffer, length) == GD32_I2C_OK);
+
+        for (uint32_t i = 0; i < length; i++) {
+            CHECK(static_cast<uint8_t>(buffer[i]) == 0x20 + i);
+        }
+    }
+
+    CHECK(Gd32I2cIsConnected(kAddress, gd32::kI2CFullSpeed));
+    CHECK(!Gd32I2cIsConnected(kAbsent, gd32::kI2CFullSpeed));
+    Gd32I2cSetBaudrate(gd32::kI2CFullSpeed);
+
+    CheckClean();
+}
+
+void TestAsync() {
+    uint8_t write_data[16];
+
+    for (uint32_t i = 0; i < sizeof(write_data); i++) {
+        write_data[i] = static_cast<uint8_t>(0xA0 + i);
+    }
+
+    // Write only
+    s_memory.written.clear();
+    auto write = MakeTransaction(kAddress, write_data, 16, nullptr, 0);
+    CHECK(Gd32I2cAsyncSubmit(write));
+    CHECK(Wait(write));
+    CHECK(write.result == GD32_I2C_OK);
+    CHECK((s_memory.written == std::vector<uint8_t>(write_data, write_data + 16)));
+
+    // Read only, the 1, 2 and 3 or more byte sequences
+    for (uint32_t length = 1; length <= 7; length++) {
+        uint8_t read_data[7] = {};
+        s_memory.next = 0x40;
+        auto read = MakeTransaction(kAddress, nullptr, 0, read_data, length);
+        CHECK(Gd32I2cAsyncSubmit(read));
+        CHECK(Wait(read));
+        CHECK(read.result == GD32_I2C_OK);
+
+        for (uint32_t i = 0; i < length; i++) {
+            CHECK(read_data[i] == 0x40 + i);
+        }
+    }
+
+    // Write, repeated start, read
+    uint8_t read_data[4] = {};
+    s_memory.written.clear();
+    s_memory.next = 0x60;
+    auto write_read = MakeTransaction(kAddress, write_data, 1, read_data, 4);
+    CHECK(Gd32I2cAsyncSubmit(write_read));
+    CHECK(Wait(write_read));
+    CHECK(write_read.result == GD32_I2C_OK);
+    CHECK(s_memory.written.size() == 1);
+    CHECK((read_data[0] == 0x60) && (read_data[3] == 0x63));
+
+    // Address probe
+    auto probe = MakeTransaction(kAddress, nullptr, 0, nullptr, 0);
+    CHECK(Gd32I2cAsyncSubmit(probe));
+    CHECK(Wait(probe));
+    CHECK(probe.result == GD32_I2C_OK);
+
+    CheckClean();
+}
+
+/*
+ * The transactions complete in order, the queue holds kAsyncQueueSize of them.
+ */
+void TestQueue() {
+    uint8_t data[2] = {0x55, 0xAA};
+    gd32::i2c::Transaction transactions[gd32::i2c::kAsyncQueueSize + 1];
+
+    s_completed.clear();
+
+    for (uint32_t i = 0; i <= gd32::i2c::kAsyncQueueSize; i++) {
+        transactions[i] = MakeTransaction(kAddress, data, 2, nullptr, 0);
+        transactions[i].callback = OnDone;
+        transactions[i].context = reinterpret_cast<void*>(static_cast<uintptr_t>(i));
+    }
+
+    // The first one is started right away, it has left the queue
+    for (uint32_t i = 0; i <= gd32::i2c::kAsyncQueueSize; i++) {
+        CHECK(Gd32I2cAsyncSubmit(transactions[i]));
+    }
+
+    auto extra = MakeTransaction(kAddress, data, 2, nullptr, 0);
+    CHECK(!Gd32I2cAsyncSubmit(extra));
+
+    CHECK(Wait(transactions[gd32::i2c::kAsyncQueueSize], 100000));
+    CHECK(s_completed.size() == gd32::i2c::kAsyncQueueSize + 1);
+
+    for (uint32_t i = 0; i < s_completed.size(); i++) {
+        CHECK(s_completed[i] == i);
+        CHECK(transactions[i].result == GD32_I2C_OK);
+    }
+
+    CheckClean();
+}
+
+void TestNack() {
+    uint8_t data[4] = {1, 2, 3, 4};
+
+    // The blocking probe of an absent address leaves the acknowledge error behind
+    CHECK(!Gd32I2cIsConnected(kAbsent, gd32::kI2CFullSpeed));
+    Gd32I2cSetBaudrate(gd32::kI2CFullSpeed);
+
+    auto after_probe = MakeTransaction(kAddress, data, 4, nullptr, 0);
+    CHECK(Gd32I2cAsyncSubmit(after_probe));
+    CHECK(Wait(after_probe));
+    CHECK(after_probe.result == GD32_I2C_OK);
+
+    // Address
+    auto absent = MakeTransaction(kAbsent, data, 4, nullptr, 0);
+    auto next = MakeTransaction(kAddress, data, 4, nullptr, 0);
+    CHECK(Gd32I2cAsyncSubmit(absent));
+    CHECK(Gd32I2cAsyncSubmit(next));
+    CHECK(Wait(next));
+    CHECK(absent.result == GD32_I2C_NACK);
+    CHECK(next.result == GD32_I2C_OK);
+
+    // Data
+    s_memory.written.clear();
+    s_memory.nack_after = 2;
+    auto nacked = MakeTransaction(kAddress, data, 4, nullptr, 0);
+    CHECK(Gd32I2cAsyncSubmit(nacked));
+    CHECK(Wait(nacked));
+    CHECK(nacked.result == GD32_I2C_NACK);
+    CHECK(s_memory.written.size() == 2);
+    s_memory.nack_after = 0;
+
+    CheckClean();
+}
+
+void TestArbitrationLoss() {
+    uint8_t data[4] = {1, 2, 3, 4};
+
+    auto lost = MakeTransaction(kAddress, data, 4, nullptr, 0);
+    auto next = MakeTransaction(kAddress, data, 4, nullptr, 0);
+    mock::i2c0::InjectArbitrationLoss();
+    CHECK(Gd32I2cAsyncSubmit(lost));
+    CHECK(Gd32I2cAsyncSubmit(next));
+    CHECK(Wait(next));
+    CHECK(lost.result == GD32_I2C_NOK_LA);
+    CHECK(next.result == GD32_I2C_OK);
+
+    CheckClean();
+}
+
+void TestTimeOut() {
+    uint8_t data[4] = {1, 2, 3, 4};
+
+    auto hung = MakeTransaction(kAddress, data, 4, nullptr, 0);
+    auto next = MakeTransaction(kAddress, data, 4, nullptr, 0);
+    CHECK(Gd32I2cAsyncSubmit(hung));
+    mock::i2c0::Step(30);
+    mock::i2c0::InjectHang();
+    CHECK(Gd32I2cAsyncSubmit(next));
+
+    const auto kStart = mock::GetMicros();
+    CHECK(Wait(hung, 20000));
+    CHECK(hung.result == GD32_I2C_NOK_TOUT);
+    // 10 ms plus 1 ms for 4 bytes, Millis() has a resolution of 1 ms
+    CHECK(mock::GetMicros() - kStart <= 12000);
+
+    CHECK(Wait(next));
+    CHECK(next.result == GD32_I2C_OK);
+
+    // The blocking API still works after the recovery
+    char buffer[2];
+    CHECK(Gd32I2cRead(kAddress, buffer, 2) == GD32_I2C_OK);
+
+    CheckClean();
+}
+} // namespace
+
+int main() {
+    mock::i2c0::Attach(kAddress, &s_memory);
+    Gd32I2cBegin();
+
+    TestBlocking();
+    TestAsync();
+    TestQueue();
+    TestNack();
+    TestArbitrationLoss();
+    TestTimeOut();
+
+    return test::Result("gd32_i2c_test");
+}
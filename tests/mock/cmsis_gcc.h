@@ -0,0 +1,89 @@
+/**
+ * @file cmsis_gcc.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef __CMSIS_GCC_H
+#define __CMSIS_GCC_H
+
+/**
+ * Host stand-in for the CMSIS GCC intrinsics, force included before the device header.
+ * The standard peripheral library is built as C with it as well.
+ * The instructions are no-ops, PRIMASK is the one the peripheral models look at.
+ * __DMB() is where the busy waits poll, the peripheral model runs a microsecond from mock_barrier().
+ */
+
+#include <stdint.h>
+
+#define __ASM                  __asm
+#define __INLINE               inline
+#define __STATIC_INLINE        static inline
+#define __STATIC_FORCEINLINE   static inline
+#define __NO_RETURN            __attribute__((__noreturn__))
+#define __USED                 __attribute__((used))
+#define __WEAK                 __attribute__((weak))
+#define __PACKED               __attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT        struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION         union __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)           __attribute__((aligned(x)))
+#define __RESTRICT             __restrict
+#define __COMPILER_BARRIER()   __ASM volatile("" ::: "memory")
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern uint32_t mock_primask;
+void mock_barrier(void);
+#ifdef __cplusplus
+}
+#endif
+
+#define __NOP() __COMPILER_BARRIER()
+#define __WFI() __COMPILER_BARRIER()
+#define __WFE() __COMPILER_BARRIER()
+#define __SEV() __COMPILER_BARRIER()
+
+__STATIC_FORCEINLINE void __ISB(void) { __COMPILER_BARRIER(); }
+__STATIC_FORCEINLINE void __DSB(void) { __COMPILER_BARRIER(); }
+__STATIC_FORCEINLINE void __DMB(void) { mock_barrier(); }
+
+__STATIC_FORCEINLINE uint32_t __REV(uint32_t value) { return __builtin_bswap32(value); }
+__STATIC_FORCEINLINE uint32_t __REV16(uint32_t value) { return ((value & 0xFF00FF00U) >> 8) | ((value & 0x00FF00FFU) << 8); }
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value) { return (uint8_t)(value == 0 ? 32 : __builtin_clz(value)); }
+
+__STATIC_FORCEINLINE uint32_t __RBIT(uint32_t value) {
+    uint32_t result = 0;
+
+    for (uint32_t i = 0; i < 32; i++) {
+        result = (result << 1) | ((value >> i) & 1U);
+    }
+
+    return result;
+}
+
+__STATIC_FORCEINLINE void __enable_irq(void) { mock_primask = 0; }
+__STATIC_FORCEINLINE void __disable_irq(void) { mock_primask = 1; }
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void) { return mock_primask; }
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t primask) { mock_primask = primask; }
+
+#endif // __CMSIS_GCC_H
@@ -0,0 +1,67 @@
+/**
+ * @file gd32.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef GD32_H_
+#define GD32_H_
+
+/**
+ * Host stand-in for the GD32 device header, only what the tested sources use.
+ */
+
+#include <cstdint>
+
+namespace mock {
+/**
+ * The simulated time in microseconds, the peripheral models follow it.
+ */
+uint64_t GetMicros();
+void Advance(uint32_t micros);
+} // namespace mock
+
+/**
+ * The busy waits poll with a barrier, each one takes a microsecond.
+ */
+inline void __ISB() { mock::Advance(1); }
+inline void __DMB() {}
+
+/**
+ * The NVIC and PRIMASK, the peripheral models take an interrupt when it is enabled and not masked.
+ */
+typedef enum { I2C0_EV_IRQn = 31, I2C0_ER_IRQn = 32, I2C1_EV_IRQn = 33, I2C1_ER_IRQn = 34 } IRQn_Type;
+
+namespace mock {
+inline uint32_t primask;
+inline bool nvic_enabled[64];
+} // namespace mock
+
+inline void NVIC_SetPriority([[maybe_unused]] IRQn_Type irq, [[maybe_unused]] uint32_t priority) {}
+inline void NVIC_EnableIRQ(IRQn_Type irq) { mock::nvic_enabled[irq] = true; }
+inline uint32_t __get_PRIMASK() { return mock::primask; }
+inline void __disable_irq() { mock::primask = 1; }
+inline void __set_PRIMASK(uint32_t primask) { mock::primask = primask; }
+
+#include "gd32f30x_i2c.h"
+
+#endif // GD32_H_
@@ -0,0 +1,106 @@
+/**
+ * @file gd32_i2c.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cassert>
+
+#include "gd32_i2c.h"
+#include "i2c_device.h"
+#include "gd32.h"
+
+static mock::i2c::Device* s_devices[128];
+static mock::i2c::Statistics s_statistics;
+static uint32_t s_baudrate = gd32::kI2CNormalSpeed;
+static uint8_t s_address;
+
+static void Transfer(uint32_t length) {
+    mock::Advance(static_cast<uint32_t>((((1U + length) * 9U * 1000000U) + s_baudrate - 1) / s_baudrate));
+    s_statistics.bytes += length;
+}
+
+void Gd32I2cBegin() {}
+
+void Gd32I2cSetBaudrate(uint32_t baudrate) {
+    assert(baudrate != 0);
+    s_baudrate = baudrate;
+}
+
+void Gd32I2cSetAddress(uint8_t address) {
+    s_address = address;
+}
+
+uint8_t Gd32I2cWrite(const char* buffer, uint32_t length) {
+    return Gd32I2cWrite(s_address, buffer, length);
+}
+
+uint8_t Gd32I2cWrite(uint8_t address, const char* buffer, uint32_t length) {
+    s_statistics.writes++;
+    auto* device = s_devices[address & 0x7F];
+
+    if (device == nullptr) {
+        Transfer(0);
+        return GD32_I2C_NACK;
+    }
+
+    Transfer(length);
+    return device->Write(buffer, length);
+}
+
+uint8_t Gd32I2cRead(char* buffer, uint32_t length) {
+    return Gd32I2cRead(s_address, buffer, length);
+}
+
+uint8_t Gd32I2cRead(uint8_t address, char* buffer, uint32_t length) {
+    s_statistics.reads++;
+    auto* device = s_devices[address & 0x7F];
+
+    if (device == nullptr) {
+        Transfer(0);
+        return GD32_I2C_NACK;
+    }
+
+    Transfer(length);
+    return device->Read(buffer, length);
+}
+
+bool Gd32I2cIsConnected(uint8_t address, uint32_t baudrate) {
+    Gd32I2cSetBaudrate(baudrate);
+    Transfer(0);
+    return s_devices[address & 0x7F] != nullptr;
+}
+
+namespace mock::i2c {
+void Attach(uint8_t address, Device* device) {
+    s_devices[address & 0x7F] = device;
+}
+
+const Statistics& GetStatistics() {
+    return s_statistics;
+}
+
+void ResetStatistics() {
+    s_statistics = Statistics{};
+}
+} // namespace mock::i2c
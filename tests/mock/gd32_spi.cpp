@@ -0,0 +1,262 @@
+/**
+ * @file gd32_spi.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+#include <vector>
+
+#include "gd32_spi.h"
+#include "gpio.h"
+
+#if !defined(SPI_BUFFER_SIZE)
+#define SPI_BUFFER_SIZE ((24 * 1024) / 2)
+#endif
+
+static uint16_t s_tx_buffer[SPI_BUFFER_SIZE] __attribute__((aligned(4)));
+
+static uint32_t s_speed_hz = 6400000;
+static const uint8_t* s_transfer;
+static uint32_t s_length;
+static uint64_t s_end_micros;
+static bool s_is_active;
+
+static uint8_t s_sent[sizeof(s_tx_buffer)];
+static uint8_t s_wire[sizeof(s_tx_buffer)];
+static uint32_t s_wire_length;
+
+static uint32_t s_frames;
+static uint32_t s_torn_frames;
+static uint32_t s_overruns;
+
+static void Finish() {
+    if (!s_is_active || (mock::GetMicros() < s_end_micros)) {
+        return;
+    }
+
+    s_is_active = false;
+
+    if (memcmp(s_sent, s_transfer, s_length) != 0) {
+        s_torn_frames++;
+    }
+
+    // Little endian halfwords, MSB first
+    for (uint32_t i = 0; i < s_length; i++) {
+        s_wire[i] = s_sent[i ^ 1];
+    }
+
+    s_wire_length = s_length;
+    s_frames++;
+}
+
+namespace i2s {
+void Gd32SpiDmaBegin() {}
+
+void Gd32SpiDmaSetSpeedHz(uint32_t speed_hz) {
+    assert(speed_hz != 0);
+    s_speed_hz = speed_hz;
+}
+
+const uint8_t* Gd32SpiDmaTxPrepare(uint32_t* length) {
+    *length = sizeof(s_tx_buffer);
+    return reinterpret_cast<const uint8_t*>(s_tx_buffer);
+}
+
+void Gd32SpiDmaTxStart(const uint8_t* tx_buffer, uint32_t length) {
+    Finish();
+
+    if (s_is_active) {
+        s_overruns++;
+    }
+
+    assert((length & 1) == 0);
+    assert(length <= sizeof(s_sent));
+
+    s_transfer = tx_buffer;
+    s_length = length;
+    memcpy(s_sent, tx_buffer, length);
+
+    s_end_micros = mock::GetMicros() + ((static_cast<uint64_t>(length) * 8U * 1000000U) + s_speed_hz - 1) / s_speed_hz;
+    s_is_active = true;
+}
+
+bool Gd32SpiDmaTxIsActive() {
+    Finish();
+    return s_is_active;
+}
+} // namespace i2s
+
+namespace mock::i2s {
+void Complete() {
+    if (s_is_active) {
+        mock::Advance(static_cast<uint32_t>(s_end_micros - mock::GetMicros()));
+        Finish();
+    }
+}
+
+const uint8_t* GetWire(uint32_t& length) {
+    length = s_wire_length;
+    return s_wire;
+}
+
+uint32_t GetFrames() { return s_frames; }
+uint32_t GetTornFrames() { return s_torn_frames; }
+uint32_t GetOverruns() { return s_overruns; }
+} // namespace mock::i2s
+
+/*
+ * The SPI for the SPI LCD
+ */
+
+static uint32_t s_lcd_speed_hz = 20000000;
+static mock::spi::Device* s_device;
+static uint32_t s_dc_gpio;
+static mock::spi::Statistics s_statistics;
+
+static const uint8_t* s_dma_buffer;
+static std::vector<uint8_t> s_dma_sent;
+static bool s_dma_dc;
+static uint64_t s_dma_end_micros;
+static bool s_is_dma_active;
+
+static uint32_t BusMicros(uint32_t length) {
+    return static_cast<uint32_t>(((static_cast<uint64_t>(length) * 8U * 1000000U) + s_lcd_speed_hz - 1) / s_lcd_speed_hz);
+}
+
+static bool IsDc() {
+    return mock::gpio::Get(s_dc_gpio);
+}
+
+static void DmaFinish() {
+    if (!s_is_dma_active || (mock::GetMicros() < s_dma_end_micros)) {
+        return;
+    }
+
+    s_is_dma_active = false;
+
+    if (memcmp(s_dma_sent.data(), s_dma_buffer, s_dma_sent.size()) != 0) {
+        s_statistics.torn++;
+    }
+
+    if (IsDc() != s_dma_dc) {
+        s_statistics.dc_changes++;
+    }
+
+    if (s_device != nullptr) {
+        s_device->Write(s_dma_sent.data(), static_cast<uint32_t>(s_dma_sent.size()), s_dma_dc);
+    }
+}
+
+static void BlockingWrite(const uint8_t* data, uint32_t length) {
+    DmaFinish();
+
+    if (s_is_dma_active) {
+        s_statistics.collisions++;
+    }
+
+    s_statistics.transfers++;
+    s_statistics.bytes += length;
+
+    mock::Advance(BusMicros(length));
+
+    if (s_device != nullptr) {
+        s_device->Write(data, length, IsDc());
+    }
+}
+
+void Gd32SpiBegin() {}
+void Gd32SpiEnd() {}
+
+void Gd32SpiSetSpeedHz(uint32_t speed_hz) {
+    assert(speed_hz != 0);
+    s_lcd_speed_hz = speed_hz;
+}
+
+void Gd32SpiSetDataMode([[maybe_unused]] uint8_t mode) {}
+void Gd32SpiChipSelect([[maybe_unused]] uint8_t chip_select) {}
+
+void Gd32SpiTransfernb(const char* tx_buffer, char* rx_buffer, uint32_t length) {
+    BlockingWrite(reinterpret_cast<const uint8_t*>(tx_buffer), length);
+    memset(rx_buffer, 0, length);
+}
+
+void Gd32SpiTransfern(char* tx_buffer, uint32_t length) {
+    Gd32SpiTransfernb(tx_buffer, tx_buffer, length);
+}
+
+void Gd32SpiWrite(uint16_t data) {
+    const uint8_t kData[] = {static_cast<uint8_t>(data >> 8), static_cast<uint8_t>(data & 0xFF)};
+    BlockingWrite(kData, sizeof(kData));
+}
+
+void Gd32SpiWritenb(const char* tx_buffer, uint32_t length) {
+    assert(tx_buffer != nullptr);
+    BlockingWrite(reinterpret_cast<const uint8_t*>(tx_buffer), length);
+}
+
+void Gd32SpiDmaTxStart(const uint8_t* tx_buffer, uint32_t length) {
+    assert(tx_buffer != nullptr);
+    assert(length != 0);
+    assert(length <= 0xFFFF);
+
+    DmaFinish();
+
+    if (s_is_dma_active) {
+        s_statistics.collisions++;
+    }
+
+    s_statistics.dma_transfers++;
+    s_statistics.bytes += length;
+
+    s_dma_buffer = tx_buffer;
+    s_dma_sent.assign(tx_buffer, tx_buffer + length);
+    s_dma_dc = IsDc();
+    s_dma_end_micros = mock::GetMicros() + BusMicros(length);
+    s_is_dma_active = true;
+}
+
+bool Gd32SpiDmaTxIsActive() {
+    if (s_is_dma_active) {
+        mock::Advance(1);
+    }
+
+    DmaFinish();
+    return s_is_dma_active;
+}
+
+namespace mock::spi {
+void Attach(Device* device, uint32_t dc_gpio) {
+    s_device = device;
+    s_dc_gpio = dc_gpio;
+}
+
+const Statistics& GetStatistics() {
+    return s_statistics;
+}
+
+void ResetStatistics() {
+    s_statistics = {};
+}
+} // namespace mock::spi
@@ -0,0 +1,125 @@
+/**
+ * @file gd32_spi.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef GD32_SPI_H_
+#define GD32_SPI_H_
+
+#include <cstdint>
+
+#include <gd32.h>
+
+/**
+ * The I2S DMA of lib-gd32 on the simulated clock, a transfer takes 8 bits per byte at the set speed.
+ */
+namespace i2s {
+void Gd32SpiDmaBegin();
+void Gd32SpiDmaSetSpeedHz(uint32_t speed_hz);
+const uint8_t* Gd32SpiDmaTxPrepare(uint32_t* length);
+void Gd32SpiDmaTxStart(const uint8_t* tx_buffer, uint32_t length);
+bool Gd32SpiDmaTxIsActive();
+} // namespace i2s
+
+/**
+ * The SPI of lib-gd32 gd32_spi.cpp on the simulated clock, as the SPI LCD of lib-display uses it.
+ * A blocking write takes its bus time. A DMA transfer runs in the background,
+ * each Gd32SpiDmaTxIsActive() poll takes a microsecond, as a register read.
+ */
+typedef enum GD32_SPI_BIT_ORDER {
+    GD32_SPI_BIT_ORDER_LSBFIRST = 0, ///< LSB First
+    GD32_SPI_BIT_ORDER_MSBFIRST = 1  ///< MSB First
+} gd32_spi_bit_order_t;
+
+typedef enum GD32_SPI_MODE {
+    GD32_SPI_MODE0 = 0, ///< CPOL = 0, CPHA = 0
+    GD32_SPI_MODE1 = 1, ///< CPOL = 0, CPHA = 1
+    GD32_SPI_MODE2 = 2, ///< CPOL = 1, CPHA = 0
+    GD32_SPI_MODE3 = 3  ///< CPOL = 1, CPHA = 1
+} gd32_spi_mode_t;
+
+typedef enum GD32_SPI_CS {
+    GD32_SPI_CS0 = 0, ///< Chip Select
+    GD32_SPI_CS_NONE  ///< No CS, control it yourself
+} gd32_spi_chip_select_t;
+
+void Gd32SpiBegin();
+void Gd32SpiEnd();
+void Gd32SpiSetSpeedHz(uint32_t speed_hz);
+void Gd32SpiSetDataMode(uint8_t mode);
+void Gd32SpiChipSelect(uint8_t chip_select);
+void Gd32SpiTransfernb(const char* tx_buffer, char* rx_buffer, uint32_t length);
+void Gd32SpiTransfern(char* tx_buffer, uint32_t length);
+void Gd32SpiWrite(uint16_t data);
+void Gd32SpiWritenb(const char* tx_buffer, uint32_t length);
+void Gd32SpiDmaTxStart(const uint8_t* tx_buffer, uint32_t length);
+bool Gd32SpiDmaTxIsActive();
+
+namespace mock::spi {
+/**
+ * The device on the bus gets the bytes of a transfer when it has completed,
+ * with the level of the D/C line at the start of the transfer.
+ */
+class Device {
+   public:
+    virtual ~Device() = default;
+    virtual void Write(const uint8_t* data, uint32_t length, bool is_data) = 0;
+};
+
+void Attach(Device* device, uint32_t dc_gpio);
+
+struct Statistics {
+    uint32_t transfers;     ///< Blocking writes
+    uint32_t dma_transfers;
+    uint32_t bytes;
+    uint32_t torn;          ///< DMA transfers of which the buffer was written while it was sent
+    uint32_t collisions;    ///< Writes started while a DMA transfer was still active
+    uint32_t dc_changes;    ///< DMA transfers during which the D/C line changed
+};
+
+const Statistics& GetStatistics();
+void ResetStatistics();
+} // namespace mock::spi
+
+namespace mock::i2s {
+/**
+ * Advances the simulated time to the end of the active transfer.
+ */
+void Complete();
+/**
+ * The bytes of the last completed transfer in the order they are on the wire:
+ * the I2S sends each halfword MSB first.
+ */
+const uint8_t* GetWire(uint32_t& length);
+uint32_t GetFrames();
+/**
+ * Transfers of which the buffer was written while it was sent
+ */
+uint32_t GetTornFrames();
+/**
+ * Transfers started while the previous one was still active
+ */
+uint32_t GetOverruns();
+} // namespace mock::i2s
+
+#endif // GD32_SPI_H_
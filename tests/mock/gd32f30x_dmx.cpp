@@ -0,0 +1,514 @@
+/**
+ * @file gd32f30x_dmx.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include <sys/mman.h>
+
+// The real one, not the mock next to this file
+#include <gd32.h>
+#include "gd32f30x_dmx.h"
+
+extern "C" {
+void TIMER1_IRQHandler();
+void USART2_IRQHandler();
+void DMA0_Channel1_IRQHandler();
+// Only with CONFIG_DMX_RX_DMA
+void DMA0_Channel2_IRQHandler() __attribute__((weak));
+}
+
+// The PRIMASK of mock/cmsis_gcc.h
+uint32_t mock_primask;
+// lib-gd32 keeps it, the driver counts the uptime in it
+struct HwTimersSeconds gv_seconds;
+
+namespace {
+constexpr uintptr_t kPeripheralBase = 0x40000000U;
+constexpr size_t kPeripheralSize = 0x30000U;
+constexpr uintptr_t kCoreBase = 0xE0000000U;
+constexpr size_t kCoreSize = 0x100000U;
+
+constexpr uint32_t kDirGpio = GPIOB;
+constexpr uint32_t kDirPin = GPIO_PIN_10;
+constexpr uint32_t kTxGpio = GPIOC;
+constexpr uint32_t kTxPin = 10;
+constexpr uint32_t kTxChannel = 1;
+constexpr uint32_t kRxChannel = 2;
+constexpr uint32_t kStormCount = 16;
+
+// The flags software clears by writing 0, the others are read-only or cleared by the STAT0, DATA read sequence
+constexpr uint32_t kStat0W0 = USART_STAT0_TC | USART_STAT0_RBNE | USART_STAT0_LBDF | USART_STAT0_CTSF;
+constexpr uint32_t kStat0Errors = USART_STAT0_FERR | USART_STAT0_NERR | USART_STAT0_ORERR;
+constexpr uint32_t kDmaInterrupts = DMA_CHXCTL_FTFIE | DMA_CHXCTL_HTFIE | DMA_CHXCTL_ERRIE;
+
+struct Rx {
+    enum class Type : uint8_t { kFrameError, kSlot, kIdle };
+    uint64_t micros;
+    Type type;
+    uint8_t data;
+};
+
+/**
+ * A DMA channel counts down CHCNT, the memory address it works on is internal.
+ */
+struct Dma {
+    uint32_t maddr;
+    uint32_t number;
+    uint32_t index;
+    uint32_t cnt; ///< What the model wrote to CHCNT
+    bool is_enabled;
+};
+
+struct State {
+    uint64_t micros;
+    uint32_t stat0;
+    uint32_t timer_intf;
+    Dma dma[8];
+    uint8_t tdata;
+    bool is_tdata_full;
+    bool is_shifting;
+    uint64_t shift_end;
+    uint64_t tc_hold_end; ///< HoldTransmitComplete()
+    bool is_driving;
+    bool is_break;
+    uint64_t receive_end;
+};
+
+State s;
+std::deque<Rx> s_rx;
+std::vector<mock::dmx::Event> s_events;
+mock::dmx::Statistics s_statistics;
+bool s_in_irq;
+bool s_is_mapped;
+
+void Map(uintptr_t base, size_t size) {
+    auto* p = mmap(reinterpret_cast<void*>(base), size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (p != reinterpret_cast<void*>(base)) {
+        fprintf(stderr, "mock::dmx: cannot map the registers at %p\n", reinterpret_cast<void*>(base));
+        exit(EXIT_FAILURE);
+    }
+}
+
+void Log(mock::dmx::Event::Type type, uint8_t data = 0) {
+    s_events.push_back({s.micros, type, data});
+}
+
+void SyncGpio(uint32_t gpio) {
+    const auto kBop = GPIO_BOP(gpio);
+    const auto kBc = GPIO_BC(gpio);
+
+    if ((kBop | kBc) == 0) {
+        return;
+    }
+
+    auto octl = GPIO_OCTL(gpio);
+    octl = (octl | (kBop & 0xFFFFU)) & ~(kBop >> 16);
+    octl &= ~(kBc & 0xFFFFU);
+    GPIO_OCTL(gpio) = octl;
+    GPIO_BOP(gpio) = 0;
+    GPIO_BC(gpio) = 0;
+}
+
+void SyncDma(uint32_t channel) {
+    auto& dma = s.dma[channel];
+    const auto kChctl = DMA_CHCTL(DMA0, channel);
+    const auto kIsEnabled = (kChctl & DMA_CHXCTL_CHEN) != 0;
+
+    // Disabled, configured and enabled again in one go is seen as a new count or address
+    if (kIsEnabled && (!dma.is_enabled || (DMA_CHCNT(DMA0, channel) != dma.cnt) || (DMA_CHMADDR(DMA0, channel) != dma.maddr))) {
+        dma.maddr = DMA_CHMADDR(DMA0, channel);
+        dma.number = DMA_CHCNT(DMA0, channel);
+        dma.index = 0;
+    }
+
+    dma.is_enabled = kIsEnabled;
+    dma.cnt = DMA_CHCNT(DMA0, channel);
+}
+
+/**
+ * Takes what the driver wrote.
+ */
+void Sync() {
+    SyncGpio(kDirGpio);
+    SyncGpio(kTxGpio);
+
+    s.stat0 &= (USART_STAT0(USART2) | ~kStat0W0);
+    USART_STAT0(USART2) = s.stat0;
+
+    s.timer_intf &= TIMER_INTF(TIMER1);
+    TIMER_INTF(TIMER1) = s.timer_intf;
+
+    // Clearing the global flag of a channel clears all four of its flags
+    auto intc = DMA_INTC(DMA0);
+    for (uint32_t channel = 0; channel < 8; channel++) {
+        if (intc & DMA_FLAG_ADD(DMA_INTF_GIF, channel)) {
+            intc |= DMA_FLAG_ADD(DMA_INTF_GIF | DMA_INTF_FTFIF | DMA_INTF_HTFIF | DMA_INTF_ERRIF, channel);
+        }
+    }
+    DMA_INTF(DMA0) &= ~intc;
+    DMA_INTC(DMA0) = 0;
+
+    SyncDma(kTxChannel);
+    SyncDma(kRxChannel);
+
+    const auto kIsDriving = (GPIO_OCTL(kDirGpio) & kDirPin) != 0;
+
+    if (kIsDriving != s.is_driving) {
+        s.is_driving = kIsDriving;
+        Log(kIsDriving ? mock::dmx::Event::Type::kDriverOn : mock::dmx::Event::Type::kDriverOff);
+    }
+
+    // TX pin mode: GPIO output push-pull 0x3, alternate function push-pull 0xB
+    const auto kMode = (GPIO_CTL1(kTxGpio) >> ((kTxPin - 8) * 4)) & 0xFU;
+    const auto kIsBreak = kIsDriving && (kMode & 0x3U) && !(kMode & 0x8U) && !(GPIO_OCTL(kTxGpio) & BIT(kTxPin));
+
+    if (kIsBreak != s.is_break) {
+        s.is_break = kIsBreak;
+        if (kIsDriving) {
+            Log(kIsBreak ? mock::dmx::Event::Type::kBreak : mock::dmx::Event::Type::kMark);
+        }
+    }
+}
+
+void DmaFlag(uint32_t channel, uint32_t flags) {
+    DMA_INTF(DMA0) |= DMA_FLAG_ADD(flags | DMA_INTF_GIF, channel);
+}
+
+/**
+ * One transfer, the count is reloaded in circular mode.
+ */
+uint32_t DmaNext(uint32_t channel) {
+    auto& dma = s.dma[channel];
+    const auto kAddress = dma.maddr + dma.index;
+
+    dma.index++;
+    dma.cnt--;
+
+    if (dma.cnt == dma.number / 2) {
+        DmaFlag(channel, DMA_INTF_HTFIF);
+    }
+
+    if (dma.cnt == 0) {
+        DmaFlag(channel, DMA_INTF_FTFIF);
+
+        if (DMA_CHCTL(DMA0, channel) & DMA_CHXCTL_CMEN) {
+            dma.cnt = dma.number;
+            dma.index = 0;
+        }
+    }
+
+    DMA_CHCNT(DMA0, channel) = dma.cnt;
+    return kAddress;
+}
+
+bool IsDmaRequest(uint32_t channel, uint32_t usart_enable) {
+    const auto& dma = s.dma[channel];
+    return dma.is_enabled && (dma.cnt != 0) && (USART_CTL2(USART2) & usart_enable);
+}
+
+void TransmitFill() {
+    if (s.is_tdata_full || !IsDmaRequest(kTxChannel, USART_CTL2_DENT)) {
+        return;
+    }
+
+    // The buffers are below 4 GiB, the host build is not position independent
+    s.tdata = *reinterpret_cast<const uint8_t*>(static_cast<uintptr_t>(DmaNext(kTxChannel)));
+    s.is_tdata_full = true;
+    s.stat0 &= ~(USART_STAT0_TBE | USART_STAT0_TC);
+}
+
+void Transmit() {
+    if (s.is_shifting && (s.micros >= s.shift_end)) {
+        s.is_shifting = false;
+    }
+
+    TransmitFill();
+
+    if (!s.is_shifting && s.is_tdata_full) {
+        s.is_shifting = true;
+        s.shift_end = s.micros + mock::dmx::kSlotMicros;
+        s.is_tdata_full = false;
+        s.stat0 |= USART_STAT0_TBE;
+        s_statistics.tx_slots++;
+        Log(mock::dmx::Event::Type::kSlot, s.tdata);
+        TransmitFill();
+    }
+
+    if (s.micros < s.tc_hold_end) {
+        return;
+    }
+
+    if (!s.is_shifting && !s.is_tdata_full && ((s.shift_end == s.micros) || (s.tc_hold_end == s.micros))) {
+        s.stat0 |= USART_STAT0_TC;
+    }
+}
+
+void ReceiveSlot(uint8_t data, uint32_t flags) {
+    s_statistics.rx_slots++;
+
+    if (s.stat0 & USART_STAT0_RBNE) {
+        s.stat0 |= USART_STAT0_ORERR;
+        s_statistics.overruns++;
+        return;
+    }
+
+    USART_DATA(USART2) = data;
+    s.stat0 |= USART_STAT0_RBNE | flags;
+
+    if (IsDmaRequest(kRxChannel, USART_CTL2_DENR)) {
+        *reinterpret_cast<uint8_t*>(static_cast<uintptr_t>(DmaNext(kRxChannel))) = data;
+        s.stat0 &= ~USART_STAT0_RBNE;
+        s_statistics.rx_dma_slots++;
+    }
+}
+
+void Receive() {
+    const auto kIsEnabled = (USART_CTL0(USART2) & (USART_CTL0_UEN | USART_CTL0_REN)) == (USART_CTL0_UEN | USART_CTL0_REN);
+
+    while (!s_rx.empty() && (s_rx.front().micros <= s.micros)) {
+        const auto kRx = s_rx.front();
+        s_rx.pop_front();
+
+        // The receiver of the transceiver is off while it drives the line
+        if (!kIsEnabled || s.is_driving) {
+            continue;
+        }
+
+        switch (kRx.type) {
+            case Rx::Type::kFrameError:
+                ReceiveSlot(0, USART_STAT0_FERR);
+                break;
+            case Rx::Type::kSlot:
+                ReceiveSlot(kRx.data, 0);
+                break;
+            case Rx::Type::kIdle:
+                s.stat0 |= USART_STAT0_IDLEF;
+                break;
+        }
+    }
+}
+
+void Timer() {
+    if ((TIMER_CTL0(TIMER1) & TIMER_CTL0_CEN) == 0) {
+        return;
+    }
+
+    // TIMER1 is 16-bit on the GD32F30x, the driver sets the period and the compare values as if it were not
+    const auto kCnt = (TIMER_CNT(TIMER1) + 1) & 0xFFFFU;
+    TIMER_CNT(TIMER1) = kCnt;
+
+    const uint32_t kCv[4] = {TIMER_CH0CV(TIMER1), TIMER_CH1CV(TIMER1), TIMER_CH2CV(TIMER1), TIMER_CH3CV(TIMER1)};
+
+    for (uint32_t i = 0; i < 4; i++) {
+        if ((kCv[i] & 0xFFFFU) == kCnt) {
+            s.timer_intf |= TIMER_INTF_CH0IF << i;
+        }
+    }
+
+    TIMER_INTF(TIMER1) = s.timer_intf;
+}
+
+/*
+ * The driver enables its interrupts at the NVIC once and never disables them.
+ * ISER is write-one-to-set, which plain memory cannot show, the NVIC is taken as enabled.
+ */
+
+bool IsDmaPending(uint32_t channel) {
+    return ((DMA_INTF(DMA0) >> (channel * 4)) & DMA_CHCTL(DMA0, channel) & kDmaInterrupts) != 0;
+}
+
+bool IsUsartPending() {
+    const auto kCtl0 = USART_CTL0(USART2);
+    const auto kIsRbne = (kCtl0 & USART_CTL0_RBNEIE) && (s.stat0 & (USART_STAT0_RBNE | USART_STAT0_ORERR));
+    const auto kIsIdle = (kCtl0 & USART_CTL0_IDLEIE) && (s.stat0 & USART_STAT0_IDLEF);
+    const auto kIsError = (USART_CTL2(USART2) & USART_CTL2_ERRIE) && (s.stat0 & kStat0Errors);
+    return kIsRbne || kIsIdle || kIsError;
+}
+
+void Handle(void (*handler)()) {
+    const auto kStart = std::chrono::steady_clock::now();
+    handler();
+    s_statistics.handler_nanos += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - kStart).count());
+}
+
+/**
+ * All at the same priority, the lowest IRQn first as the NVIC does.
+ */
+bool DispatchOne() {
+    if (IsDmaPending(kTxChannel)) {
+        s_statistics.tx_dma_irqs++;
+        Handle(DMA0_Channel1_IRQHandler);
+        return true;
+    }
+
+    if ((DMA0_Channel2_IRQHandler != nullptr) && IsDmaPending(kRxChannel)) {
+        s_statistics.rx_dma_irqs++;
+        Handle(DMA0_Channel2_IRQHandler);
+        return true;
+    }
+
+    const auto kTimerPending = s.timer_intf & TIMER_DMAINTEN(TIMER1) & (TIMER_INTF_CH0IF | TIMER_INTF_CH1IF | TIMER_INTF_CH2IF | TIMER_INTF_CH3IF);
+
+    if (kTimerPending != 0) {
+        s_statistics.timer_irqs++;
+        Handle(TIMER1_IRQHandler);
+        // The handler clears each channel it serves and then writes UINT32_MAX, which hides those clears from the memory map
+        s.timer_intf &= ~kTimerPending;
+        TIMER_INTF(TIMER1) = s.timer_intf;
+        return true;
+    }
+
+    if (IsUsartPending()) {
+        s_statistics.usart_irqs++;
+        Handle(USART2_IRQHandler);
+        // The handler reads STAT0 and then DATA, which clears them
+        s.stat0 &= ~(USART_STAT0_RBNE | USART_STAT0_IDLEF | kStat0Errors);
+        USART_STAT0(USART2) = s.stat0;
+        return true;
+    }
+
+    return false;
+}
+
+void Dispatch() {
+    for (uint32_t count = 0;; count++) {
+        if ((mock_primask != 0) || s_in_irq) {
+            return;
+        }
+
+        if (count == kStormCount) {
+            s_statistics.irq_storms++;
+            return;
+        }
+
+        s_in_irq = true;
+        const auto kIsTaken = DispatchOne();
+        s_in_irq = false;
+
+        if (!kIsTaken) {
+            return;
+        }
+
+        Sync();
+    }
+}
+
+void Tick() {
+    Sync();
+
+    s.micros++;
+    DWT->CYCCNT = DWT->CYCCNT + (MCU_CLOCK_FREQ / 1000000U);
+
+    Timer();
+    Transmit();
+    Receive();
+
+    USART_STAT0(USART2) = s.stat0;
+    Dispatch();
+}
+} // namespace
+
+extern "C" void mock_barrier(void) {
+    Tick();
+}
+
+namespace mock::dmx {
+void Init() {
+    if (!s_is_mapped) {
+        Map(kPeripheralBase, kPeripheralSize);
+        Map(kCoreBase, kCoreSize);
+        s_is_mapped = true;
+    }
+
+    memset(reinterpret_cast<void*>(kPeripheralBase), 0, kPeripheralSize);
+    memset(reinterpret_cast<void*>(kCoreBase), 0, kCoreSize);
+
+    s = State{};
+    s.stat0 = USART_STAT0_TBE | USART_STAT0_TC;
+    USART_STAT0(USART2) = s.stat0;
+
+    s_rx.clear();
+    s_events.clear();
+    s_statistics = Statistics{};
+    s_in_irq = false;
+    mock_primask = 0;
+}
+
+uint64_t GetMicros() { return s.micros; }
+
+void Step(uint32_t micros) {
+    for (uint32_t i = 0; i < micros; i++) {
+        Tick();
+    }
+}
+
+void Receive(const uint8_t* data, uint32_t length, uint32_t break_micros, uint32_t mab_micros) {
+    auto micros = s.micros;
+
+    if (break_micros != 0) {
+        // The BREAK is seen as a slot of zeros, its frame error is at the stop bits
+        s_rx.push_back({micros + kSlotMicros, Rx::Type::kFrameError, 0});
+        micros += break_micros + mab_micros;
+    }
+
+    for (uint32_t i = 0; i < length; i++) {
+        micros += kSlotMicros;
+        s_rx.push_back({micros, Rx::Type::kSlot, data[i]});
+    }
+
+    s.receive_end = micros;
+    s_rx.push_back({micros + kSlotMicros, Rx::Type::kIdle, 0});
+}
+
+uint64_t GetReceiveEnd() { return s.receive_end; }
+
+void HoldTransmitComplete(uint32_t micros) {
+    if (micros == 0) {
+        s.tc_hold_end = s.micros + 1;
+        return;
+    }
+
+    s.stat0 &= ~USART_STAT0_TC;
+    USART_STAT0(USART2) = s.stat0;
+    s.tc_hold_end = (micros == UINT32_MAX) ? UINT64_MAX : (s.micros + micros);
+}
+
+bool IsDriving() { return s.is_driving; }
+
+const std::vector<Event>& GetEvents() { return s_events; }
+
+void ClearEvents() { s_events.clear(); }
+
+const Statistics& GetStatistics() { return s_statistics; }
+
+void ResetStatistics() { s_statistics = Statistics{}; }
+} // namespace mock::dmx
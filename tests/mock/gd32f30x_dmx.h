@@ -0,0 +1,107 @@
+/**
+ * @file gd32f30x_dmx.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef GD32F30X_DMX_H_
+#define GD32F30X_DMX_H_
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Host model of the GD32F303RC DMX port: USART2 (partial remap, TX on PC10), its DMA0 channels 1 and 2,
+ * the TIMER1 compare channel 2, the data direction pin PB10 and the DWT cycle counter.
+ *
+ * lib-dmx dmx.cpp is built with the real device headers, it is too register heavy for a mock per register.
+ * The peripheral register space is mapped at the device addresses instead. The model takes what the driver
+ * wrote every simulated microsecond and after every interrupt handler, as the hardware would.
+ * A slot takes 44 us, 250 kbaud 8N2.
+ *
+ * __DMB() takes a microsecond, so that the busy waits of the driver see the USART progress.
+ */
+
+namespace mock::dmx {
+inline constexpr uint32_t kSlotMicros = 44;
+
+/**
+ * What the port does on the line, it drives the line only while the data direction pin is high.
+ */
+struct Event {
+    enum class Type : uint8_t { kDriverOn, kDriverOff, kBreak, kMark, kSlot };
+    uint64_t micros;
+    Type type;
+    uint8_t data; ///< kSlot
+};
+
+/**
+ * Maps and resets the register space, before the Dmx is constructed.
+ */
+void Init();
+
+uint64_t GetMicros();
+
+/**
+ * Runs the simulated time for micros, the pending interrupts are taken every microsecond.
+ */
+void Step(uint32_t micros);
+
+/**
+ * Another device sends a packet, starting now: a BREAK and a MAB, then the slots back to back.
+ * With break_micros 0 there is no BREAK, as for a discovery response.
+ * Nothing is received while the port drives the line.
+ */
+void Receive(const uint8_t* data, uint32_t length, uint32_t break_micros = 176, uint32_t mab_micros = 12);
+/**
+ * The end of the stop bits of the last slot received.
+ */
+uint64_t GetReceiveEnd();
+
+/**
+ * USART_FLAG_TC reads 0 for micros, as if a slot were still shifted out. With UINT32_MAX it is never set again, a wedged USART.
+ * With 0 the hold ends, TC is set on the next microsecond when the USART is idle.
+ */
+void HoldTransmitComplete(uint32_t micros);
+
+bool IsDriving();
+const std::vector<Event>& GetEvents();
+void ClearEvents();
+
+struct Statistics {
+    uint32_t usart_irqs;
+    uint32_t tx_dma_irqs;
+    uint32_t rx_dma_irqs;
+    uint32_t timer_irqs;
+    uint32_t rx_slots;    ///< Slots received, the BREAK slots included
+    uint32_t rx_dma_slots; ///< Slots the receive DMA moved to memory
+    uint32_t tx_slots;
+    uint32_t overruns; ///< A slot arrived before the previous one was read
+    uint32_t irq_storms; ///< An interrupt that stays pending after its handler returned, 16 times in a row
+    uint64_t handler_nanos; ///< Host time in the interrupt handlers, for comparisons on the same host only
+};
+
+const Statistics& GetStatistics();
+void ResetStatistics();
+} // namespace mock::dmx
+
+#endif // GD32F30X_DMX_H_
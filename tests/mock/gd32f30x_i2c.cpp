@@ -0,0 +1,549 @@
+/**
+ * @file gd32f30x_i2c.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cassert>
+
+#include "gd32.h"
+
+// Without CONFIG_I2C_ASYNC lib-gd32 has no handlers, the interrupts are then never enabled
+extern "C" {
+void I2C0_EV_IRQHandler() __attribute__((weak));
+void I2C0_ER_IRQHandler() __attribute__((weak));
+}
+
+namespace {
+/*
+ * kStretched: the master holds SCL low, no byte in progress.
+ * kAddressed: ADDSEND is set, SCL is held low until it is cleared.
+ */
+enum class Phase { kIdle, kStart, kAddress, kAddressed, kTransmit, kReceive, kStretched, kStop };
+
+constexpr uint32_t kStat0Errors = I2C_STAT0_BERR | I2C_STAT0_LOSTARB | I2C_STAT0_AERR | I2C_STAT0_OUERR;
+constexpr uint32_t kStormCount = 16;
+
+struct State {
+    uint32_t ctl0;
+    uint32_t ctl1;
+    uint32_t stat0;
+    uint32_t stat1;
+    uint8_t data;
+    uint8_t shift;
+    bool is_data_full;  ///< Transmitter: DATA holds a byte that is not shifted out yet
+    bool is_shift_full; ///< Receiver: a byte waits in the shift register, BTC is set
+    bool is_read;
+    bool is_stat0_read;
+    bool is_start_pending;
+    bool is_stop_pending;
+    bool next_ack; ///< POAP: ACKEN is taken one byte ahead
+    bool byte_ack;
+    bool last_ack;
+    Phase phase;
+    uint64_t event_micros;
+    uint64_t busy_until_micros; ///< Another master holds the bus
+    mock::i2c0::Target* target;
+};
+
+State s;
+mock::i2c0::Target* s_targets[128];
+mock::i2c0::Statistics s_statistics;
+uint32_t s_speed = 100000;
+bool s_is_lose_next;
+bool s_is_hung;
+bool s_in_irq;
+
+uint32_t BitMicros() { return (1000000U + s_speed - 1) / s_speed; }
+uint32_t ByteMicros() { return (9000000U + s_speed - 1) / s_speed; }
+
+void Schedule(Phase phase, uint32_t micros) {
+    s.phase = phase;
+    s.event_micros = mock::GetMicros() + micros;
+}
+
+// A START or STOP condition also clears TBE and BTC
+void BeginStart() {
+    s.is_start_pending = false;
+    s.stat0 &= ~(I2C_STAT0_TBE | I2C_STAT0_BTC);
+    Schedule(Phase::kStart, BitMicros());
+}
+
+void BeginStop() {
+    if (s.is_read && s.last_ack) {
+        s_statistics.last_byte_acked++;
+    }
+
+    s.is_stop_pending = false;
+    s.stat0 &= ~(I2C_STAT0_TBE | I2C_STAT0_BTC);
+    Schedule(Phase::kStop, BitMicros());
+}
+
+void Continue() {
+    if (s.is_stop_pending) {
+        BeginStop();
+        return;
+    }
+
+    if (s.is_start_pending) {
+        BeginStart();
+        return;
+    }
+
+    s.phase = Phase::kStretched;
+}
+
+void BeginReceive() {
+    s.byte_ack = s.next_ack;
+    s.next_ack = (s.ctl0 & I2C_CTL0_ACKEN) != 0;
+    Schedule(Phase::kReceive, ByteMicros());
+}
+
+void LoseArbitration() {
+    s_is_lose_next = false;
+    s.stat0 |= I2C_STAT0_LOSTARB;
+    s.stat1 = (s.stat1 & ~(I2C_STAT1_MASTER | I2C_STAT1_TR)) | I2C_STAT1_I2CBSY;
+    s.ctl0 &= ~(I2C_CTL0_START | I2C_CTL0_STOP);
+    s.is_start_pending = false;
+    s.is_stop_pending = false;
+    s.is_data_full = false;
+    s.target = nullptr;
+    s.phase = Phase::kIdle;
+    s.busy_until_micros = mock::GetMicros() + 10U * ByteMicros();
+}
+
+void EndStart() {
+    s.ctl0 &= ~I2C_CTL0_START;
+    s.stat0 |= I2C_STAT0_SBSEND;
+    s.stat1 |= I2C_STAT1_MASTER | I2C_STAT1_I2CBSY;
+    s.phase = Phase::kStretched;
+
+    if (s.is_stop_pending) {
+        BeginStop();
+    }
+}
+
+void EndStop() {
+    s.ctl0 &= ~I2C_CTL0_STOP;
+    s.stat1 &= ~(I2C_STAT1_MASTER | I2C_STAT1_TR | I2C_STAT1_I2CBSY);
+    s.phase = Phase::kIdle;
+    s_statistics.stops++;
+
+    if (s.target != nullptr) {
+        s.target->Stop();
+        s.target = nullptr;
+    }
+}
+
+void EndAddress() {
+    if (s_is_lose_next) {
+        LoseArbitration();
+        return;
+    }
+
+    auto* target = s_targets[s.shift >> 1];
+
+    if ((target == nullptr) || !target->Address(s.is_read)) {
+        s.stat0 |= I2C_STAT0_AERR;
+        Continue();
+        return;
+    }
+
+    s.target = target;
+    s.stat0 |= I2C_STAT0_ADDSEND;
+    s.stat1 = s.is_read ? (s.stat1 & ~I2C_STAT1_TR) : (s.stat1 | I2C_STAT1_TR);
+    s.phase = Phase::kAddressed;
+}
+
+void EndTransmit() {
+    if (s_is_lose_next) {
+        LoseArbitration();
+        return;
+    }
+
+    if (!s.target->Write(s.shift)) {
+        s.stat0 |= I2C_STAT0_AERR;
+        s.is_data_full = false;
+        Continue();
+        return;
+    }
+
+    if (s.is_data_full) {
+        s.shift = s.data;
+        s.is_data_full = false;
+        s.stat0 |= I2C_STAT0_TBE;
+        Schedule(Phase::kTransmit, ByteMicros());
+        return;
+    }
+
+    s.stat0 |= I2C_STAT0_BTC;
+    Continue();
+}
+
+void EndReceive() {
+    const auto kData = s.target->Read();
+    const auto kAck = (s.ctl0 & I2C_CTL0_POAP) ? s.byte_ack : ((s.ctl0 & I2C_CTL0_ACKEN) != 0);
+
+    s.last_ack = kAck;
+
+    if ((s.stat0 & I2C_STAT0_RBNE) == 0) {
+        s.data = kData;
+        s.stat0 |= I2C_STAT0_RBNE;
+
+        if (!s.is_stop_pending && !s.is_start_pending && kAck) {
+            BeginReceive();
+            return;
+        }
+
+        Continue();
+        return;
+    }
+
+    // DATA is not read yet, SCL is held low
+    s.shift = kData;
+    s.is_shift_full = true;
+    s.stat0 |= I2C_STAT0_BTC;
+    Continue();
+}
+
+void AddressCleared() {
+    if (s.is_read) {
+        BeginReceive();
+        return;
+    }
+
+    s.stat0 |= I2C_STAT0_TBE;
+    Continue();
+}
+
+void Update() {
+    if (s_is_hung) {
+        return;
+    }
+
+    while (true) {
+        const auto kNow = mock::GetMicros();
+
+        switch (s.phase) {
+            case Phase::kStart:
+            case Phase::kAddress:
+            case Phase::kTransmit:
+            case Phase::kReceive:
+            case Phase::kStop:
+                if (kNow < s.event_micros) {
+                    return;
+                }
+                break;
+            case Phase::kIdle:
+                if ((s.busy_until_micros != 0) && (kNow >= s.busy_until_micros)) {
+                    s.busy_until_micros = 0;
+                    s.stat1 &= ~I2C_STAT1_I2CBSY;
+                }
+                if (s.is_start_pending && ((s.stat1 & I2C_STAT1_I2CBSY) == 0)) {
+                    BeginStart();
+                    continue;
+                }
+                return;
+            default:
+                return;
+        }
+
+        switch (s.phase) {
+            case Phase::kStart:
+                EndStart();
+                break;
+            case Phase::kAddress:
+                EndAddress();
+                break;
+            case Phase::kTransmit:
+                EndTransmit();
+                break;
+            case Phase::kReceive:
+                EndReceive();
+                break;
+            case Phase::kStop:
+                EndStop();
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void Reset() {
+    s = State{};
+    s.next_ack = true;
+    s_is_lose_next = false;
+    s_is_hung = false;
+}
+
+void WriteCtl0(uint32_t value) {
+    const auto kRising = value & ~s.ctl0;
+    s.ctl0 = value;
+
+    if (kRising & I2C_CTL0_SRESET) {
+        Reset();
+        s.ctl0 = I2C_CTL0_SRESET;
+        return;
+    }
+
+    const auto kIsMaster = (s.stat1 & I2C_STAT1_MASTER) != 0;
+
+    if (kRising & I2C_CTL0_STOP) {
+        if (kIsMaster || (s.phase == Phase::kStart)) {
+            s.is_stop_pending = true;
+        } else {
+            s.ctl0 &= ~I2C_CTL0_STOP;
+        }
+    }
+
+    if (kRising & I2C_CTL0_START) {
+        s.is_start_pending = true;
+    }
+
+    if (kIsMaster && (s.phase == Phase::kStretched) && (s.is_stop_pending || s.is_start_pending) && ((s.stat0 & I2C_STAT0_SBSEND) == 0)) {
+        Continue();
+    }
+}
+
+void WriteData(uint8_t value) {
+    if (s.stat0 & I2C_STAT0_SBSEND) {
+        s.stat0 &= ~I2C_STAT0_SBSEND;
+        s.shift = value;
+        s.is_read = (value & 1) != 0;
+        s.last_ack = false;
+        s.next_ack = (s.ctl0 & I2C_CTL0_ACKEN) != 0;
+        Schedule(Phase::kAddress, ByteMicros());
+        return;
+    }
+
+    if ((s.stat1 & (I2C_STAT1_MASTER | I2C_STAT1_TR)) != (I2C_STAT1_MASTER | I2C_STAT1_TR)) {
+        return;
+    }
+
+    s.stat0 &= ~I2C_STAT0_BTC;
+
+    if (s.phase == Phase::kStretched) {
+        s.shift = value;
+        s.stat0 |= I2C_STAT0_TBE;
+        Schedule(Phase::kTransmit, ByteMicros());
+        return;
+    }
+
+    s.data = value;
+    s.is_data_full = true;
+    s.stat0 &= ~I2C_STAT0_TBE;
+}
+
+uint8_t ReadData() {
+    const auto kData = s.data;
+
+    if ((s.stat0 & I2C_STAT0_RBNE) == 0) {
+        return kData;
+    }
+
+    s.stat0 &= ~I2C_STAT0_RBNE;
+
+    if (s.is_shift_full) {
+        s.data = s.shift;
+        s.is_shift_full = false;
+        s.stat0 = (s.stat0 & ~I2C_STAT0_BTC) | I2C_STAT0_RBNE;
+
+        if ((s.phase == Phase::kStretched) && s.last_ack && (s.stat1 & I2C_STAT1_MASTER)) {
+            BeginReceive();
+        }
+    }
+
+    return kData;
+}
+
+void Dispatch() {
+    for (uint32_t count = 0;; count++) {
+        if (mock::primask != 0) {
+            return;
+        }
+
+        const auto kError = mock::nvic_enabled[I2C0_ER_IRQn] && (s.ctl1 & I2C_CTL1_ERRIE) && (s.stat0 & kStat0Errors);
+        const auto kEvent = mock::nvic_enabled[I2C0_EV_IRQn] && (s.ctl1 & I2C_CTL1_EVIE) &&
+                            ((s.stat0 & (I2C_STAT0_SBSEND | I2C_STAT0_ADDSEND | I2C_STAT0_BTC)) ||
+                             ((s.ctl1 & I2C_CTL1_BUFIE) && (s.stat0 & (I2C_STAT0_TBE | I2C_STAT0_RBNE))));
+
+        if (!kError && !kEvent) {
+            return;
+        }
+
+        if (count == kStormCount) {
+            s_statistics.irq_storms++;
+            return;
+        }
+
+        s_in_irq = true;
+        s_statistics.irqs++;
+
+        if (kError) {
+            I2C0_ER_IRQHandler();
+        } else {
+            I2C0_EV_IRQHandler();
+        }
+
+        s_in_irq = false;
+    }
+}
+
+void Access() {
+    if (s_in_irq) {
+        s_statistics.irq_accesses++;
+    } else {
+        s_statistics.thread_accesses++;
+    }
+}
+} // namespace
+
+namespace mock::i2c0 {
+uint32_t Read([[maybe_unused]] uint32_t periph, Register reg) {
+    assert(periph == I2C0);
+    Access();
+
+    if (!s_in_irq) {
+        mock::Advance(1);
+    }
+
+    Update();
+
+    switch (reg) {
+        case Register::kCtl0:
+            return s.ctl0;
+        case Register::kCtl1:
+            return s.ctl1;
+        case Register::kData:
+            return ReadData();
+        case Register::kStat0:
+            s.is_stat0_read = true;
+            return s.stat0;
+        case Register::kStat1: {
+            const auto kStat1 = s.stat1;
+
+            if (s.is_stat0_read && (s.stat0 & I2C_STAT0_ADDSEND)) {
+                s.stat0 &= ~I2C_STAT0_ADDSEND;
+                AddressCleared();
+            }
+
+            s.is_stat0_read = false;
+            return kStat1;
+        }
+        default:
+            break;
+    }
+
+    return 0;
+}
+
+void Write([[maybe_unused]] uint32_t periph, Register reg, uint32_t value) {
+    assert(periph == I2C0);
+    Access();
+    Update();
+
+    switch (reg) {
+        case Register::kCtl0:
+            WriteCtl0(value);
+            break;
+        case Register::kCtl1:
+            s.ctl1 = value;
+            break;
+        case Register::kData:
+            WriteData(static_cast<uint8_t>(value));
+            break;
+        case Register::kStat0:
+            // The error flags are cleared by writing 0, the others are read only
+            s.stat0 &= (value | ~kStat0Errors);
+            break;
+        default:
+            break;
+    }
+
+    Update();
+}
+
+void Attach(uint8_t address, Target* target) { s_targets[address & 0x7F] = target; }
+
+void Step(uint32_t micros) {
+    for (uint32_t i = 0; i < micros; i++) {
+        mock::Advance(1);
+        Update();
+        Dispatch();
+    }
+}
+
+void InjectArbitrationLoss() { s_is_lose_next = true; }
+void InjectHang() { s_is_hung = true; }
+
+const Statistics& GetStatistics() { return s_statistics; }
+void ResetStatistics() { s_statistics = Statistics{}; }
+
+void Reset() {
+    ::Reset();
+    s_speed = 100000;
+}
+} // namespace mock::i2c0
+
+void i2c_clock_config([[maybe_unused]] uint32_t i2c_periph, uint32_t clkspeed, [[maybe_unused]] uint32_t dutycyc) {
+    assert(clkspeed != 0);
+    s_speed = clkspeed;
+}
+
+void i2c_enable(uint32_t i2c_periph) { I2C_CTL0(i2c_periph) |= I2C_CTL0_I2CEN; }
+
+void i2c_ack_config(uint32_t i2c_periph, uint32_t ack) { I2C_CTL0(i2c_periph) = (I2C_CTL0(i2c_periph) & ~I2C_CTL0_ACKEN) | ack; }
+
+void i2c_ackpos_config(uint32_t i2c_periph, uint32_t pos) { I2C_CTL0(i2c_periph) = (I2C_CTL0(i2c_periph) & ~I2C_CTL0_POAP) | pos; }
+
+void i2c_master_addressing(uint32_t i2c_periph, uint32_t addr, uint32_t trandirection) {
+    if (trandirection == I2C_TRANSMITTER) {
+        addr &= I2C_TRANSMITTER;
+    } else {
+        addr |= I2C_RECEIVER;
+    }
+
+    I2C_DATA(i2c_periph) = addr;
+}
+
+void i2c_start_on_bus(uint32_t i2c_periph) { I2C_CTL0(i2c_periph) |= I2C_CTL0_START; }
+void i2c_stop_on_bus(uint32_t i2c_periph) { I2C_CTL0(i2c_periph) |= I2C_CTL0_STOP; }
+void i2c_data_transmit(uint32_t i2c_periph, uint8_t data) { I2C_DATA(i2c_periph) = data; }
+uint8_t i2c_data_receive(uint32_t i2c_periph) { return static_cast<uint8_t>(I2C_DATA(i2c_periph)); }
+
+FlagStatus i2c_flag_get(uint32_t i2c_periph, i2c_flag_enum flag) {
+    const auto kReg = static_cast<mock::i2c0::Register>(static_cast<uint32_t>(flag) >> 6);
+    return ((mock::i2c0::Read(i2c_periph, kReg) >> (static_cast<uint32_t>(flag) & 0x1F)) & 1U) ? SET : RESET;
+}
+
+void i2c_flag_clear(uint32_t i2c_periph, i2c_flag_enum flag) {
+    if (flag == I2C_FLAG_ADDSEND) {
+        static_cast<void>(I2C_STAT0(i2c_periph));
+        static_cast<void>(I2C_STAT1(i2c_periph));
+        return;
+    }
+
+    const auto kReg = static_cast<mock::i2c0::Register>(static_cast<uint32_t>(flag) >> 6);
+    mock::i2c0::Write(i2c_periph, kReg, ~(1U << (static_cast<uint32_t>(flag) & 0x1F)));
+}
@@ -0,0 +1,228 @@
+/**
+ * @file gd32f30x_i2c.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef GD32F30X_I2C_H_
+#define GD32F30X_I2C_H_
+
+#include <cstdint>
+
+/**
+ * Host model of the I2C0 peripheral, with the registers and the standard peripheral functions that lib-gd32 gd32_i2c.cpp uses.
+ * The bus follows the simulated time, a byte takes 9 bit times at the configured speed.
+ *
+ * A register read outside an interrupt handler takes a microsecond, so that the polling loops see the bus progress.
+ * The interrupt handlers are run from mock::i2c0::Step(), as the NVIC would.
+ */
+
+#define I2C0 0x40005400U
+#define I2C1 0x40005800U
+
+namespace mock::i2c0 {
+enum class Register : uint32_t { kCtl0 = 0x00, kCtl1 = 0x04, kData = 0x10, kStat0 = 0x14, kStat1 = 0x18 };
+
+uint32_t Read(uint32_t periph, Register reg);
+void Write(uint32_t periph, Register reg, uint32_t value);
+
+/**
+ * A register access. REG32() is a volatile lvalue: a discarded access is a read too,
+ * and `const auto value = I2C_STAT0(...)` reads once, the value is kept.
+ */
+struct Reg {
+    uint32_t periph;
+    Register reg;
+    mutable uint32_t value{0};
+    mutable bool is_accessed{false};
+
+    Reg(uint32_t periph_, Register reg_) : periph(periph_), reg(reg_) {}
+    Reg(const Reg&) = delete;
+    Reg& operator=(const Reg&) = delete;
+
+    ~Reg() {
+        if (!is_accessed) {
+            Read(periph, reg);
+        }
+    }
+
+    operator uint32_t() const {
+        if (!is_accessed) {
+            is_accessed = true;
+            value = Read(periph, reg);
+        }
+        return value;
+    }
+
+    Reg& operator=(uint32_t data) {
+        is_accessed = true;
+        Write(periph, reg, data);
+        return *this;
+    }
+
+    Reg& operator|=(uint32_t data) {
+        Write(periph, reg, static_cast<uint32_t>(*this) | data);
+        return *this;
+    }
+
+    Reg& operator&=(uint32_t data) {
+        Write(periph, reg, static_cast<uint32_t>(*this) & data);
+        return *this;
+    }
+};
+
+/**
+ * A device on the bus, it acknowledges per byte.
+ */
+class Target {
+   public:
+    virtual ~Target() = default;
+    virtual bool Address(bool is_read) = 0;
+    virtual bool Write(uint8_t data) = 0;
+    virtual uint8_t Read() = 0;
+    virtual void Stop() {}
+};
+
+/**
+ * An address without a target is not acknowledged, nullptr detaches.
+ */
+void Attach(uint8_t address, Target* target);
+
+/**
+ * Runs the simulated time for micros, the pending interrupts are taken every microsecond.
+ */
+void Step(uint32_t micros);
+
+/**
+ * The next address or data byte loses the arbitration, another master then holds the bus for 10 byte times.
+ */
+void InjectArbitrationLoss();
+/**
+ * The peripheral stops at the byte in progress, as a glitch on the bus can leave it: only a software reset recovers it.
+ */
+void InjectHang();
+
+struct Statistics {
+    uint32_t irqs;
+    uint32_t irq_accesses;    ///< Register accesses from the interrupt handlers
+    uint32_t thread_accesses; ///< Register accesses outside the interrupt handlers
+    uint32_t stops;
+    uint32_t last_byte_acked; ///< The master acknowledged the byte before its STOP, the I2C specification requires a NACK
+    uint32_t irq_storms;      ///< An interrupt that stays pending after its handler returned, 16 times in a row
+};
+
+const Statistics& GetStatistics();
+void ResetStatistics();
+/**
+ * The peripheral registers after reset, the targets stay attached.
+ */
+void Reset();
+} // namespace mock::i2c0
+
+#define I2C_CTL0(i2cx) (mock::i2c0::Reg{(i2cx), mock::i2c0::Register::kCtl0})
+#define I2C_CTL1(i2cx) (mock::i2c0::Reg{(i2cx), mock::i2c0::Register::kCtl1})
+#define I2C_DATA(i2cx) (mock::i2c0::Reg{(i2cx), mock::i2c0::Register::kData})
+#define I2C_STAT0(i2cx) (mock::i2c0::Reg{(i2cx), mock::i2c0::Register::kStat0})
+#define I2C_STAT1(i2cx) (mock::i2c0::Reg{(i2cx), mock::i2c0::Register::kStat1})
+
+#define I2C_CTL0_I2CEN (1U << 0)
+#define I2C_CTL0_START (1U << 8)
+#define I2C_CTL0_STOP (1U << 9)
+#define I2C_CTL0_ACKEN (1U << 10)
+#define I2C_CTL0_POAP (1U << 11)
+#define I2C_CTL0_SRESET (1U << 15)
+
+#define I2C_CTL1_ERRIE (1U << 8)
+#define I2C_CTL1_EVIE (1U << 9)
+#define I2C_CTL1_BUFIE (1U << 10)
+
+#define I2C_STAT0_SBSEND (1U << 0)
+#define I2C_STAT0_ADDSEND (1U << 1)
+#define I2C_STAT0_BTC (1U << 2)
+#define I2C_STAT0_RBNE (1U << 6)
+#define I2C_STAT0_TBE (1U << 7)
+#define I2C_STAT0_BERR (1U << 8)
+#define I2C_STAT0_LOSTARB (1U << 9)
+#define I2C_STAT0_AERR (1U << 10)
+#define I2C_STAT0_OUERR (1U << 11)
+
+#define I2C_STAT1_MASTER (1U << 0)
+#define I2C_STAT1_I2CBSY (1U << 1)
+#define I2C_STAT1_TR (1U << 2)
+
+#define I2C_REGIDX_BIT(regidx, bitpos) ((static_cast<uint32_t>(regidx) << 6) | static_cast<uint32_t>(bitpos))
+
+typedef enum { RESET = 0, SET = !RESET } FlagStatus;
+
+typedef enum {
+    I2C_FLAG_SBSEND = I2C_REGIDX_BIT(0x14U, 0U),
+    I2C_FLAG_ADDSEND = I2C_REGIDX_BIT(0x14U, 1U),
+    I2C_FLAG_BTC = I2C_REGIDX_BIT(0x14U, 2U),
+    I2C_FLAG_RBNE = I2C_REGIDX_BIT(0x14U, 6U),
+    I2C_FLAG_TBE = I2C_REGIDX_BIT(0x14U, 7U),
+    I2C_FLAG_LOSTARB = I2C_REGIDX_BIT(0x14U, 9U),
+    I2C_FLAG_AERR = I2C_REGIDX_BIT(0x14U, 10U),
+    I2C_FLAG_MASTER = I2C_REGIDX_BIT(0x18U, 0U),
+    I2C_FLAG_I2CBSY = I2C_REGIDX_BIT(0x18U, 1U),
+    I2C_FLAG_TRS = I2C_REGIDX_BIT(0x18U, 2U)
+} i2c_flag_enum;
+
+#define I2C_RECEIVER 0x00000001U
+#define I2C_TRANSMITTER 0xFFFFFFFEU
+#define I2C_ACK_DISABLE 0x00000000U
+#define I2C_ACK_ENABLE I2C_CTL0_ACKEN
+#define I2C_ACKPOS_CURRENT 0x00000000U
+#define I2C_ACKPOS_NEXT I2C_CTL0_POAP
+#define I2C_DTCY_2 0x00000000U
+
+void i2c_clock_config(uint32_t i2c_periph, uint32_t clkspeed, uint32_t dutycyc);
+void i2c_enable(uint32_t i2c_periph);
+void i2c_ack_config(uint32_t i2c_periph, uint32_t ack);
+void i2c_ackpos_config(uint32_t i2c_periph, uint32_t pos);
+void i2c_master_addressing(uint32_t i2c_periph, uint32_t addr, uint32_t trandirection);
+void i2c_start_on_bus(uint32_t i2c_periph);
+void i2c_stop_on_bus(uint32_t i2c_periph);
+void i2c_data_transmit(uint32_t i2c_periph, uint8_t data);
+uint8_t i2c_data_receive(uint32_t i2c_periph);
+FlagStatus i2c_flag_get(uint32_t i2c_periph, i2c_flag_enum flag);
+void i2c_flag_clear(uint32_t i2c_periph, i2c_flag_enum flag);
+
+/**
+ * The board pins, gd32_i2c.cpp configures them with Gd32I2cBegin()
+ */
+#define I2C_PERIPH I2C0
+#define I2C_RCU_I2Cx 0U
+#define I2C_SCL_RCU_GPIOx 0U
+#define I2C_SDA_RCU_GPIOx 0U
+#define I2C_SCL_GPIOx 0U
+#define I2C_SDA_GPIOx 0U
+#define I2C_SCL_GPIO_PINx (1U << 6)
+#define I2C_SDA_GPIO_PINx (1U << 7)
+#define GPIO_INIT
+#define GPIO_MODE_AF_OD 0U
+#define GPIO_OSPEED_50MHZ 0U
+
+inline void rcu_periph_clock_enable([[maybe_unused]] uint32_t periph) {}
+inline void gpio_init([[maybe_unused]] uint32_t gpio_periph, [[maybe_unused]] uint32_t mode, [[maybe_unused]] uint32_t speed,
+                      [[maybe_unused]] uint32_t pin) {}
+
+#endif // GD32F30X_I2C_H_
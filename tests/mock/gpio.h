@@ -0,0 +1,68 @@
+/**
+ * @file gpio.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef GPIO_H_
+#define GPIO_H_
+
+#include <cstdint>
+#include <cassert>
+
+/**
+ * Host stand-in for lib-gd32 gpio.h, the output levels of the pins 0 to 31 are kept.
+ */
+namespace mock::gpio {
+inline uint32_t levels;
+
+inline bool Get(uint32_t pin) {
+    assert(pin < 32);
+    return (levels & (1U << pin)) != 0;
+}
+} // namespace mock::gpio
+
+namespace gpio {
+enum class Select { kInput, kOutput };
+
+inline void Fsel([[maybe_unused]] uint32_t gpio, [[maybe_unused]] Select fsel) {}
+
+inline void Set(uint32_t pin) {
+    assert(pin < 32);
+    mock::gpio::levels |= (1U << pin);
+}
+
+inline void Clr(uint32_t pin) {
+    assert(pin < 32);
+    mock::gpio::levels &= ~(1U << pin);
+}
+
+inline void Write(uint32_t pin, uint32_t level) {
+    if (level != 0) {
+        Set(pin);
+    } else {
+        Clr(pin);
+    }
+}
+} // namespace gpio
+
+#endif // GPIO_H_
@@ -0,0 +1,64 @@
+/**
+ * @file i2c_device.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef I2C_DEVICE_H_
+#define I2C_DEVICE_H_
+
+#include <cstdint>
+
+#include "gd32_i2c.h"
+
+/**
+ * The blocking I2C of lib-gd32 on the simulated clock, mock/gd32_i2c.cpp implements gd32_i2c.h.
+ * The devices are models attached to an address.
+ * A transfer takes 9 bits for the address and 9 bits per byte at the set speed.
+ */
+namespace mock::i2c {
+class Device {
+   public:
+    virtual ~Device() = default;
+    /**
+     * @return gd32_i2c_rc_t
+     */
+    virtual uint8_t Write(const char* buffer, uint32_t length) = 0;
+    virtual uint8_t Read(char* buffer, uint32_t length) = 0;
+};
+
+/**
+ * An address without a device NACKs, nullptr detaches.
+ */
+void Attach(uint8_t address, Device* device);
+
+struct Statistics {
+    uint32_t writes;
+    uint32_t reads;
+    uint32_t bytes; ///< Without the address bytes
+};
+
+const Statistics& GetStatistics();
+void ResetStatistics();
+} // namespace mock::i2c
+
+#endif // I2C_DEVICE_H_
@@ -0,0 +1,50 @@
+/**
+ * @file timing.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef GD32_TIMING_H_
+#define GD32_TIMING_H_
+
+#include <cstdint>
+
+#include "gd32.h"
+
+/**
+ * The timing of lib-gd32 on the simulated clock
+ */
+namespace timing {
+[[nodiscard]] inline uint32_t Micros() {
+    return static_cast<uint32_t>(mock::GetMicros());
+}
+
+[[nodiscard]] inline uint32_t Millis() {
+    return static_cast<uint32_t>(mock::GetMicros() / 1000U);
+}
+
+inline void DelayUs(uint32_t micros) {
+    mock::Advance(micros);
+}
+} // namespace timing
+
+#endif // GD32_TIMING_H_
@@ -0,0 +1,299 @@
+/**
+ * @file pixel_baseline.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PIXEL_BASELINE_H_
+#define PIXEL_BASELINE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+#include "pixelconfiguration.h"
+#include "pixeltype.h"
+#include "pixeloutput.h"
+#include "gd32_spi.h"
+
+/**
+ * The GD32 I2S PixelOutput before the table encoders and the in place wire order, copied as it was:
+ * the encoders write in logical order, Update() byte swaps the whole frame into the transmit buffer.
+ * The RTZ frames start with 1 low byte.
+ */
+namespace baseline {
+inline uint32_t s_tmp;
+inline constexpr uint32_t kBufferSize = 24 * 1024;
+
+class PixelOutput {
+   public:
+    void ApplyConfiguration() {
+        auto& pixel_configuration = PixelConfiguration::Get();
+
+        const auto kCount = pixel_configuration.GetCount();
+
+        buf_size_ = kCount * pixel_configuration.GetLedsPerPixel();
+
+        if (pixel_configuration.IsRTZProtocol()) {
+            buf_size_ *= 8;
+            buf_size_ += 1;
+        }
+
+        const auto kType = pixel_configuration.GetType();
+
+        if ((kType == pixel::LedType::kAPA102) || (kType == pixel::LedType::kSK9822) || (kType == pixel::LedType::kP9813)) {
+            buf_size_ += kCount;
+            buf_size_ += 8;
+        }
+
+        buffer_ = s_buffer;
+        blackout_buffer_ = s_blackout_buffer;
+
+        s_tmp = buf_size_;
+        buf_size_ = (buf_size_ + 3) & static_cast<uint32_t>(~3);
+        assert(buf_size_ <= kBufferSize);
+
+        memset(s_buffer, 0, sizeof(s_buffer));
+        memset(s_blackout_buffer, 0, sizeof(s_blackout_buffer));
+    }
+
+    void SetColorWS28xx(uint32_t offset, uint8_t value) {
+        auto& pixel_configuration = PixelConfiguration::Get();
+        assert(pixel_configuration.GetType() != pixel::LedType::kWS2801);
+        assert(buffer_ != nullptr);
+        assert(offset + 7 < buf_size_);
+
+        offset += 1;
+
+        const auto kLowCode = pixel_configuration.GetLowCode();
+        const auto kHighCode = pixel_configuration.GetHighCode();
+
+        for (uint8_t mask = 0x80; mask != 0; mask = static_cast<uint8_t>(mask >> 1)) {
+            if (value & mask) {
+                buffer_[offset] = kHighCode;
+            } else {
+                buffer_[offset] = kLowCode;
+            }
+            offset++;
+        }
+    }
+
+    void SetPixel(uint32_t pixel_index, uint8_t red, uint8_t green, uint8_t blue) {
+        auto& pixel_configuration = PixelConfiguration::Get();
+        assert(pixel_index < pixel_configuration.GetCount());
+
+        if (pixel_configuration.IsRTZProtocol()) {
+            const auto kOffset = pixel_index * 24U;
+
+            SetColorWS28xx(kOffset, red);
+            SetColorWS28xx(kOffset + 8, green);
+            SetColorWS28xx(kOffset + 16, blue);
+            return;
+        }
+
+        assert(buffer_ != nullptr);
+
+        const auto kType = pixel_configuration.GetType();
+
+        if (kType == pixel::LedType::kWS2801) {
+            const auto kOffset = pixel_index * 3U;
+            assert(kOffset + 2U < buf_size_);
+
+            buffer_[kOffset] = red;
+            buffer_[kOffset + 1] = green;
+            buffer_[kOffset + 2] = blue;
+
+            return;
+        }
+
+        if ((kType == pixel::LedType::kAPA102) || (kType == pixel::LedType::kSK9822)) {
+            const auto kOffset = 4U + (pixel_index * 4U);
+            assert(kOffset + 3U < buf_size_);
+
+            buffer_[kOffset] = pixel_configuration.GetGlobalBrightness();
+            buffer_[kOffset + 1] = red;
+            buffer_[kOffset + 2] = green;
+            buffer_[kOffset + 3] = blue;
+
+            return;
+        }
+
+        if (kType == pixel::LedType::kP9813) {
+            const auto kOffset = 4U + (pixel_index * 4U);
+            assert(kOffset + 3 < buf_size_);
+
+            const auto kFlag = static_cast<uint8_t>(0xC0 | ((~blue & 0xC0) >> 2) | ((~green & 0xC0) >> 4) | ((~red & 0xC0) >> 6));
+
+            buffer_[kOffset] = kFlag;
+            buffer_[kOffset + 1] = blue;
+            buffer_[kOffset + 2] = green;
+            buffer_[kOffset + 3] = red;
+
+            return;
+        }
+
+        assert(0);
+        __builtin_unreachable();
+    }
+
+    void SetPixel(uint32_t pixel_index, uint8_t red, uint8_t green, uint8_t blue, uint8_t white) {
+        assert(pixel_index < PixelConfiguration::Get().GetCount());
+        assert(PixelConfiguration::Get().GetType() == pixel::LedType::kSK6812W);
+
+        const auto kOffset = pixel_index * 32U;
+
+        SetColorWS28xx(kOffset, green);
+        SetColorWS28xx(kOffset + 8, red);
+        SetColorWS28xx(kOffset + 16, blue);
+        SetColorWS28xx(kOffset + 24, white);
+    }
+
+    void Update() {
+        for (auto i = s_tmp; i < buf_size_; i++) {
+            buffer_[i] = 0x00;
+        }
+
+        const auto* src = reinterpret_cast<uint16_t*>(buffer_);
+        auto* dst = reinterpret_cast<uint16_t*>(blackout_buffer_);
+
+        for (uint32_t i = 0; i < buf_size_ / 2; i++) {
+            dst[i] = __builtin_bswap16(src[i]);
+        }
+
+        // i2s::Gd32SpiDmaTxStart(blackout_buffer_, buf_size_), each halfword is sent MSB first
+        for (uint32_t i = 0; i < buf_size_; i++) {
+            wire_[i] = blackout_buffer_[i ^ 1];
+        }
+    }
+
+    void Blackout() {
+        auto* buffer = buffer_;
+        buffer_ = blackout_buffer_;
+
+        auto& pixel_configuration = PixelConfiguration::Get();
+
+        const auto kType = pixel_configuration.GetType();
+        const auto kCount = pixel_configuration.GetCount();
+
+        if ((kType == pixel::LedType::kAPA102) || (kType == pixel::LedType::kSK9822) || (kType == pixel::LedType::kP9813)) {
+            memset(buffer_, 0, 4);
+
+            for (uint32_t pixel_index = 0; pixel_index < kCount; pixel_index++) {
+                SetPixel(pixel_index, 0, 0, 0);
+            }
+
+            if ((kType == pixel::LedType::kAPA102) || (kType == pixel::LedType::kSK9822)) {
+                memset(&buffer_[buf_size_ - 4], 0xFF, 4);
+            } else {
+                memset(&buffer_[buf_size_ - 4], 0, 4);
+            }
+        } else {
+            buffer_[0] = 0x00;
+            memset(&buffer_[1], kType == pixel::LedType::kWS2801 ? 0 : pixel_configuration.GetLowCode(), buf_size_);
+        }
+
+        Update();
+
+        buffer_ = buffer;
+    }
+
+    const uint8_t* GetWire() const { return wire_; }
+
+   private:
+    uint32_t buf_size_;
+    uint8_t* buffer_{nullptr};
+    uint8_t* blackout_buffer_{nullptr};
+
+    alignas(4) static inline uint8_t s_buffer[kBufferSize];
+    alignas(4) static inline uint8_t s_blackout_buffer[kBufferSize];
+    static inline uint8_t wire_[kBufferSize];
+};
+
+/*
+ * The wire of the PixelOutput on the simulated I2S DMA against the wire of the baseline
+ */
+struct Layout {
+    uint32_t offset; ///< Of pixel 0 on the wire
+    uint32_t size;   ///< Of the pixels on the wire, up to the end frame or the padding
+};
+
+inline Layout GetBaselineLayout() {
+    auto& pixel_configuration = PixelConfiguration::Get();
+    const auto kBytes = pixel_configuration.GetCount() * pixel_configuration.GetLedsPerPixel();
+
+    if (pixel_configuration.IsRTZProtocol()) {
+        return {1, kBytes * 8};
+    }
+
+    if (pixel_configuration.GetType() == pixel::LedType::kWS2801) {
+        return {0, kBytes};
+    }
+
+    return {4, pixel_configuration.GetCount() * 4};
+}
+
+inline Layout GetLayout() {
+    auto layout = GetBaselineLayout();
+
+    if (PixelConfiguration::Get().IsRTZProtocol()) {
+        layout.offset = pixel::output::kRtzLeadingBytes;
+    }
+
+    return layout;
+}
+
+/*
+ * The wire bytes of both outputs are the same, except for the RTZ lead-in
+ */
+inline bool IsSameWire(const PixelOutput& reference, bool pixels_only) {
+    uint32_t length;
+    const auto* wire = mock::i2s::GetWire(length);
+    const auto* reference_wire = reference.GetWire();
+
+    const auto kLayout = GetLayout();
+    const auto kBaselineLayout = GetBaselineLayout();
+
+    bool is_same = memcmp(&wire[kLayout.offset], &reference_wire[kBaselineLayout.offset], kLayout.size) == 0;
+
+    if (pixels_only) {
+        return is_same;
+    }
+
+    // The start frame, or the RTZ lead-in which is low
+    for (uint32_t i = 0; i < kLayout.offset; i++) {
+        is_same &= (wire[i] == (i < kBaselineLayout.offset ? reference_wire[i] : 0));
+    }
+
+    // The end frame and the padding
+    const auto kEnd = kLayout.offset + kLayout.size;
+    const auto kBaselineEnd = kBaselineLayout.offset + kBaselineLayout.size;
+
+    for (uint32_t i = kEnd; i < length; i++) {
+        const auto kBaselineIndex = kBaselineEnd + (i - kEnd);
+        is_same &= (wire[i] == reference_wire[kBaselineIndex]);
+    }
+
+    return is_same;
+}
+} // namespace baseline
+
+#endif // PIXEL_BASELINE_H_
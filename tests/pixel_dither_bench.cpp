@@ -0,0 +1,104 @@
+/**
+ * @file pixel_dither_bench.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Host us per frame of the temporal dithering for 680 RGB pixels, against encoding the 8-bit values.
+ * The RTZ render half holds 511 pixels, WS2812B is measured with 510 pixels.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#include <initializer_list>
+
+#include "pixeldither.h"
+#include "pixeloutput.h"
+#include "pixelconfiguration.h"
+#include "pixeltype.h"
+#include "gd32_spi.h"
+#include "test.h"
+
+namespace {
+template <typename F> double Measure(F&& render) {
+    static constexpr uint32_t kRuns = 1000;
+    auto best = INT64_MAX;
+
+    for (uint32_t run = 0; run < kRuns; run++) {
+        const auto kStart = std::chrono::steady_clock::now();
+        render();
+        const auto kNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - kStart).count();
+        best = std::min(best, static_cast<int64_t>(kNanos));
+    }
+
+    return static_cast<double>(best) / 1000.0;
+}
+
+template <pixel::output::Encoder kEncoder> __attribute__((noinline)) void Encode(PixelOutput& output, const uint8_t* data, uint32_t count) {
+    for (uint32_t index = 0; index < count; index++) {
+        output.SetPixel<kEncoder>(index, data[index * 3], data[index * 3 + 1], data[index * 3 + 2], 0xFF);
+    }
+}
+
+template <pixel::output::Encoder kEncoder> void Bench(PixelOutput& output, pixel::LedType type, uint32_t count) {
+    auto& pixel_configuration = PixelConfiguration::Get();
+    pixel_configuration.SetType(type);
+    pixel_configuration.SetCount(count);
+    pixel_configuration.Validate();
+    output.ApplyConfiguration();
+    mock::i2s::Complete();
+
+    static uint8_t data[680 * 3];
+
+    for (auto& value : data) {
+        value = static_cast<uint8_t>(test::Random());
+    }
+
+    static PixelDither dither;
+    dither.ApplyConfiguration();
+
+    const auto kEncode = Measure([&] { Encode<kEncoder>(output, data, count); });
+    const auto kSetData = Measure([&] { dither.SetData(data, count * 3, 0, 0, count, 1); });
+    const auto kRender = Measure([&] { dither.Render(output); });
+
+    printf(" %-8s %3u pixels : %6.2f | %6.2f %6.2f\n", pixel::GetTypeName(type), count, kEncode, kSetData, kRender);
+}
+} // namespace
+
+int main() {
+    static PixelConfiguration pixel_configuration;
+    static PixelOutput output;
+
+    pixel_configuration.SetEnableGammaCorrection(true);
+    pixel_configuration.SetGammaTable(22);
+
+    puts("Dithering, best of 1000 runs, us per frame: 8-bit encode | dither SetData Render");
+
+    Bench<pixel::output::Encoder::kRtz>(output, pixel::LedType::kWS2812B, 510);
+    Bench<pixel::output::Encoder::kWS2801>(output, pixel::LedType::kWS2801, 680);
+    Bench<pixel::output::Encoder::kAPA102>(output, pixel::LedType::kAPA102, 680);
+
+    return 0;
+}
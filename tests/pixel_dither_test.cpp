@@ -0,0 +1,138 @@
+/**
+ * @file pixel_dither_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The temporal dithering of pixeldither.h on the simulated I2S DMA: averaged over N frames the 8-bit output
+ * is within 1/N of the 16-bit gamma target, for every DMX value.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+
+#include "pixeldither.h"
+#include "pixeloutput.h"
+#include "pixelconfiguration.h"
+#include "pixeltype.h"
+#include "gd32_spi.h"
+#include "test.h"
+
+namespace {
+constexpr uint32_t kCount = 170;
+constexpr uint32_t kChannels = kCount * 3;
+
+/*
+ * Values above 0xFF00 can not be reached, the output is clipped at 0xFF
+ */
+uint32_t GetReachable(uint16_t target) { return target > 0xFF00 ? 0xFF00 : target; }
+
+void TestGamma(PixelOutput& output, uint32_t gamma_value, uint32_t frames) {
+    auto& pixel_configuration = PixelConfiguration::Get();
+    pixel_configuration.SetEnableGammaCorrection(gamma_value != 10);
+    pixel_configuration.SetGammaTable(gamma_value);
+    pixel_configuration.Validate();
+    output.ApplyConfiguration();
+    mock::i2s::Complete();
+
+    PixelDither dither;
+    dither.ApplyConfiguration();
+
+    // All 256 values, twice in a different order
+    uint8_t data[kChannels];
+
+    for (uint32_t i = 0; i < kChannels; i++) {
+        data[i] = static_cast<uint8_t>(i < 256 ? i : 255 - (i & 0xFF));
+    }
+
+    dither.SetData(data, kChannels, 0, 0, kCount, 1);
+
+    const auto* gamma_table = gamma16::GetTable(pixel_configuration.GetGammaTable());
+
+    static uint32_t sums[kChannels];
+    static uint8_t first[kChannels];
+    bool is_changing = false;
+
+    for (uint32_t i = 0; i < kChannels; i++) {
+        sums[i] = 0;
+    }
+
+    for (uint32_t frame = 0; frame < frames; frame++) {
+        dither.Render(output);
+        output.Update();
+        mock::i2s::Complete();
+
+        uint32_t length;
+        const auto* wire = mock::i2s::GetWire(length);
+        CHECK(length >= kChannels);
+
+        for (uint32_t i = 0; i < kChannels; i++) {
+            sums[i] += wire[i];
+
+            if (frame == 0) {
+                first[i] = wire[i];
+            } else {
+                is_changing |= (wire[i] != first[i]);
+            }
+        }
+    }
+
+    uint32_t failed = 0;
+
+    for (uint32_t i = 0; i < kChannels; i++) {
+        const auto kTarget = frames * GetReachable(gamma_table[data[i]]);
+        const auto kSum = sums[i] * 256U;
+        const auto kError = kSum > kTarget ? kSum - kTarget : kTarget - kSum;
+
+        if (kError >= 256) {
+            failed++;
+        }
+    }
+
+    printf(" gamma %u.%u, %4u frames: %u of %u channels off target\n", gamma_value / 10, gamma_value % 10, frames, failed, kChannels);
+
+    CHECK(failed == 0);
+    CHECK((frames == 1) || is_changing);
+}
+} // namespace
+
+int main() {
+    static PixelConfiguration pixel_configuration;
+    static PixelOutput output;
+
+    pixel_configuration.SetType(pixel::LedType::kWS2801);
+    pixel_configuration.SetMap(pixel::LedMap::kRGB);
+    pixel_configuration.SetCount(kCount);
+
+    for (const auto kGammaValue : {10U, 22U, 25U}) {
+        for (const auto kFrames : {1U, 7U, 256U, 1000U}) {
+            TestGamma(output, kGammaValue, kFrames);
+        }
+    }
+
+    CHECK(mock::i2s::GetTornFrames() == 0);
+    CHECK(mock::i2s::GetOverruns() == 0);
+
+    return test::Result("pixel_dither_test");
+}
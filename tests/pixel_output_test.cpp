@@ -0,0 +1,151 @@
+/**
+ * @file pixel_output_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The wire bytes of the GD32 I2S PixelOutput against the output before the render half was sent in place, see pixel_baseline.h.
+ * The only difference on the wire is the RTZ lead-in: 2 low bytes instead of 1.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+
+#include "pixeloutput.h"
+#include "pixelconfiguration.h"
+#include "pixeltype.h"
+#include "pixel_baseline.h"
+#include "test.h"
+
+namespace {
+uint8_t RandomByte() { return static_cast<uint8_t>(test::Random()); }
+
+void SetPixel(PixelOutput& output, baseline::PixelOutput& reference, bool is_rgbw, uint32_t index, uint8_t red, uint8_t green, uint8_t blue, uint8_t white) {
+    if (is_rgbw) {
+        output.SetPixel(index, red, green, blue, white);
+        reference.SetPixel(index, red, green, blue, white);
+    } else {
+        output.SetPixel(index, red, green, blue);
+        reference.SetPixel(index, red, green, blue);
+    }
+}
+
+/*
+ * Frames of random pixel ranges, some frames are rendered with SetPixels(),
+ * some with nothing rendered, and a blackout in between.
+ */
+void TestType(PixelOutput& output, pixel::LedType type, uint32_t count) {
+    auto& pixel_configuration = PixelConfiguration::Get();
+    pixel_configuration.SetType(type);
+    pixel_configuration.SetCount(count);
+    pixel_configuration.SetGlobalBrightness(0x15);
+
+    output.ApplyConfiguration();
+
+    baseline::PixelOutput reference;
+    reference.ApplyConfiguration();
+
+    const auto kIsRgbw = (type == pixel::LedType::kSK6812W);
+    const auto kCount = pixel_configuration.GetCount();
+
+    for (uint32_t frame = 0; frame < 64; frame++) {
+        const auto kMode = test::Random() % 8;
+
+        if (kMode == 0) {
+            output.Blackout();
+            reference.Blackout();
+            CHECK(baseline::IsSameWire(reference, true));
+            continue;
+        }
+
+        if (kMode == 1) {
+            const auto kIndex = test::Random() % kCount;
+            const auto kStride = 1 + (test::Random() % 3);
+            const auto kPixels = 1 + (kCount - 1 - kIndex) / kStride;
+            const auto kRed = RandomByte();
+            const auto kGreen = RandomByte();
+            const auto kBlue = RandomByte();
+            const auto kWhite = RandomByte();
+
+            if (kIsRgbw) {
+                output.SetPixels(kIndex, kPixels, kStride, kRed, kGreen, kBlue, kWhite);
+            } else {
+                output.SetPixels(kIndex, kPixels, kStride, kRed, kGreen, kBlue);
+            }
+
+            for (uint32_t i = 0; i < kPixels; i++) {
+                if (kIsRgbw) {
+                    reference.SetPixel(kIndex + i * kStride, kRed, kGreen, kBlue, kWhite);
+                } else {
+                    reference.SetPixel(kIndex + i * kStride, kRed, kGreen, kBlue);
+                }
+            }
+        } else if (kMode == 2) {
+            for (uint32_t index = 0; index < kCount; index++) {
+                SetPixel(output, reference, kIsRgbw, index, RandomByte(), RandomByte(), RandomByte(), RandomByte());
+            }
+        } else if (kMode != 3) {
+            auto begin = test::Random() % kCount;
+            auto end = test::Random() % kCount;
+
+            if (begin > end) {
+                const auto kTmp = begin;
+                begin = end;
+                end = kTmp;
+            }
+
+            for (auto index = begin; index <= end; index++) {
+                SetPixel(output, reference, kIsRgbw, index, RandomByte(), RandomByte(), RandomByte(), RandomByte());
+            }
+        }
+
+        CHECK(!output.IsUpdating());
+        output.Update();
+        reference.Update();
+        mock::i2s::Complete();
+
+        CHECK(baseline::IsSameWire(reference, false));
+    }
+}
+} // namespace
+
+int main() {
+    static PixelConfiguration pixel_configuration;
+    static PixelOutput output;
+
+    for (const auto kCount : {1U, 7U, 170U}) {
+        TestType(output, pixel::LedType::kWS2812B, kCount);
+        TestType(output, pixel::LedType::kWS2801, kCount);
+        TestType(output, pixel::LedType::kAPA102, kCount);
+        TestType(output, pixel::LedType::kSK9822, kCount);
+        TestType(output, pixel::LedType::kP9813, kCount);
+        TestType(output, pixel::LedType::kSK6812W, kCount < 128 ? kCount : 128);
+    }
+
+    // The render half is never written while it is sent
+    CHECK(mock::i2s::GetTornFrames() == 0);
+    CHECK(mock::i2s::GetOverruns() == 0);
+
+    return test::Result("pixel_output_test");
+}
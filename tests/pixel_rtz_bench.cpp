@@ -0,0 +1,106 @@
+/**
+ * @file pixel_rtz_bench.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Host ns per pixel for RTZ encoding 170, 340 and 680 RGB pixels:
+ * the bit by bit encoder of pixel_baseline.h against the nibble table.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#include <initializer_list>
+
+#include "pixeloutput.h"
+#include "pixelconfiguration.h"
+#include "pixel_baseline.h"
+#include "test.h"
+
+static constexpr uint32_t kCountMax = 680;
+
+static uint8_t s_values[kCountMax * 3];
+
+__attribute__((noinline)) static void EncodeBaseline(baseline::PixelOutput& output, uint32_t count) {
+    for (uint32_t index = 0; index < count; index++) {
+        output.SetPixel(index, s_values[index * 3], s_values[index * 3 + 1], s_values[index * 3 + 2]);
+    }
+}
+
+__attribute__((noinline)) static void EncodeTable(const uint32_t (&table)[16], uint8_t* buffer, uint32_t count) {
+    for (uint32_t index = 0; index < count; index++) {
+        auto* out = &buffer[pixel::output::kRtzLeadingBytes + index * 24];
+        pixel::output::EncodeRtz(table, s_values[index * 3], out);
+        pixel::output::EncodeRtz(table, s_values[index * 3 + 1], out + 8);
+        pixel::output::EncodeRtz(table, s_values[index * 3 + 2], out + 16);
+    }
+}
+
+template <typename F> static double Measure(uint32_t count, F&& encode) {
+    static constexpr uint32_t kRuns = 2000;
+    auto best = INT64_MAX;
+
+    for (uint32_t run = 0; run < kRuns; run++) {
+        const auto kStart = std::chrono::steady_clock::now();
+        encode();
+        const auto kNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - kStart).count();
+        best = std::min(best, static_cast<int64_t>(kNanos));
+    }
+
+    return static_cast<double>(best) / count;
+}
+
+int main() {
+    static PixelConfiguration pixel_configuration;
+    pixel_configuration.SetType(pixel::LedType::kWS2812B);
+    pixel_configuration.SetLowCode(0xC0);
+    pixel_configuration.SetHighCode(0xF8);
+
+    uint32_t table[16];
+    pixel::output::SetupRtzTable(0xC0, 0xF8, table);
+
+    alignas(4) static uint8_t buffer[pixel::output::kRtzLeadingBytes + kCountMax * 24];
+
+    for (auto& value : s_values) {
+        value = static_cast<uint8_t>(test::Random());
+    }
+
+    puts("RTZ encoding, best of 2000 runs, ns per pixel");
+
+    for (const auto kCount : {170U, 340U, 680U}) {
+        pixel_configuration.SetCount(kCount);
+
+        baseline::PixelOutput reference;
+        reference.ApplyConfiguration();
+
+        const auto kBaseline = Measure(kCount, [&] { EncodeBaseline(reference, kCount); });
+        const auto kTable = Measure(kCount, [&] { EncodeTable(table, buffer, kCount); });
+
+        printf(" %3u pixels, bit by bit : %6.2f\n", kCount, kBaseline);
+        printf(" %3u pixels, table      : %6.2f\n", kCount, kTable);
+    }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file pixel_rtz_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The RTZ table encoder against the bit by bit encoder it replaces, see pixel_baseline.h.
+ * Built twice: for the host with kByteSwap 0, and with GD32 for kByteSwap 1.
+ */
+
+#include <cstdint>
+
+#include "pixeloutput.h"
+#include "pixelconfiguration.h"
+#include "pixel_baseline.h"
+#include "test.h"
+
+static constexpr uint32_t kCount = 170;
+
+/**
+ * Encodes a frame with both encoders and compares the wire bytes.
+ * The baseline frame starts with 1 low byte, the table encoded frame with kRtzLeadingBytes.
+ */
+static void TestFrame(const uint32_t (&table)[16], baseline::PixelOutput& reference, const uint8_t* values) {
+    alignas(4) static uint8_t buffer[pixel::output::kRtzLeadingBytes + kCount * 24];
+
+    for (uint32_t index = 0; index < kCount; index++) {
+        const auto* colours = &values[index * 3];
+
+        reference.SetPixel(index, colours[0], colours[1], colours[2]);
+
+        for (uint32_t colour = 0; colour < 3; colour++) {
+            pixel::output::EncodeRtz(table, colours[colour], &buffer[pixel::output::kRtzLeadingBytes + index * 24 + colour * 8]);
+        }
+    }
+
+    reference.Update();
+    const auto* wire = reference.GetWire();
+
+    for (uint32_t i = 0; i < kCount * 24; i++) {
+        // The buffer is in memory order, the byte swap gives the wire order
+        CHECK(buffer[(pixel::output::kRtzLeadingBytes + i) ^ pixel::output::kByteSwap] == wire[1 + i]);
+    }
+}
+
+static void TestEncode(uint8_t low_code, uint8_t high_code) {
+    auto& pixel_configuration = PixelConfiguration::Get();
+    pixel_configuration.SetLowCode(low_code);
+    pixel_configuration.SetHighCode(high_code);
+
+    uint32_t table[16];
+    pixel::output::SetupRtzTable(low_code, high_code, table);
+
+    baseline::PixelOutput reference;
+    reference.ApplyConfiguration();
+
+    uint8_t values[kCount * 3];
+
+    // All 256 values on each colour
+    for (uint32_t i = 0; i < sizeof(values); i++) {
+        values[i] = static_cast<uint8_t>(i);
+    }
+
+    TestFrame(table, reference, values);
+
+    for (auto& value : values) {
+        value = static_cast<uint8_t>(test::Random());
+    }
+
+    TestFrame(table, reference, values);
+}
+
+int main() {
+    static PixelConfiguration pixel_configuration;
+    pixel_configuration.SetType(pixel::LedType::kWS2812B);
+    pixel_configuration.SetCount(kCount);
+
+    // WS2812B, the default
+    TestEncode(0xC0, 0xF8);
+    TestEncode(0x00, 0xFF);
+    TestEncode(0xFF, 0x00);
+
+    for (uint32_t i = 0; i < 16; i++) {
+        TestEncode(static_cast<uint8_t>(test::Random()), static_cast<uint8_t>(test::Random()));
+    }
+
+    return test::Result(pixel::output::kByteSwap == 0 ? "pixel_rtz_test" : "pixel_rtz_test (byte swap)");
+}
@@ -0,0 +1,123 @@
+/**
+ * @file pixel_transpose_bench.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Host cost of building the bit planes for 170 RGB pixels per port:
+ * bit by bit against Transpose(), per pixel per port.
+ * On x86 the TSC ticks are given as well, they count at the nominal clock.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "pixeloutputmulti.h"
+#include "test.h"
+
+namespace multi = pixel::output::multi;
+
+static constexpr uint32_t kPixels = 170;
+static constexpr uint32_t kLength = kPixels * 3;
+
+static uint8_t s_data[multi::kMaxPorts][multi::kMaxPortBytes];
+static multi::Plane s_planes[multi::kMaxPlanes];
+
+__attribute__((noinline)) static void TransposeBitByBit(multi::Plane mask) {
+    for (uint32_t index = 0; index < kLength; index++) {
+        for (uint32_t bit = 0; bit < 8; bit++) {
+            multi::Plane plane = 0;
+
+            for (uint32_t port = 0; port < multi::kMaxPorts; port++) {
+                if (((s_data[port][index] >> (7 - bit)) & 1U) == 0) {
+                    plane = static_cast<multi::Plane>(plane | (1U << port));
+                }
+            }
+
+            s_planes[index * 8 + bit] = static_cast<multi::Plane>(plane & mask);
+        }
+    }
+}
+
+__attribute__((noinline)) static void TransposeKernel(multi::Plane mask) { multi::Transpose(s_data, kLength, mask, s_planes); }
+
+struct Cost {
+    double nanos;
+    double ticks;
+};
+
+template <typename F> static Cost Measure(F&& transpose) {
+    static constexpr uint32_t kRuns = 2000;
+    static constexpr double kPerPixelPort = kPixels * multi::kMaxPorts;
+    auto best_nanos = INT64_MAX;
+    auto best_ticks = UINT64_MAX;
+
+    for (uint32_t run = 0; run < kRuns; run++) {
+#if defined(__x86_64__) || defined(__i386__)
+        const auto kTicks = __rdtsc();
+#endif
+        const auto kStart = std::chrono::steady_clock::now();
+        transpose();
+        const auto kNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - kStart).count();
+#if defined(__x86_64__) || defined(__i386__)
+        best_ticks = std::min(best_ticks, static_cast<uint64_t>(__rdtsc() - kTicks));
+#else
+        best_ticks = 0;
+#endif
+        best_nanos = std::min(best_nanos, static_cast<int64_t>(kNanos));
+    }
+
+    return {static_cast<double>(best_nanos) / kPerPixelPort, static_cast<double>(best_ticks) / kPerPixelPort};
+}
+
+int main() {
+    for (auto& port : s_data) {
+        for (auto& byte : port) {
+            byte = static_cast<uint8_t>(test::Random());
+        }
+    }
+
+    const auto kMask = static_cast<multi::Plane>((1U << multi::kMaxPorts) - 1);
+
+    // Both must build the same planes
+    static multi::Plane reference[multi::kMaxPlanes];
+    TransposeBitByBit(kMask);
+    std::copy(std::begin(s_planes), std::end(s_planes), std::begin(reference));
+    TransposeKernel(kMask);
+    CHECK(std::equal(s_planes, s_planes + kLength * 8, reference));
+
+    const auto kBitByBit = Measure([&] { TransposeBitByBit(kMask); });
+    const auto kKernel = Measure([&] { TransposeKernel(kMask); });
+
+    printf("Bit planes, %u ports x %u RGB pixels, best of 2000 runs, per pixel per port\n", multi::kMaxPorts, kPixels);
+    printf(" bit by bit  : %6.2f ns %6.2f ticks\n", kBitByBit.nanos, kBitByBit.ticks);
+    printf(" Transpose() : %6.2f ns %6.2f ticks\n", kKernel.nanos, kKernel.ticks);
+
+    return test::Result((multi::kMaxPorts == 16) ? "pixel_transpose16_bench" : "pixel_transpose_bench");
+}
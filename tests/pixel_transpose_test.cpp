@@ -0,0 +1,92 @@
+/**
+ * @file pixel_transpose_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+
+#include "pixeloutputmulti.h"
+#include "test.h"
+
+namespace multi = pixel::output::multi;
+
+static void TestTranspose8() {
+    for (uint32_t run = 0; run < 10000; run++) {
+        const uint32_t kStride = 1 + (test::Random() % 4);
+        uint8_t in[8 * 4];
+
+        for (auto& byte : in) {
+            byte = static_cast<uint8_t>(test::Random());
+        }
+
+        uint8_t out[8];
+        multi::Transpose8(in, kStride, out);
+
+        for (uint32_t i = 0; i < 8; i++) {
+            for (uint32_t n = 0; n < 8; n++) {
+                CHECK(((out[i] >> n) & 1U) == ((in[n * kStride] >> (7 - i)) & 1U));
+            }
+        }
+    }
+}
+
+/**
+ * The planes hold the inverted data bits of the enabled ports, MSB first
+ */
+static void TestTranspose() {
+    static uint8_t data[multi::kMaxPorts][multi::kMaxPortBytes];
+    static multi::Plane planes[multi::kMaxPlanes];
+
+    for (auto& port : data) {
+        for (auto& byte : port) {
+            byte = static_cast<uint8_t>(test::Random());
+        }
+    }
+
+    const auto kMask = static_cast<multi::Plane>(test::Random() & ((1U << multi::kMaxPorts) - 1));
+    const uint32_t kLength = multi::kMaxPortBytes - 3;
+
+    planes[kLength * 8] = 0x5A;
+    multi::Transpose(data, kLength, kMask, planes);
+
+    for (uint32_t index = 0; index < kLength; index++) {
+        for (uint32_t bit = 0; bit < 8; bit++) {
+            const auto kPlane = planes[index * 8 + bit];
+
+            for (uint32_t port = 0; port < multi::kMaxPorts; port++) {
+                const auto kIsLow = ((data[port][index] >> (7 - bit)) & 1U) == 0;
+                const auto kIsEnabled = ((kMask >> port) & 1U) != 0;
+                CHECK(((kPlane >> port) & 1U) == ((kIsLow && kIsEnabled) ? 1U : 0U));
+            }
+        }
+    }
+
+    CHECK(planes[kLength * 8] == 0x5A);
+}
+
+int main() {
+    TestTranspose8();
+    TestTranspose();
+
+    return test::Result((multi::kMaxPorts == 16) ? "pixel_transpose16_test" : "pixel_transpose_test");
+}
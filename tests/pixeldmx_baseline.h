@@ -0,0 +1,141 @@
+/**
+ * @file pixeldmx_baseline.h
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PIXELDMX_BASELINE_H_
+#define PIXELDMX_BASELINE_H_
+
+#include <cstdint>
+#include <algorithm>
+#include <cassert>
+
+#include "pixeldmxconfiguration.h"
+#include "pixel_baseline.h"
+
+namespace baseline {
+/**
+ * The pixel loop of PixelDmx::SetDataImpl before the specialised kernels, copied as it was:
+ * a switch on the map per frame, the type and configuration lookups per pixel, every grouped pixel is encoded.
+ */
+inline void SetData([[maybe_unused]] uint32_t port_index, PixelOutput& output_type_, const uint8_t* data, uint32_t length) {
+    auto& port_info = PixelDmxConfiguration::Get().GetPortInfo();
+    uint32_t d = 0;
+
+#if !defined(DMXNODE_PORTS)
+    static constexpr uint32_t kSwitch = 0;
+#else
+    const auto kSwitch = port_index & 0x03;
+#endif
+    const auto kGroups = PixelDmxConfiguration::Get().GetGroups();
+#if !defined(DMXNODE_PORTS)
+    static constexpr uint32_t kBeginIndex = 0;
+#else
+    const auto kBeginIndex = port_info.begin_index_port[kSwitch];
+#endif
+    const auto kChannelsPerPixel = PixelDmxConfiguration::Get().GetLedsPerPixel();
+    const auto kEndIndex = std::min(kGroups, (kBeginIndex + (length / kChannelsPerPixel)));
+
+    if ((kSwitch == 0) && (kGroups < port_info.begin_index_port[1])) {
+        assert(PixelDmxConfiguration::Get().GetDmxStartAddress() != 0);
+        d = (PixelDmxConfiguration::Get().GetDmxStartAddress() - 1U);
+    }
+
+    const auto kGroupingCount = PixelDmxConfiguration::Get().GetGroupingCount();
+
+    if (kChannelsPerPixel == 3) {
+        switch (PixelDmxConfiguration::Get().GetMap()) {
+            case pixel::LedMap::kRGB:
+                for (uint32_t j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
+                    auto const kPixelIndexStart = (j * kGroupingCount);
+                    for (uint32_t k = 0; k < kGroupingCount; k++) {
+                        output_type_.SetPixel(kPixelIndexStart + k, data[d + 0], data[d + 1], data[d + 2]);
+                    }
+                    d = d + 3;
+                }
+                break;
+            case pixel::LedMap::kRBG:
+                for (uint32_t j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
+                    auto const kPixelIndexStart = (j * kGroupingCount);
+                    for (uint32_t k = 0; k < kGroupingCount; k++) {
+                        output_type_.SetPixel(kPixelIndexStart + k, data[d + 0], data[d + 2], data[d + 1]);
+                    }
+                    d = d + 3;
+                }
+                break;
+            case pixel::LedMap::kGRB:
+                for (uint32_t j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
+                    auto const kPixelIndexStart = (j * kGroupingCount);
+                    for (uint32_t k = 0; k < kGroupingCount; k++) {
+                        output_type_.SetPixel(kPixelIndexStart + k, data[d + 1], data[d + 0], data[d + 2]);
+                    }
+                    d = d + 3;
+                }
+                break;
+            case pixel::LedMap::kGBR:
+                for (uint32_t j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
+                    auto const kPixelIndexStart = (j * kGroupingCount);
+                    for (uint32_t k = 0; k < kGroupingCount; k++) {
+                        output_type_.SetPixel(kPixelIndexStart + k, data[d + 2], data[d + 0], data[d + 1]);
+                    }
+                    d = d + 3;
+                }
+                break;
+            case pixel::LedMap::kBRG:
+                for (uint32_t j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
+                    auto const kPixelIndexStart = (j * kGroupingCount);
+                    for (uint32_t k = 0; k < kGroupingCount; k++) {
+                        output_type_.SetPixel(kPixelIndexStart + k, data[d + 1], data[d + 2], data[d + 0]);
+                    }
+                    d = d + 3;
+                }
+                break;
+            case pixel::LedMap::kBGR:
+                for (uint32_t j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
+                    auto const kPixelIndexStart = (j * kGroupingCount);
+                    for (uint32_t k = 0; k < kGroupingCount; k++) {
+                        output_type_.SetPixel(kPixelIndexStart + k, data[d + 2], data[d + 1], data[d + 0]);
+                    }
+                    d = d + 3;
+                }
+                break;
+            default:
+                assert(0);
+                __builtin_unreachable();
+                break;
+        }
+    } else {
+        assert(kChannelsPerPixel == 4);
+        for (auto j = kBeginIndex; (j < kEndIndex) && (d < length); j++) {
+            auto const kPixelIndexStart = (j * kGroupingCount);
+            for (uint32_t k = 0; k < kGroupingCount; k++) {
+                output_type_.SetPixel(kPixelIndexStart + k, data[d], data[d + 1], data[d + 2], data[d + 3]);
+            }
+            d = d + 4;
+        }
+    }
+
+}
+} // namespace baseline
+
+#endif // PIXELDMX_BASELINE_H_
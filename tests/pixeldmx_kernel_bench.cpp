@@ -0,0 +1,101 @@
+/**
+ * @file pixeldmx_kernel_bench.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Host pixels/us of the PixelDmx kernels against the old pixel loop of pixeldmx_baseline.h,
+ * for grouping count 1, 4 and 8. Without the update, only the encoding into the render half is measured.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#include <initializer_list>
+
+#include "pixeldmx.h"
+#include "pixeltype.h"
+#include "gd32_spi.h"
+#include "pixeldmx_baseline.h"
+#include "test.h"
+
+namespace {
+template <typename F> double Measure(uint32_t pixels, F&& set_data) {
+    static constexpr uint32_t kRuns = 1000;
+    auto best = INT64_MAX;
+
+    for (uint32_t run = 0; run < kRuns; run++) {
+        const auto kStart = std::chrono::steady_clock::now();
+        set_data();
+        const auto kNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - kStart).count();
+        best = std::min(best, static_cast<int64_t>(kNanos));
+    }
+
+    return (pixels * 1000.0) / static_cast<double>(best);
+}
+
+/*
+ * The RTZ render half holds 511 pixels, the grouped runs are 504 pixels
+ */
+void Bench(PixelDmx& pixel_dmx, pixel::LedType type, uint32_t grouping_count) {
+    auto& configuration = PixelDmxConfiguration::Get();
+    const auto kGroups = (grouping_count == 1) ? 170U : 504U / grouping_count;
+    const auto kPixels = kGroups * grouping_count;
+
+    configuration.SetType(type);
+    configuration.SetCount(kPixels);
+    configuration.SetGroupingCount(static_cast<uint16_t>(grouping_count));
+    configuration.SetMap(pixel::LedMap::kGRB);
+    pixel_dmx.ApplyConfiguration();
+    mock::i2s::Complete();
+
+    baseline::PixelOutput reference;
+    reference.ApplyConfiguration();
+
+    static uint8_t data[dmxnode::kUniverseSize];
+
+    for (auto& value : data) {
+        value = static_cast<uint8_t>(test::Random());
+    }
+
+    const auto kBaseline = Measure(kPixels, [&] { baseline::SetData(0, reference, data, sizeof(data)); });
+    const auto kKernel = Measure(kPixels, [&] { pixel_dmx.SetData<false>(0, data, sizeof(data)); });
+
+    printf(" %-8s grouping %u, %3u pixels : %6.1f -> %6.1f\n", pixel::GetTypeName(type), grouping_count, kPixels, kBaseline, kKernel);
+}
+} // namespace
+
+int main() {
+    static PixelDmx pixel_dmx;
+
+    puts("PixelDmx SetData, best of 1000 runs, pixels/us old loop -> kernel");
+
+    for (const auto kType : {pixel::LedType::kWS2812B, pixel::LedType::kWS2801, pixel::LedType::kAPA102}) {
+        for (const auto kGroupingCount : {1U, 4U, 8U}) {
+            Bench(pixel_dmx, kType, kGroupingCount);
+        }
+    }
+
+    return 0;
+}
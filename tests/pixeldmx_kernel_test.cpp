@@ -0,0 +1,108 @@
+/**
+ * @file pixeldmx_kernel_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The wire bytes of PixelDmx with the kernel selected per encoder and map, against the old pixel loop
+ * of pixeldmx_baseline.h, for every type, map and grouping count.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+
+#include "pixeldmx.h"
+#include "pixeltype.h"
+#include "gd32_spi.h"
+#include "pixeldmx_baseline.h"
+#include "test.h"
+
+namespace {
+/*
+ * 16 random frames for each map, the map changes in between frames so that the kernel is selected again.
+ * With less than 170 groups the data starts at the DMX start address.
+ */
+void TestType(PixelDmx& pixel_dmx, pixel::LedType type, uint32_t grouping_count, uint16_t dmx_start_address) {
+    auto& configuration = PixelDmxConfiguration::Get();
+    const auto kIsRgbw = (type == pixel::LedType::kSK6812W);
+    const auto kGroups = kIsRgbw ? 120U : (dmx_start_address == 1 ? 170U : 150U);
+
+    configuration.SetType(type);
+    configuration.SetCount(kGroups * grouping_count);
+    configuration.SetGroupingCount(static_cast<uint16_t>(grouping_count));
+    configuration.SetDmxStartAddress(dmx_start_address);
+    configuration.SetLowCode(0);
+    configuration.SetHighCode(0);
+    configuration.SetMap(pixel::LedMap::kUndefined);
+    pixel_dmx.ApplyConfiguration();
+    mock::i2s::Complete();
+
+    baseline::PixelOutput reference;
+    reference.ApplyConfiguration();
+
+    uint8_t data[dmxnode::kUniverseSize];
+
+    for (uint32_t map = 0; map < static_cast<uint32_t>(pixel::LedMap::kRGBW); map++) {
+        configuration.SetMap(static_cast<pixel::LedMap>(map));
+
+        for (uint32_t frame = 0; frame < 16; frame++) {
+            for (auto& value : data) {
+                value = static_cast<uint8_t>(test::Random());
+            }
+
+            // The APA102 brightness is read once per frame
+            configuration.SetGlobalBrightness(static_cast<uint8_t>(0xE0 | (test::Random() & 0x1F)));
+
+            pixel_dmx.SetData<true>(0, data, sizeof(data));
+            mock::i2s::Complete();
+
+            baseline::SetData(0, reference, data, sizeof(data));
+            reference.Update();
+
+            if (!baseline::IsSameWire(reference, false)) {
+                printf(" %s, %s, grouping %u, start address %u: frame %u differs\n", pixel::GetTypeName(configuration.GetType()), pixel::GetMapName(configuration.GetMap()),
+                       grouping_count, dmx_start_address, frame);
+                CHECK(false);
+                return;
+            }
+        }
+    }
+}
+} // namespace
+
+int main() {
+    static PixelDmx pixel_dmx;
+
+    for (uint32_t type = 0; type < static_cast<uint32_t>(pixel::LedType::kUndefined); type++) {
+        for (const auto kGroupingCount : {1U, 3U}) {
+            TestType(pixel_dmx, static_cast<pixel::LedType>(type), kGroupingCount, 1);
+            TestType(pixel_dmx, static_cast<pixel::LedType>(type), kGroupingCount, 31);
+        }
+    }
+
+    CHECK(mock::i2s::GetTornFrames() == 0);
+    CHECK(mock::i2s::GetOverruns() == 0);
+
+    return test::Result("pixeldmx_kernel_test");
+}
@@ -0,0 +1,318 @@
+/**
+ * @file pixeldmx_queue_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * DMX at 44 Hz into PixelDmx on the simulated I2S DMA: the frames that arrive while the output is updating
+ * are queued and rendered by Run(). Reports the rendered, coalesced and dropped frames per strip length.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstddef>
+#include <initializer_list>
+
+#include "pixeldmx.h"
+#include "gd32_spi.h"
+#include "test.h"
+
+/*
+ * Counts the overlapping copies, memcpy with overlapping ranges is undefined behaviour.
+ * The test is built with -fno-builtin-memcpy, so that all copies come here.
+ */
+static uint32_t s_overlapping_copies;
+
+// The loop must not be turned into a call of memcpy
+extern "C" __attribute__((optimize("no-tree-loop-distribute-patterns"))) void* memcpy(void* destination, const void* source, size_t length) {
+    auto* dst = static_cast<uint8_t*>(destination);
+    const auto* src = static_cast<const uint8_t*>(source);
+
+    if ((length != 0) && (dst < src + length) && (src < dst + length)) {
+        s_overlapping_copies++;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        dst[i] = src[i];
+    }
+
+    return destination;
+}
+
+namespace {
+constexpr uint32_t kFrameMicros = 1000000U / 44U;
+
+struct Statistics {
+    uint32_t sent;
+    uint32_t rendered;
+    uint32_t coalesced;
+    uint32_t dropped;
+};
+
+/*
+ * Each pixel gets the same value on all colours, the map does not matter.
+ * Pixel 0 and 1 hold the sequence number, the others are derived from it.
+ */
+uint8_t GetPixelValue(uint32_t sequence, uint32_t pixel) {
+    if (pixel == 0) {
+        return static_cast<uint8_t>(sequence);
+    }
+
+    if (pixel == 1) {
+        return static_cast<uint8_t>(sequence >> 8);
+    }
+
+    return static_cast<uint8_t>((sequence * 31U) + pixel);
+}
+
+void SetFrame(uint32_t sequence, uint8_t* data, uint32_t groups) {
+    for (uint32_t pixel = 0; pixel < groups; pixel++) {
+        const auto kValue = GetPixelValue(sequence, pixel);
+        data[pixel * 3] = kValue;
+        data[pixel * 3 + 1] = kValue;
+        data[pixel * 3 + 2] = kValue;
+    }
+}
+
+/*
+ * Decodes the RTZ wire bytes back to the colour byte of LED index led
+ */
+uint8_t DecodeRtz(const uint8_t* wire, uint32_t led) {
+    const auto kHighCode = PixelConfiguration::Get().GetHighCode();
+    uint8_t value = 0;
+
+    for (uint32_t bit = 0; bit < 8; bit++) {
+        value = static_cast<uint8_t>((value << 1) | (wire[pixel::output::kRtzLeadingBytes + led * 8 + bit] == kHighCode ? 1 : 0));
+    }
+
+    return value;
+}
+
+/*
+ * Returns the sequence number of the frame on the wire, checks that all pixels are of that frame.
+ */
+uint32_t GetWireSequence(uint32_t groups, uint32_t grouping_count) {
+    uint32_t length;
+    const auto* wire = mock::i2s::GetWire(length);
+
+    const auto kSequence = static_cast<uint32_t>(DecodeRtz(wire, 0) | (DecodeRtz(wire, grouping_count * 3) << 8));
+
+    for (uint32_t pixel = 0; pixel < groups * grouping_count; pixel++) {
+        const auto kValue = GetPixelValue(kSequence, pixel / grouping_count);
+
+        for (uint32_t led = 0; led < 3; led++) {
+            CHECK(DecodeRtz(wire, pixel * 3 + led) == kValue);
+        }
+    }
+
+    return kSequence;
+}
+
+class Simulation {
+   public:
+    Simulation(PixelDmx& pixel_dmx, uint32_t groups, uint32_t grouping_count) : pixel_dmx_(pixel_dmx), groups_(groups), grouping_count_(grouping_count) {
+        auto& configuration = PixelDmxConfiguration::Get();
+        configuration.SetCount(groups * grouping_count);
+        configuration.SetGroupingCount(static_cast<uint16_t>(grouping_count));
+        pixel_dmx.ApplyConfiguration();
+        frames_ = mock::i2s::GetFrames();
+    }
+
+    void Arrive() {
+        SetFrame(++sequence_, data_, groups_);
+        statistics_.sent++;
+
+        if (i2s::Gd32SpiDmaTxIsActive()) {
+            if (is_pending_) {
+                statistics_.coalesced++;
+            }
+            is_pending_ = true;
+        } else {
+            if (is_pending_) {
+                statistics_.dropped++;
+            }
+            is_pending_ = false;
+            statistics_.rendered++;
+        }
+
+        pixel_dmx_.SetData<true>(0, data_, groups_ * 3);
+    }
+
+    void Loop(uint32_t loop_micros) {
+        if (is_pending_ && !i2s::Gd32SpiDmaTxIsActive()) {
+            is_pending_ = false;
+            statistics_.rendered++;
+        }
+
+        pixel_dmx_.Run();
+
+        mock::Advance(loop_micros);
+        Observe();
+    }
+
+    void Flush() {
+        do {
+            mock::i2s::Complete();
+            Observe();
+            Loop(1);
+        } while (is_pending_ || i2s::Gd32SpiDmaTxIsActive());
+    }
+
+    void Check(const char* name) {
+        CHECK(statistics_.rendered == on_wire_);
+        CHECK(statistics_.sent == statistics_.rendered + statistics_.coalesced + statistics_.dropped);
+        // Latest wins: the last frame sent is the last one on the wire
+        CHECK(last_on_wire_ == sequence_);
+
+        printf(" %-28s sent %4u, rendered %4u, coalesced %3u, dropped %3u\n", name, statistics_.sent, statistics_.rendered, statistics_.coalesced, statistics_.dropped);
+    }
+
+    const Statistics& GetStatistics() const { return statistics_; }
+
+   private:
+    void Observe() {
+        if (mock::i2s::GetFrames() == frames_) {
+            return;
+        }
+
+        // One transfer per loop at most
+        CHECK(mock::i2s::GetFrames() == frames_ + 1);
+        frames_ = mock::i2s::GetFrames();
+
+        const auto kSequence = GetWireSequence(groups_, grouping_count_);
+
+        // An older frame is never sent after a newer one
+        CHECK(kSequence > last_on_wire_);
+        last_on_wire_ = kSequence;
+        on_wire_++;
+    }
+
+    PixelDmx& pixel_dmx_;
+    uint32_t groups_;
+    uint32_t grouping_count_;
+    uint8_t data_[dmxnode::kUniverseSize]{};
+    uint32_t sequence_{0};
+    bool is_pending_{false};
+    Statistics statistics_{};
+    uint32_t frames_{0};
+    uint32_t on_wire_{0};
+    uint32_t last_on_wire_{0};
+};
+
+/*
+ * 10 seconds of DMX, the interval between the frames is 1 / 44 Hz changed by jitter_percent at random.
+ * The main loop calls Run() every loop_micros.
+ */
+Statistics Run(PixelDmx& pixel_dmx, const char* name, uint32_t groups, uint32_t grouping_count, uint32_t jitter_percent, uint32_t loop_micros = 20) {
+    Simulation simulation(pixel_dmx, groups, grouping_count);
+
+    const auto kEnd = mock::GetMicros() + 10000000U;
+    auto next = mock::GetMicros();
+
+    while (mock::GetMicros() < kEnd) {
+        if (mock::GetMicros() >= next) {
+            simulation.Arrive();
+
+            auto interval = kFrameMicros;
+
+            if (jitter_percent != 0) {
+                const auto kJitter = (kFrameMicros * jitter_percent) / 100U;
+                interval = interval - kJitter + (test::Random() % (2 * kJitter + 1));
+            }
+
+            next += interval;
+        }
+
+        simulation.Loop(loop_micros);
+    }
+
+    simulation.Flush();
+    simulation.Check(name);
+
+    return simulation.GetStatistics();
+}
+
+void TestRates(PixelDmx& pixel_dmx) {
+    // 510 pixels take 15.3 ms, all fit in the 22.7 ms of a frame
+    for (const auto kGroupingCount : {1U, 2U, 3U}) {
+        char name[32];
+        snprintf(name, sizeof(name), "%u pixels, 44 Hz", 170U * kGroupingCount);
+        const auto kStatistics = Run(pixel_dmx, name, 170, kGroupingCount, 0);
+        CHECK(kStatistics.rendered == kStatistics.sent);
+    }
+
+    // The frames that arrive too soon are queued, the newest one is rendered
+    for (const auto kGroupingCount : {1U, 2U, 3U}) {
+        char name[32];
+        snprintf(name, sizeof(name), "%u pixels, 44 Hz +/- 90%%", 170U * kGroupingCount);
+        const auto kStatistics = Run(pixel_dmx, name, 170, kGroupingCount, 90);
+
+        if (kGroupingCount == 3) {
+            CHECK(kStatistics.coalesced != 0);
+        }
+    }
+
+    // A slow main loop: a new frame can arrive before Run() has rendered the pending one
+    const auto kStatistics = Run(pixel_dmx, "510 pixels, slow main loop", 170, 3, 90, 2000);
+    CHECK(kStatistics.dropped != 0);
+}
+
+/*
+ * A frame for a port beyond the last protocol port does not update the output.
+ * Run() renders port 0 first, the output is then updating and the pending frame of port 1 is queued again from its own buffer.
+ */
+void TestRequeue(PixelDmx& pixel_dmx) {
+    Simulation simulation(pixel_dmx, 170, 1);
+    CHECK(PixelDmxConfiguration::Get().GetPortInfo().protocol_port_index_last == 0);
+
+    uint8_t data[dmxnode::kUniverseSize]{};
+
+    simulation.Arrive();
+    CHECK(i2s::Gd32SpiDmaTxIsActive());
+
+
+    simulation.Arrive();
+    pixel_dmx.SetData<true>(1, data, sizeof(data));
+
+    s_overlapping_copies = 0;
+
+    simulation.Flush();
+    simulation.Check("port 1 queued again");
+
+    CHECK(s_overlapping_copies == 0);
+}
+} // namespace
+
+int main() {
+    static PixelDmx pixel_dmx;
+
+    puts("DMX 44 Hz, WS2812B");
+
+    TestRates(pixel_dmx);
+    TestRequeue(pixel_dmx);
+
+    CHECK(mock::i2s::GetTornFrames() == 0);
+    CHECK(mock::i2s::GetOverruns() == 0);
+
+    return test::Result("pixeldmx_queue_test");
+}
@@ -0,0 +1,101 @@
+/**
+ * @file pixelpatterns_bench.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Host frames per second of the rainbow cycle and the theater chase at 680 pixels,
+ * against the old per pixel code of pixelpatterns_baseline.h. A frame is one Run(), the start of the transfer included.
+ * The RTZ render half holds 511 pixels, WS2812B is measured with 510 pixels.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#include <initializer_list>
+
+#include "pixelpatterns.h"
+#include "pixeloutput.h"
+#include "pixelconfiguration.h"
+#include "pixeltype.h"
+#include "gd32_spi.h"
+#include "pixelpatterns_baseline.h"
+#include "test.h"
+
+namespace {
+template <typename T> double Measure(T& patterns) {
+    static constexpr uint32_t kRuns = 500;
+    auto best = INT64_MAX;
+
+    for (uint32_t run = 0; run < kRuns; run++) {
+        mock::i2s::Complete();
+
+        const auto kStart = std::chrono::steady_clock::now();
+        patterns.Run();
+        const auto kNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - kStart).count();
+        best = std::min(best, static_cast<int64_t>(kNanos));
+    }
+
+    return 1e9 / static_cast<double>(best);
+}
+
+void Bench(PixelOutput& output, pixel::LedType type, uint32_t count) {
+    auto& pixel_configuration = PixelConfiguration::Get();
+    pixel_configuration.SetType(type);
+    pixel_configuration.SetCount(count);
+    pixel_configuration.Validate();
+    output.ApplyConfiguration();
+    mock::i2s::Complete();
+
+    PixelPatterns patterns(1);
+    baseline::PixelPatterns reference(1);
+
+    // An interval of 0 updates on every Run()
+    reference.RainbowCycle(0, 0);
+    const auto kRainbowBaseline = Measure(reference);
+    patterns.RainbowCycle(0, 0);
+    const auto kRainbow = Measure(patterns);
+
+    reference.TheaterChase(0, 0xFF0000, 0x000020, 0);
+    const auto kTheaterChaseBaseline = Measure(reference);
+    patterns.TheaterChase(0, 0xFF0000, 0x000020, 0);
+    const auto kTheaterChase = Measure(patterns);
+
+    printf(" %-8s %3u pixels : rainbow cycle %7.0f -> %7.0f, theater chase %7.0f -> %7.0f\n", pixel::GetTypeName(type), count, kRainbowBaseline, kRainbow,
+           kTheaterChaseBaseline, kTheaterChase);
+}
+} // namespace
+
+int main() {
+    static PixelConfiguration pixel_configuration;
+    static PixelOutput output;
+
+    puts("Test patterns, best of 500 runs, frames per second old -> new");
+
+    Bench(output, pixel::LedType::kWS2812B, 510);
+    Bench(output, pixel::LedType::kWS2801, 680);
+    Bench(output, pixel::LedType::kAPA102, 680);
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file pixelpatterns_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The frames of the test patterns on the simulated I2S DMA against the old per pixel code of pixelpatterns_baseline.h,
+ * frame by frame, for both directions and strip lengths that do and do not divide 256.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+
+#include "pixelpatterns.h"
+#include "pixeloutput.h"
+#include "pixelconfiguration.h"
+#include "pixeltype.h"
+#include "gd32_spi.h"
+#include "pixelpatterns_baseline.h"
+#include "test.h"
+
+namespace {
+constexpr uint32_t kInterval = 10;
+constexpr uint32_t kFrames = 300;
+
+enum class Case { kRainbowCycle, kTheaterChase, kColourWipe, kFade };
+
+constexpr const char* kCaseName[] = {"rainbow cycle", "theater chase", "colour wipe", "fade"};
+
+const uint8_t* Render(uint32_t& length) {
+    mock::i2s::Complete();
+    return mock::i2s::GetWire(length);
+}
+
+void Start(PixelPatterns& patterns, baseline::PixelPatterns& reference, Case pattern, pixelpatterns::Direction direction) {
+    constexpr auto kColour1 = pixel::GetColour(0xFF, 0x40, 0x10);
+    constexpr auto kColour2 = pixel::GetColour(0x20, 0x20, 0x20);
+
+    switch (pattern) {
+        case Case::kRainbowCycle:
+            patterns.RainbowCycle(0, kInterval, direction);
+            reference.RainbowCycle(0, kInterval, direction);
+            break;
+        case Case::kTheaterChase:
+            patterns.TheaterChase(0, kColour1, kColour2, kInterval, direction);
+            reference.TheaterChase(0, kColour1, kColour2, kInterval, direction);
+            break;
+        case Case::kColourWipe:
+            patterns.ColourWipe(0, kColour1, kInterval, direction);
+            reference.ColourWipe(0, kColour1, kInterval, direction);
+            break;
+        case Case::kFade:
+            patterns.Fade(0, kColour1, kColour2, 37, kInterval, direction);
+            reference.Fade(0, kColour1, kColour2, 37, kInterval, direction);
+            break;
+    }
+}
+
+/*
+ * Both render into the same output, each frame is sent and compared before the other one renders
+ */
+void TestPattern(PixelPatterns& patterns, baseline::PixelPatterns& reference, Case pattern, pixelpatterns::Direction direction) {
+    static uint8_t golden[24 * 1024];
+
+    Start(patterns, reference, pattern, direction);
+
+    for (uint32_t frame = 0; frame < kFrames; frame++) {
+        mock::Advance(kInterval * 1000U);
+
+        reference.Run();
+        uint32_t golden_length;
+        const auto* golden_wire = Render(golden_length);
+        memcpy(golden, golden_wire, golden_length);
+
+        patterns.Run();
+        uint32_t length;
+        const auto* wire = Render(length);
+
+        if ((length != golden_length) || (memcmp(wire, golden, length) != 0)) {
+            auto& pixel_configuration = PixelConfiguration::Get();
+            printf(" %s, %u pixels, %s, %s: frame %u differs\n", pixel::GetTypeName(pixel_configuration.GetType()), pixel_configuration.GetCount(),
+                   kCaseName[static_cast<uint32_t>(pattern)], direction == pixelpatterns::Direction::kForward ? "forward" : "reverse", frame);
+            CHECK(false);
+            return;
+        }
+    }
+}
+
+void TestType(PixelOutput& output, pixel::LedType type, uint32_t count) {
+    auto& pixel_configuration = PixelConfiguration::Get();
+    pixel_configuration.SetType(type);
+    pixel_configuration.SetCount(count);
+    pixel_configuration.Validate();
+    output.ApplyConfiguration();
+    mock::i2s::Complete();
+
+    PixelPatterns patterns(1);
+    baseline::PixelPatterns reference(1);
+
+    for (const auto kCase : {Case::kRainbowCycle, Case::kTheaterChase, Case::kColourWipe, Case::kFade}) {
+        TestPattern(patterns, reference, kCase, pixelpatterns::Direction::kForward);
+        TestPattern(patterns, reference, kCase, pixelpatterns::Direction::kReverse);
+    }
+}
+} // namespace
+
+int main() {
+    static PixelConfiguration pixel_configuration;
+    static PixelOutput output;
+
+    for (const auto kCount : {1U, 7U, 170U, 256U, 300U}) {
+        TestType(output, pixel::LedType::kWS2812B, kCount);
+        TestType(output, pixel::LedType::kSK6812W, kCount);
+        TestType(output, pixel::LedType::kWS2801, kCount);
+        TestType(output, pixel::LedType::kAPA102, kCount);
+    }
+
+    TestType(output, pixel::LedType::kWS2801, 680);
+    TestType(output, pixel::LedType::kAPA102, 680);
+
+    CHECK(mock::i2s::GetTornFrames() == 0);
+    CHECK(mock::i2s::GetOverruns() == 0);
+
+    return test::Result("pixelpatterns_test");
+}
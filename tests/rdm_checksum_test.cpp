@@ -0,0 +1,92 @@
+/**
+ * @file rdm_checksum_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+
+#include "rdmchecksum.h"
+#include "test.h"
+
+static uint16_t Reference(const uint8_t* data, uint32_t length) {
+    uint32_t sum = 0;
+
+    for (uint32_t i = 0; i < length; i++) {
+        sum += data[i];
+    }
+
+    return static_cast<uint16_t>(sum);
+}
+
+/**
+ * Every alignment and length, random data and all 0xFF.
+ * 0xFF in all bytes is the worst case for the 16-bit lanes of the fallback.
+ */
+static void TestAgainstReference() {
+    alignas(4) uint8_t buffer[1024 + 4];
+
+    for (uint32_t fill = 0; fill < 2; fill++) {
+        for (uint32_t i = 0; i < sizeof(buffer); i++) {
+            buffer[i] = (fill == 0) ? static_cast<uint8_t>(test::Random()) : 0xFF;
+        }
+
+        for (uint32_t offset = 0; offset < 4; offset++) {
+            for (uint32_t length = 0; length <= 1024; length++) {
+                CHECK(rdm::Checksum(&buffer[offset], length) == Reference(&buffer[offset], length));
+            }
+        }
+    }
+}
+
+static void TestIncremental() {
+    alignas(4) uint8_t buffer[257];
+
+    for (auto& byte : buffer) {
+        byte = static_cast<uint8_t>(test::Random());
+    }
+
+    for (uint32_t split = 0; split <= sizeof(buffer); split++) {
+        const auto kHead = rdm::Checksum(buffer, split);
+        CHECK(rdm::Checksum(&buffer[split], sizeof(buffer) - split, kHead) == Reference(buffer, sizeof(buffer)));
+    }
+}
+
+/**
+ * GET DEVICE_INFO request, the checksum covers the start code up to the last parameter data byte.
+ */
+static void TestMessage() {
+    const uint8_t kMessage[] = {0xCC, 0x01, 0x18, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xCB, 0xA9, 0x87, 0x65, 0x43, 0x21,
+                                0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x60, 0x00};
+    static_assert(sizeof(kMessage) == 24);
+
+    CHECK(rdm::Checksum(kMessage, sizeof(kMessage)) == Reference(kMessage, sizeof(kMessage)));
+    CHECK(rdm::Checksum(kMessage, sizeof(kMessage)) == 0x0694);
+}
+
+int main() {
+    TestAgainstReference();
+    TestIncremental();
+    TestMessage();
+
+    return test::Result("rdm_checksum_test");
+}
@@ -0,0 +1,149 @@
+/**
+ * @file rdm_pidindex_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstddef>
+
+#include "rdmhandler.h"
+#include "rdm_e120.h"
+#include "test.h"
+
+namespace {
+struct Definition {
+    uint16_t pid;
+    bool is_get;
+};
+
+constexpr auto kKey = [](const Definition& definition) { return definition.pid; };
+
+// SUPPORTED_PARAMETERS order, not PID order
+constexpr Definition kDefinitions[] = {
+    {E120_SUPPORTED_PARAMETERS, true}, {E120_QUEUED_MESSAGE, true},     {E120_DEVICE_INFO, true},
+    {E120_IDENTIFY_DEVICE, false},   {E120_DMX_START_ADDRESS, true},    {E120_SOFTWARE_VERSION_LABEL, true},
+    {E120_DEVICE_LABEL, false},      {E120_RESET_DEVICE, false},        {E120_FACTORY_DEFAULTS, true},
+};
+
+constexpr auto kIndex = rdmhandler::SortPidIndex(kDefinitions, kKey);
+static_assert(rdmhandler::IsPidIndexUnique(kDefinitions, kIndex, kKey));
+static_assert(!rdmhandler::IsPidTableSorted(kDefinitions, kKey));
+static_assert(rdmhandler::CountPids(kDefinitions, [](const Definition& definition) { return definition.is_get; }) == 6);
+
+constexpr Definition kDuplicates[] = {{E120_DEVICE_INFO, true}, {E120_DEVICE_LABEL, true}, {E120_DEVICE_INFO, false}};
+static_assert(!rdmhandler::IsPidIndexUnique(kDuplicates, rdmhandler::SortPidIndex(kDuplicates, kKey), kKey));
+} // namespace
+
+/**
+ * Same binary search as RDMHandler::FindPidDefinition
+ */
+template <typename T, size_t N> static const T* Find(const T (&table)[N], const rdmhandler::PidIndex<N>& index, uint16_t pid) {
+    uint32_t first = 0;
+    uint32_t last = N;
+
+    while (first < last) {
+        const auto kMiddle = (first + last) / 2;
+        const auto& definition = table[index.index[kMiddle]];
+
+        if (definition.pid == pid) {
+            return &definition;
+        }
+
+        if (definition.pid < pid) {
+            first = kMiddle + 1;
+        } else {
+            last = kMiddle;
+        }
+    }
+
+    return nullptr;
+}
+
+static void TestIndex() {
+    constexpr auto kCount = sizeof(kDefinitions) / sizeof(kDefinitions[0]);
+    bool seen[kCount]{};
+
+    for (size_t i = 0; i < kCount; i++) {
+        CHECK(kIndex.index[i] < kCount);
+        seen[kIndex.index[i]] = true;
+
+        if (i > 0) {
+            CHECK(kDefinitions[kIndex.index[i - 1]].pid < kDefinitions[kIndex.index[i]].pid);
+        }
+    }
+
+    for (const auto kSeen : seen) {
+        CHECK(kSeen);
+    }
+}
+
+static void TestFind() {
+    for (const auto& definition : kDefinitions) {
+        CHECK(Find(kDefinitions, kIndex, definition.pid) == &definition);
+    }
+
+    uint32_t found = 0;
+
+    for (uint32_t pid = 0; pid <= UINT16_MAX; pid++) {
+        if (Find(kDefinitions, kIndex, static_cast<uint16_t>(pid)) != nullptr) {
+            found++;
+        }
+    }
+
+    CHECK(found == sizeof(kDefinitions) / sizeof(kDefinitions[0]));
+}
+
+/**
+ * The largest table an 8-bit index supports, shuffled
+ */
+static void TestLarge() {
+    static Definition table[255];
+
+    for (size_t i = 0; i < 255; i++) {
+        table[i] = {static_cast<uint16_t>((254U - i) * 7U), false};
+    }
+
+    for (size_t i = 254; i > 0; i--) {
+        const auto kOther = test::Random() % (i + 1);
+        const auto kTemp = table[i];
+        table[i] = table[kOther];
+        table[kOther] = kTemp;
+    }
+
+    const auto kLargeIndex = rdmhandler::SortPidIndex(table, kKey);
+    CHECK(rdmhandler::IsPidIndexUnique(table, kLargeIndex, kKey));
+
+    for (size_t i = 0; i < 255; i++) {
+        CHECK(table[kLargeIndex.index[i]].pid == i * 7U);
+        CHECK(Find(table, kLargeIndex, static_cast<uint16_t>(i * 7U)) == &table[kLargeIndex.index[i]]);
+        CHECK(Find(table, kLargeIndex, static_cast<uint16_t>(i * 7U + 1U)) == nullptr);
+    }
+}
+
+int main() {
+    TestIndex();
+    TestFind();
+    TestLarge();
+
+    return test::Result("rdm_pidindex_test");
+}
@@ -0,0 +1,292 @@
+/**
+ * @file rdm_queuedmessage_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <utility>
+
+#include "rdmqueuedmessage.h"
+#include "e120.h"
+#include "rdm_e120.h"
+#include "test.h"
+
+static TRdmQueuedMessage Message(uint16_t pid, uint8_t value) {
+    TRdmQueuedMessage message{};
+    message.command_class = E120_GET_COMMAND_RESPONSE;
+    message.param_id[0] = static_cast<uint8_t>(pid >> 8);
+    message.param_id[1] = static_cast<uint8_t>(pid & 0xFF);
+    message.param_data_length = 2;
+    message.param_data[0] = value;
+    message.param_data[1] = static_cast<uint8_t>(~value);
+    return message;
+}
+
+static bool IsResponse(const TRdmMessage& response, uint16_t pid, uint8_t value) {
+    return (response.command_class == E120_GET_COMMAND_RESPONSE) && (response.param_id[0] == static_cast<uint8_t>(pid >> 8)) &&
+           (response.param_id[1] == static_cast<uint8_t>(pid & 0xFF)) && (response.param_data_length == 2) && (response.param_data[0] == value) &&
+           (response.param_data[1] == static_cast<uint8_t>(~value));
+}
+
+static bool IsEmpty(const TRdmMessage& response) {
+    return (response.param_id[0] == static_cast<uint8_t>(E120_STATUS_MESSAGES >> 8)) && (response.param_id[1] == static_cast<uint8_t>(E120_STATUS_MESSAGES & 0xFF)) &&
+           (response.param_data_length == 0);
+}
+
+static void Get(RDMQueuedMessage& queue, uint8_t status_type, TRdmMessage& response) {
+    response = TRdmMessage{};
+    queue.Handler(status_type, reinterpret_cast<uint8_t*>(&response));
+}
+
+static void TestEmpty() {
+    RDMQueuedMessage queue;
+    TRdmMessage response;
+
+    CHECK(queue.GetMessageCount() == 0);
+
+    Get(queue, E120_STATUS_ADVISORY, response);
+    CHECK(IsEmpty(response));
+
+    // Nothing was sent yet
+    Get(queue, E120_STATUS_GET_LAST_MESSAGE, response);
+    CHECK(IsEmpty(response));
+}
+
+/**
+ * A PID that is already queued is replaced in place, the queue keeps its order
+ */
+static void TestCoalescing() {
+    RDMQueuedMessage queue;
+    TRdmMessage response;
+
+    auto message = Message(E120_DMX_START_ADDRESS, 1);
+    CHECK(queue.Add(&message));
+    message = Message(E120_DEVICE_LABEL, 2);
+    CHECK(queue.Add(&message));
+    message = Message(E120_DMX_START_ADDRESS, 3);
+    CHECK(queue.Add(&message));
+    CHECK(queue.GetMessageCount() == 2);
+
+    Get(queue, E120_STATUS_ADVISORY, response);
+    CHECK(IsResponse(response, E120_DMX_START_ADDRESS, 3));
+    CHECK(queue.GetMessageCount() == 1);
+
+    Get(queue, E120_STATUS_GET_LAST_MESSAGE, response);
+    CHECK(IsResponse(response, E120_DMX_START_ADDRESS, 3));
+    CHECK(queue.GetMessageCount() == 1);
+
+    Get(queue, E120_STATUS_ADVISORY, response);
+    CHECK(IsResponse(response, E120_DEVICE_LABEL, 2));
+    CHECK(queue.GetMessageCount() == 0);
+
+    Get(queue, E120_STATUS_ADVISORY, response);
+    CHECK(IsEmpty(response));
+
+    Get(queue, E120_STATUS_GET_LAST_MESSAGE, response);
+    CHECK(IsResponse(response, E120_DEVICE_LABEL, 2));
+}
+
+/**
+ * SENSOR_VALUE is kept per sensor, the sensor number is the first parameter data byte
+ */
+static void TestSensorValue() {
+    RDMQueuedMessage queue;
+    TRdmMessage response;
+
+    auto message = Message(E120_SENSOR_VALUE, 0);
+    CHECK(queue.Add(&message));
+    message = Message(E120_SENSOR_VALUE, 1);
+    CHECK(queue.Add(&message));
+    message = Message(E120_SENSOR_VALUE, 0);
+    CHECK(queue.Add(&message));
+    CHECK(queue.GetMessageCount() == 2);
+
+    Get(queue, E120_STATUS_ADVISORY, response);
+    CHECK(IsResponse(response, E120_SENSOR_VALUE, 0));
+    Get(queue, E120_STATUS_ADVISORY, response);
+    CHECK(IsResponse(response, E120_SENSOR_VALUE, 1));
+}
+
+static void TestFull() {
+    RDMQueuedMessage queue;
+    TRdmMessage response;
+
+    for (uint32_t round = 0; round < 3; round++) {
+        for (uint32_t i = 0; i < rdm::queuedmessage::kCapacity; i++) {
+            auto message = Message(static_cast<uint16_t>(0x8000 + i), static_cast<uint8_t>(round));
+            CHECK(queue.Add(&message));
+        }
+
+        CHECK(queue.GetMessageCount() == rdm::queuedmessage::kCapacity);
+
+        // A new PID does not fit, a queued one is still updated
+        auto message = Message(0x9000, 0);
+        CHECK(!queue.Add(&message));
+        message = Message(0x8000, static_cast<uint8_t>(round + 10));
+        CHECK(queue.Add(&message));
+        CHECK(queue.GetMessageCount() == rdm::queuedmessage::kCapacity);
+
+        for (uint32_t i = 0; i < rdm::queuedmessage::kCapacity; i++) {
+            Get(queue, E120_STATUS_ADVISORY, response);
+            CHECK(IsResponse(response, static_cast<uint16_t>(0x8000 + i), static_cast<uint8_t>((i == 0) ? round + 10 : round)));
+        }
+
+        CHECK(queue.GetMessageCount() == 0);
+    }
+}
+
+static TRdmStatusMessage Status(uint8_t status_type, uint8_t sensor) {
+    TRdmStatusMessage status{};
+    status.status_type = status_type;
+    status.status_message_id[0] = static_cast<uint8_t>(E120_STS_SENS_OUT_RANGE >> 8);
+    status.status_message_id[1] = static_cast<uint8_t>(E120_STS_SENS_OUT_RANGE & 0xFF);
+    status.data_value1[1] = sensor;
+    return status;
+}
+
+/**
+ * The response holds the status messages of the sensors, in this order, with this status type
+ */
+static bool IsStatus(const TRdmMessage& response, std::initializer_list<std::pair<uint8_t, uint8_t>> expected) {
+    if ((response.param_id[0] != static_cast<uint8_t>(E120_STATUS_MESSAGES >> 8)) || (response.param_id[1] != static_cast<uint8_t>(E120_STATUS_MESSAGES & 0xFF)) ||
+        (response.command_class != E120_GET_COMMAND_RESPONSE) || (response.param_data_length != expected.size() * sizeof(TRdmStatusMessage))) {
+        return false;
+    }
+
+    const auto* status = reinterpret_cast<const TRdmStatusMessage*>(response.param_data);
+
+    for (const auto& [status_type, sensor] : expected) {
+        const auto kExpected = Status(status_type, sensor);
+        if (memcmp(status++, &kExpected, sizeof(TRdmStatusMessage)) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void GetStatus(RDMQueuedMessage& queue, uint8_t status_type, TRdmMessage& response) {
+    response = TRdmMessage{};
+    queue.StatusHandler(status_type, reinterpret_cast<uint8_t*>(&response));
+}
+
+/**
+ * Pending status messages count as one queued message, both PIDs take them from the same ring
+ */
+static void TestStatusMessages() {
+    RDMQueuedMessage queue;
+    TRdmMessage response;
+
+    GetStatus(queue, E120_STATUS_ADVISORY, response);
+    CHECK(IsStatus(response, {}));
+    GetStatus(queue, E120_STATUS_GET_LAST_MESSAGE, response);
+    CHECK(IsStatus(response, {}));
+
+    auto status = Status(E120_STATUS_WARNING, 0);
+    CHECK(queue.AddStatus(&status));
+    status = Status(E120_STATUS_WARNING, 1);
+    CHECK(queue.AddStatus(&status));
+    CHECK(queue.GetMessageCount() == 1);
+
+    auto message = Message(E120_DMX_START_ADDRESS, 1);
+    CHECK(queue.Add(&message));
+    CHECK(queue.GetMessageCount() == 2);
+
+    // Sensor 0 returned to the normal range before it was sent, the message is replaced in place
+    status = Status(E120_STATUS_WARNING_CLEARED, 0);
+    CHECK(queue.AddStatus(&status));
+    CHECK(queue.GetMessageCount() == 2);
+
+    // Not sent and not removed
+    GetStatus(queue, E120_STATUS_NONE, response);
+    CHECK(IsStatus(response, {}));
+    GetStatus(queue, E120_STATUS_ERROR, response);
+    CHECK(IsStatus(response, {}));
+    CHECK(queue.GetMessageCount() == 2);
+
+    // The queued PIDs go first
+    Get(queue, E120_STATUS_ADVISORY, response);
+    CHECK(IsResponse(response, E120_DMX_START_ADDRESS, 1));
+    CHECK(queue.GetMessageCount() == 1);
+
+    Get(queue, E120_STATUS_ADVISORY, response);
+    CHECK(IsStatus(response, {{E120_STATUS_WARNING_CLEARED, 0}, {E120_STATUS_WARNING, 1}}));
+    CHECK(queue.GetMessageCount() == 0);
+
+    Get(queue, E120_STATUS_GET_LAST_MESSAGE, response);
+    CHECK(IsStatus(response, {{E120_STATUS_WARNING_CLEARED, 0}, {E120_STATUS_WARNING, 1}}));
+    GetStatus(queue, E120_STATUS_GET_LAST_MESSAGE, response);
+    CHECK(IsStatus(response, {{E120_STATUS_WARNING_CLEARED, 0}, {E120_STATUS_WARNING, 1}}));
+
+    Get(queue, E120_STATUS_ADVISORY, response);
+    CHECK(IsEmpty(response));
+
+    // GET STATUS_MESSAGES sends the requested severity and higher, the others stay queued in order
+    status = Status(E120_STATUS_ADVISORY, 2);
+    CHECK(queue.AddStatus(&status));
+    status = Status(E120_STATUS_ERROR, 3);
+    CHECK(queue.AddStatus(&status));
+    status = Status(E120_STATUS_ADVISORY_CLEARED, 4);
+    CHECK(queue.AddStatus(&status));
+    status = Status(E120_STATUS_WARNING_CLEARED, 5);
+    CHECK(queue.AddStatus(&status));
+    CHECK(queue.GetMessageCount() == 1);
+
+    GetStatus(queue, E120_STATUS_WARNING, response);
+    CHECK(IsStatus(response, {{E120_STATUS_ERROR, 3}, {E120_STATUS_WARNING_CLEARED, 5}}));
+    CHECK(queue.GetMessageCount() == 1);
+
+    GetStatus(queue, E120_STATUS_ADVISORY, response);
+    CHECK(IsStatus(response, {{E120_STATUS_ADVISORY, 2}, {E120_STATUS_ADVISORY_CLEARED, 4}}));
+    CHECK(queue.GetMessageCount() == 0);
+
+    GetStatus(queue, E120_STATUS_GET_LAST_MESSAGE, response);
+    CHECK(IsStatus(response, {{E120_STATUS_ADVISORY, 2}, {E120_STATUS_ADVISORY_CLEARED, 4}}));
+
+    // Full
+    for (uint32_t i = 0; i < rdm::queuedmessage::kStatusCapacity; i++) {
+        status = Status(E120_STATUS_WARNING, static_cast<uint8_t>(i));
+        CHECK(queue.AddStatus(&status));
+    }
+
+    status = Status(E120_STATUS_WARNING, 0xFF);
+    CHECK(!queue.AddStatus(&status));
+    status = Status(E120_STATUS_WARNING_CLEARED, 0);
+    CHECK(queue.AddStatus(&status));
+
+    GetStatus(queue, E120_STATUS_ADVISORY, response);
+    CHECK(response.param_data_length == rdm::queuedmessage::kStatusCapacity * sizeof(TRdmStatusMessage));
+    CHECK(queue.GetMessageCount() == 0);
+}
+
+int main() {
+    TestEmpty();
+    TestCoalescing();
+    TestSensorValue();
+    TestFull();
+    TestStatusMessages();
+
+    return test::Result("rdm_queuedmessage_test");
+}
@@ -0,0 +1,245 @@
+/**
+ * @file rdm_sensors_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * RDMSensors on mock sensors: the software timer samples one sensor per tick, round robin.
+ * RDMHandler::QueueMessage() and QueueStatusMessage() are replaced by a recorder.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "rdmsensors.h"
+#include "rdmhandler.h"
+#include "softwaretimers.h"
+#include "gd32.h"
+#include "test.h"
+
+namespace {
+struct Queued {
+    uint16_t pid;
+    uint8_t param_data[rdm::sensor::kValuesParamDataLength];
+    uint8_t status_type;
+    int16_t data_value1;
+
+    bool operator==(const Queued& other) const {
+        return (pid == other.pid) && (memcmp(param_data, other.param_data, sizeof(param_data)) == 0) && (status_type == other.status_type) &&
+               (data_value1 == other.data_value1);
+    }
+};
+
+std::vector<Queued> s_queued;
+int16_t s_core_temperature = 40;
+uint32_t s_core_reads;
+
+class MockSensor final : public RDMSensor {
+   public:
+    MockSensor(uint8_t sensor, int16_t normal_min, int16_t normal_max) : RDMSensor(sensor) {
+        SetNormalMin(normal_min);
+        SetNormalMax(normal_max);
+    }
+
+    bool Initialize() override { return true; }
+
+    int16_t GetValue() override {
+        reads_++;
+        return value_;
+    }
+
+    int16_t value_{0};
+    uint32_t reads_{0};
+};
+} // namespace
+
+RDMHandler::RDMHandler() {}
+
+bool RDMHandler::QueueMessage(uint16_t param_id, const uint8_t* param_data, uint8_t param_data_length) {
+    CHECK(param_id == E120_SENSOR_VALUE);
+    CHECK(param_data_length == rdm::sensor::kValuesParamDataLength);
+
+    Queued queued{};
+    queued.pid = param_id;
+    memcpy(queued.param_data, param_data, param_data_length);
+    s_queued.push_back(queued);
+
+    return true;
+}
+
+bool RDMHandler::QueueStatusMessage(uint16_t sub_device, uint8_t status_type, uint16_t status_message_id, int16_t data_value1, int16_t data_value2) {
+    // Always directly after the SENSOR_VALUE of the same sensor
+    CHECK(sub_device == rdm::kRootDevice);
+    CHECK(status_message_id == E120_STS_SENS_OUT_RANGE);
+    CHECK(data_value2 == 0);
+    CHECK(!s_queued.empty() && (s_queued.back().status_type == 0));
+
+    if (!s_queued.empty()) {
+        s_queued.back().status_type = status_type;
+        s_queued.back().data_value1 = data_value1;
+    }
+
+    return true;
+}
+
+namespace board {
+float CoreTemperatureMin() {
+    return -40;
+}
+
+float CoreTemperatureMax() {
+    return 85;
+}
+
+float CoreTemperatureCurrent() {
+    s_core_reads++;
+    return s_core_temperature;
+}
+} // namespace board
+
+static void Tick() {
+    mock::Advance(rdm::sensors::kSampleIntervalMillis * 1000);
+    SoftwareTimerRun();
+}
+
+int main() {
+    RDMSensors rdm_sensors;
+
+    // Sensor 0 is the CPU temperature
+    CHECK(rdm_sensors.GetCount() == 1);
+
+    MockSensor* mock_sensor[3] = {new MockSensor(1, -100, 100), new MockSensor(2, 0, 1000), new MockSensor(3, -32768, 0)};
+
+    for (auto* sensor : mock_sensor) {
+        CHECK(rdm_sensors.Add(sensor));
+    }
+
+    static constexpr uint32_t kSensors = 4;
+    CHECK(rdm_sensors.GetCount() == kSensors);
+
+    const auto kReads = [&](uint32_t sensor) { return (sensor == 0) ? s_core_reads : mock_sensor[sensor - 1]->reads_; };
+
+    // A GET before the first sample reads the sensor, the timer still reports that it is out of range
+    mock_sensor[2]->value_ = 5;
+    CHECK(rdm_sensors.GetValues(3)->present == 5);
+    CHECK(kReads(3) == 1);
+    CHECK(s_queued.empty());
+
+    int16_t present[kSensors];
+    bool is_normal[kSensors] = {true, true, true, true};
+    bool is_sampled[kSensors] = {false, false, false, true};
+    present[3] = 5;
+
+    for (uint32_t tick = 0; tick < 20000; tick++) {
+        // Mostly in range, now and then out of range
+        s_core_temperature = static_cast<int16_t>((test::Random() % 8 == 0) ? 86 + test::Random() % 20 : 20 + test::Random() % 40);
+        mock_sensor[0]->value_ = static_cast<int16_t>((test::Random() % 8 == 0) ? 101 + test::Random() % 50 : -100 + static_cast<int32_t>(test::Random() % 201));
+        mock_sensor[1]->value_ = static_cast<int16_t>((test::Random() % 8 == 0) ? -1 - static_cast<int32_t>(test::Random() % 50) : test::Random() % 1001);
+        mock_sensor[2]->value_ = static_cast<int16_t>((test::Random() % 8 == 0) ? 1 + test::Random() % 50 : -static_cast<int32_t>(test::Random() % 1000));
+
+        uint32_t reads[kSensors];
+        for (uint32_t i = 0; i < kSensors; i++) {
+            reads[i] = kReads(i);
+        }
+
+        const auto kQueued = s_queued.size();
+
+        Tick();
+
+        // Round robin, one read per tick
+        const auto kSampled = tick % kSensors;
+
+        for (uint32_t i = 0; i < kSensors; i++) {
+            CHECK(kReads(i) == reads[i] + ((i == kSampled) ? 1 : 0));
+        }
+
+        present[kSampled] = (kSampled == 0) ? s_core_temperature : mock_sensor[kSampled - 1]->value_;
+        is_sampled[kSampled] = true;
+
+        const auto* definition = rdm_sensors.GetDefintion(static_cast<uint8_t>(kSampled));
+        const auto kIsNormal = (present[kSampled] >= definition->normal_min) && (present[kSampled] <= definition->normal_max);
+
+        // Queued exactly when the value leaves or returns to the normal range
+        if (kIsNormal != is_normal[kSampled]) {
+            CHECK(s_queued.size() == kQueued + 1);
+
+            if (s_queued.size() == kQueued + 1) {
+                Queued expected{};
+                expected.pid = E120_SENSOR_VALUE;
+                rdm::sensor::ValuesToParamData(*rdm_sensors.GetValues(static_cast<uint8_t>(kSampled)), expected.param_data);
+                expected.status_type = kIsNormal ? E120_STATUS_WARNING_CLEARED : E120_STATUS_WARNING;
+                expected.data_value1 = static_cast<int16_t>(kSampled);
+
+                CHECK(s_queued.back() == expected);
+                CHECK(s_queued.back().param_data[0] == kSampled);
+                CHECK(static_cast<int16_t>((s_queued.back().param_data[1] << 8) | s_queued.back().param_data[2]) == present[kSampled]);
+            }
+        } else {
+            CHECK(s_queued.size() == kQueued);
+        }
+
+        is_normal[kSampled] = kIsNormal;
+
+        // The GETs only read the cache
+        for (uint32_t i = 0; i < kSensors; i++) {
+            reads[i] = kReads(i);
+        }
+
+        for (uint32_t i = 0; i < kSensors; i++) {
+            if (is_sampled[i]) {
+                const auto* values = rdm_sensors.GetValues(static_cast<uint8_t>(i));
+                CHECK(values->present == present[i]);
+                CHECK(values->sensor_requested == i);
+                CHECK(values->lowest_detected <= values->present);
+                CHECK(values->highest_detected >= values->present);
+            }
+        }
+
+        for (uint32_t i = 0; i < kSensors; i++) {
+            CHECK(kReads(i) == reads[i]);
+        }
+    }
+
+    // Without a change of range nothing is queued
+    const auto kQueued = s_queued.size();
+    s_core_temperature = 50;
+    mock_sensor[0]->value_ = 0;
+    mock_sensor[1]->value_ = 500;
+    mock_sensor[2]->value_ = -500;
+
+    for (uint32_t tick = 0; tick < 2 * kSensors; tick++) {
+        Tick();
+    }
+
+    const auto kQueuedNormal = s_queued.size();
+    CHECK(kQueuedNormal <= kQueued + kSensors);
+
+    for (uint32_t tick = 0; tick < 100 * kSensors; tick++) {
+        Tick();
+    }
+
+    CHECK(s_queued.size() == kQueuedNormal);
+
+    return test::Result("rdm_sensors_test");
+}
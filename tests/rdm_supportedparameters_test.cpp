@@ -0,0 +1,184 @@
+/**
+ * @file rdm_supportedparameters_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include "rdmhandler.h"
+#include "rdm_e120.h"
+#include "test.h"
+
+namespace {
+struct Definition {
+    uint16_t nPid;
+    bool bIncludeInSupportedParams;
+};
+
+constexpr auto kIsSupported = [](const Definition& definition) { return definition.bIncludeInSupportedParams; };
+constexpr auto kKey = [](const Definition& definition) { return definition.nPid; };
+
+constexpr rdmhandler::ParameterDescription Description(uint16_t pid) { return {pid, 0, 0, 0, 0, 0, 0, 0, 0, 0, nullptr, 0}; }
+
+// The manufacturer PIDs are stored byte swapped
+constexpr rdmhandler::ParameterDescription kDescriptions[rdmhandler::kManufacturerPidsMax] = {
+    Description(__builtin_bswap16(0x8000)), Description(__builtin_bswap16(0x8001)), Description(__builtin_bswap16(0x8002)), Description(__builtin_bswap16(0x8003)),
+    Description(__builtin_bswap16(0x8010)), Description(__builtin_bswap16(0x8011)), Description(__builtin_bswap16(0x8012)), Description(__builtin_bswap16(0x8013)),
+    Description(__builtin_bswap16(0x8100)), Description(__builtin_bswap16(0x8101)), Description(__builtin_bswap16(0x8102)), Description(__builtin_bswap16(0x8103)),
+    Description(__builtin_bswap16(0xFF00)), Description(__builtin_bswap16(0xFF01)), Description(__builtin_bswap16(0xFFDE)), Description(__builtin_bswap16(0xFFDF)),
+};
+} // namespace
+
+namespace baseline {
+/**
+ * RDMHandler::GetSupportedParameters before the reply was cached, with the response in param_data
+ */
+template <typename PidDefinition>
+static uint8_t GetSupportedParameters(const PidDefinition* pid_definitions, uint32_t table_size, const rdmhandler::ParameterDescription* PARAMETER_DESCRIPTIONS,
+                                      uint32_t nSupportedParamsManufacturer, uint8_t* param_data) {
+    uint8_t nSupportedParams = 0;
+    uint32_t j = 0;
+
+    for (uint32_t i = 0; i < table_size; i++) {
+        if (pid_definitions[i].bIncludeInSupportedParams) {
+            nSupportedParams++;
+            param_data[j + j] = static_cast<uint8_t>(pid_definitions[i].nPid >> 8);
+            param_data[j + j + 1] = static_cast<uint8_t>(pid_definitions[i].nPid);
+            j++;
+        }
+    }
+
+    nSupportedParams = static_cast<uint8_t>(nSupportedParams + nSupportedParamsManufacturer);
+
+    for (uint32_t i = 0; i < nSupportedParamsManufacturer; i++) {
+        param_data[j + j] = static_cast<uint8_t>(PARAMETER_DESCRIPTIONS[i].pid); ///< The PIDs are swapped
+        param_data[j + j + 1] = static_cast<uint8_t>(PARAMETER_DESCRIPTIONS[i].pid >> 8);
+        j++;
+    }
+
+    return static_cast<uint8_t>(2 * nSupportedParams);
+}
+} // namespace baseline
+
+template <size_t N> static bool IsSame(const Definition (&table)[N], uint32_t description_count) {
+    uint8_t expected[231];
+    const auto kLength = baseline::GetSupportedParameters(table, N, kDescriptions, description_count, expected);
+
+    rdmhandler::SupportedParameters supported_parameters{};
+    memset(supported_parameters.param_data, 0xA5, sizeof(supported_parameters.param_data));
+    rdmhandler::BuildSupportedParameters(table, kIsSupported, kKey, kDescriptions, description_count, supported_parameters);
+
+    return supported_parameters.is_built && (supported_parameters.param_data_length == kLength) && (memcmp(supported_parameters.param_data, expected, kLength) == 0);
+}
+
+/**
+ * The root device PIDs of the responder with all options, in PID_DEFINITIONS order
+ */
+static void TestResponder() {
+    static constexpr Definition kDefinitions[] = {
+        {E120_DEVICE_INFO, false},
+        {E120_DEVICE_MODEL_DESCRIPTION, true},
+        {E120_MANUFACTURER_LABEL, true},
+        {E120_DEVICE_LABEL, true},
+        {E120_FACTORY_DEFAULTS, true},
+        {E120_IDENTIFY_DEVICE, false},
+        {E120_RESET_DEVICE, true},
+        {E120_QUEUED_MESSAGE, true},
+        {E120_STATUS_MESSAGES, true},
+        {E120_SUPPORTED_PARAMETERS, false},
+        {E120_PARAMETER_DESCRIPTION, false},
+        {E120_PRODUCT_DETAIL_ID_LIST, true},
+        {E120_LANGUAGE_CAPABILITIES, true},
+        {E120_LANGUAGE, true},
+        {E120_SOFTWARE_VERSION_LABEL, false},
+        {E120_BOOT_SOFTWARE_VERSION_ID, true},
+        {E120_BOOT_SOFTWARE_VERSION_LABEL, true},
+        {E120_DMX_PERSONALITY, true},
+        {E120_DMX_PERSONALITY_DESCRIPTION, true},
+        {E120_DMX_START_ADDRESS, false},
+        {E120_SLOT_INFO, true},
+        {E120_SLOT_DESCRIPTION, true},
+        {E120_SENSOR_DEFINITION, true},
+        {E120_SENSOR_VALUE, true},
+        {E120_RECORD_SENSORS, true},
+        {E120_DEVICE_HOURS, true},
+        {E120_DISPLAY_INVERT, true},
+        {E120_DISPLAY_LEVEL, true},
+        {E120_REAL_TIME_CLOCK, true},
+        {E120_POWER_STATE, true},
+        {E120_PERFORM_SELFTEST, true},
+        {E120_SELF_TEST_DESCRIPTION, true},
+        {E120_PRESET_PLAYBACK, true},
+        {E137_1_IDENTIFY_MODE, true},
+    };
+
+    static_assert((rdmhandler::CountPids(kDefinitions, kIsSupported) + rdmhandler::kManufacturerPidsMax) * 2 <= sizeof(rdmhandler::SupportedParameters::param_data));
+
+    for (uint32_t count = 0; count <= rdmhandler::kManufacturerPidsMax; count++) {
+        CHECK(IsSame(kDefinitions, count));
+    }
+}
+
+static void TestRandom() {
+    for (uint32_t run = 0; run < 10000; run++) {
+        Definition definitions[64];
+
+        for (auto& definition : definitions) {
+            definition.nPid = static_cast<uint16_t>(test::Random());
+            definition.bIncludeInSupportedParams = (test::Random() % 4) == 0;
+        }
+
+        // Keep room for the manufacturer PIDs, as the static_assert in GetSupportedParameters does
+        uint32_t supported = 0;
+        for (auto& definition : definitions) {
+            if (definition.bIncludeInSupportedParams && (++supported > (231 / 2) - rdmhandler::kManufacturerPidsMax)) {
+                definition.bIncludeInSupportedParams = false;
+            }
+        }
+
+        CHECK(IsSame(definitions, test::Random() % (rdmhandler::kManufacturerPidsMax + 1)));
+    }
+}
+
+/**
+ * An empty reply is a built reply, the length is not the sentinel
+ */
+static void TestEmpty() {
+    static constexpr Definition kDefinitions[] = {{E120_DEVICE_INFO, false}, {E120_SUPPORTED_PARAMETERS, false}};
+
+    rdmhandler::SupportedParameters supported_parameters{};
+    rdmhandler::BuildSupportedParameters(kDefinitions, kIsSupported, kKey, nullptr, 0, supported_parameters);
+
+    CHECK(supported_parameters.is_built);
+    CHECK(supported_parameters.param_data_length == 0);
+    CHECK(IsSame(kDefinitions, 0));
+}
+
+int main() {
+    TestResponder();
+    TestRandom();
+    TestEmpty();
+
+    return test::Result("rdm_supportedparameters_test");
+}
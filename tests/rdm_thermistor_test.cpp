@@ -0,0 +1,213 @@
+/**
+ * @file rdm_thermistor_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * RDMSensorThermistor on a simulated MCP3424 on the mock I2C bus.
+ * The sensors of the four inputs share one MCP3424, as RdmSensorsParams::Set() creates them.
+ */
+
+#include <cstdint>
+
+#include "rdmsensorthermistor.h"
+#include "mcp3424.h"
+#include "thermistor.h"
+#include "i2c_device.h"
+#include "gd32.h"
+#include "test.h"
+
+namespace {
+/**
+ * 12 bits, continuous conversion: a result every 1/240 s, RDY is cleared once per result
+ */
+class Mcp3424Model final : public mock::i2c::Device {
+   public:
+    static constexpr uint32_t kConversionMicros = 1000000 / 240;
+
+    uint8_t Write(const char* buffer, uint32_t length) override {
+        CHECK(length == 1);
+        config_ = static_cast<uint8_t>(buffer[0]);
+        CHECK((config_ & 0x0C) == 0x00); // 12 bits
+        CHECK((config_ & 0x10) == 0x10); // Continuous
+        ready_micros_ = mock::GetMicros() + kConversionMicros;
+        return GD32_I2C_OK;
+    }
+
+    uint8_t Read(char* buffer, uint32_t length) override {
+        CHECK(length == 3);
+        const auto kChannel = (config_ >> 5) & 0x03;
+        auto config = static_cast<uint8_t>(config_ | 0x80);
+
+        if (!stalled[kChannel] && (mock::GetMicros() >= ready_micros_)) {
+            last_code_ = milli_volt[kChannel];
+            config = static_cast<uint8_t>(config & ~0x80);
+            ready_micros_ += kConversionMicros;
+            results[kChannel]++;
+        }
+
+        buffer[0] = static_cast<char>((last_code_ >> 8) & 0x0F);
+        buffer[1] = static_cast<char>(last_code_ & 0xFF);
+        buffer[2] = static_cast<char>(config);
+        return GD32_I2C_OK;
+    }
+
+    uint16_t milli_volt[4]{};
+    bool stalled[4]{};
+    uint32_t results[4]{};
+
+   private:
+    uint8_t config_{0};
+    uint16_t last_code_{0};
+    uint64_t ready_micros_{0};
+};
+
+constexpr uint8_t kAddress = 0x68;
+constexpr uint32_t kTickMicros = 1000;
+
+Mcp3424Model s_model;
+
+/**
+ * The reference of RDMSensorThermistor::Resistor() without calibration
+ */
+int16_t Expected(uint32_t milli_volt) {
+    const auto kResistor = static_cast<uint32_t>(((UINT64_C(5000000) * 6800) / (milli_volt * 1000U)) - 6800 - 10000);
+    return static_cast<int16_t>(sensor::thermistor::TemperatureDeci(kResistor) / 10);
+}
+
+/**
+ * One GetValue() per tick, round robin over the sensors as RDMSensors samples them.
+ * No call may block: at most one read and one write on the bus.
+ */
+void Run(RDMSensorThermistor* sensors[4], int16_t values[4], uint32_t ticks) {
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+        const auto kIndex = tick & 0x03;
+
+        mock::i2c::ResetStatistics();
+        const auto kStart = mock::GetMicros();
+
+        values[kIndex] = sensors[kIndex]->GetValue();
+
+        const auto& kStatistics = mock::i2c::GetStatistics();
+        CHECK(kStatistics.reads <= 1);
+        CHECK(kStatistics.writes <= 1);
+        CHECK((mock::GetMicros() - kStart) < 500);
+
+        mock::Advance(kTickMicros);
+    }
+}
+} // namespace
+
+int main() {
+    mock::i2c::Attach(kAddress, &s_model);
+    s_model.milli_volt[0] = 1268; // 10K, 25 degrees Celcius
+    s_model.milli_volt[1] = 1500;
+    s_model.milli_volt[2] = 1000;
+    s_model.milli_volt[3] = 1800;
+
+    MCP3424 mcp3424(kAddress);
+    CHECK(mcp3424.IsConnected());
+    mcp3424.SetChannelMask(0);
+
+    RDMSensorThermistor thermistor0(0, mcp3424, 0);
+    RDMSensorThermistor thermistor1(1, mcp3424, 1);
+    RDMSensorThermistor thermistor2(2, mcp3424, 2);
+    RDMSensorThermistor thermistor3(3, mcp3424, 3);
+    RDMSensorThermistor* sensors[4] = {&thermistor0, &thermistor1, &thermistor2, &thermistor3};
+
+    // Initialize() only enables the input, it does not touch the bus
+    mock::i2c::ResetStatistics();
+    const auto kStart = mock::GetMicros();
+
+    for (auto* sensor : sensors) {
+        CHECK(sensor->Initialize());
+    }
+
+    CHECK(mock::i2c::GetStatistics().reads == 0);
+    CHECK(mock::i2c::GetStatistics().writes == 0);
+    CHECK(mock::GetMicros() == kStart);
+    CHECK(mcp3424.GetChannelMask() == 0x0F);
+
+    // The first result seeds the value, before 4 of them are averaged
+    int16_t values[4]{};
+    uint32_t ticks = 0;
+
+    while ((values[0] == 0) || (values[1] == 0) || (values[2] == 0) || (values[3] == 0)) {
+        Run(sensors, values, 4);
+        ticks += 4;
+        CHECK(ticks < 1000);
+
+        if (ticks >= 1000) {
+            break;
+        }
+    }
+
+    for (uint32_t i = 0; i < 4; i++) {
+        CHECK(s_model.results[i] < 4);
+        CHECK(values[i] == Expected(s_model.milli_volt[i]));
+    }
+
+    // The conversions are taken in turn, no input is starved
+    Run(sensors, values, 4000);
+
+    for (uint32_t i = 1; i < 4; i++) {
+        CHECK((s_model.results[i] + 1 >= s_model.results[0]) && (s_model.results[i] <= s_model.results[0] + 1));
+    }
+
+    // A new input voltage is reported once 4 results are averaged
+    s_model.milli_volt[0] = 1100;
+    const auto kResults = s_model.results[0];
+
+    Run(sensors, values, 400);
+    CHECK(s_model.results[0] >= kResults + 8);
+    CHECK(values[0] == Expected(1100));
+
+    // A conversion that times out is dropped: the input keeps its value, the others are still converted
+    s_model.stalled[2] = true;
+    const auto kStalled = s_model.results[2];
+    const int16_t kPrevious = values[2];
+    uint32_t results[4];
+
+    for (uint32_t i = 0; i < 4; i++) {
+        results[i] = s_model.results[i];
+    }
+
+    Run(sensors, values, 4000);
+
+    CHECK(s_model.results[2] == kStalled);
+    CHECK(values[2] == kPrevious);
+
+    for (uint32_t i = 0; i < 4; i++) {
+        if (i != 2) {
+            CHECK(s_model.results[i] > results[i] + 100);
+        }
+    }
+
+    // Recovered
+    s_model.stalled[2] = false;
+    s_model.milli_volt[2] = 1700;
+    Run(sensors, values, 4000);
+    CHECK(values[2] == Expected(1700));
+
+    return test::Result("rdm_thermistor_test");
+}
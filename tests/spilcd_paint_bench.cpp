@@ -0,0 +1,111 @@
+/**
+ * @file spilcd_paint_bench.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Frame time of lib-display Paint on the ST7789 240x240, at the 20 MHz SPI clock that SpiLcd sets,
+ * with the SPI of mock/gd32_spi.cpp on the simulated clock.
+ *
+ * A full screen fill, and a full screen of text drawn per line with DrawString() against per character with DrawChar().
+ * The rendering takes no simulated time: with the double strips it overlaps the transfer of the previous strip,
+ * the frame time on the target is the bus time plus the rendering of the first strip.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+
+#include "gd32_spi.h"
+#include "spi/st7789.h"
+#include "test.h"
+
+namespace {
+class Counter final : public mock::spi::Device {
+   public:
+    void Write([[maybe_unused]] const uint8_t* data, uint32_t length, bool is_data) override {
+        if (!is_data) {
+            commands += length;
+        }
+    }
+
+    uint32_t commands{0};
+};
+
+constexpr uint32_t kLines = 10;
+constexpr uint32_t kColumns = 15;
+
+Counter s_counter;
+char s_text[kLines][kColumns];
+
+void Measure(const char* name, const std::function<void()>& draw) {
+    mock::spi::ResetStatistics();
+    s_counter.commands = 0;
+
+    const auto kStart = mock::GetMicros();
+    draw();
+    const auto kMicros = static_cast<uint32_t>(mock::GetMicros() - kStart);
+
+    const auto& kStatistics = mock::spi::GetStatistics();
+
+    CHECK(kStatistics.torn == 0);
+    CHECK(kStatistics.collisions == 0);
+
+    printf(" %-30s %6u %4u %7u %5u %7u %6.1f\n", name, kStatistics.transfers, kStatistics.dma_transfers, kStatistics.bytes, s_counter.commands, kMicros,
+           1e6 / kMicros);
+}
+} // namespace
+
+int main() {
+    mock::spi::Attach(&s_counter, SPI_LCD_DC_GPIO);
+
+    ST7789 lcd(0);
+
+    for (uint32_t line = 0; line < kLines; line++) {
+        for (uint32_t column = 0; column < kColumns; column++) {
+            s_text[line][column] = static_cast<char>(' ' + 1 + test::Random() % 94);
+        }
+    }
+
+    printf("ST7789 %ux%u, SPI at 20 MHz\n", lcd.GetWidth(), lcd.GetHeight());
+    printf(" %-30s %6s %4s %7s %5s %7s %6s\n", "frame", "xfer", "dma", "bytes", "cmds", "us", "fps");
+
+    Measure("FillColour()", [&] { lcd.FillColour(st77xx::colour::kBlue); });
+
+    Measure("Text, DrawString() per line", [&] {
+        for (uint32_t line = 0; line < kLines; line++) {
+            lcd.DrawString(0, line * Font16x24.kHeight, s_text[line], kColumns, &Font16x24, st77xx::colour::kBlack, st77xx::colour::kWhite);
+        }
+    });
+
+    Measure("Text, DrawChar() per character", [&] {
+        for (uint32_t line = 0; line < kLines; line++) {
+            for (uint32_t column = 0; column < kColumns; column++) {
+                lcd.DrawChar(column * Font16x24.kWidth, line * Font16x24.kHeight, s_text[line][column], &Font16x24, st77xx::colour::kBlack,
+                             st77xx::colour::kWhite);
+            }
+        }
+    });
+
+    return test::Result("spilcd_paint_bench");
+}
@@ -0,0 +1,311 @@
+/**
+ * @file spilcd_paint_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * lib-display Paint on the ST7789 240x240, with the SPI of mock/gd32_spi.cpp and a model of the ST7789 frame memory.
+ * Built with SPI_DMAx for the double strips and without it for the blocking writes.
+ *
+ * The fills and the text are checked pixel exact, and no strip buffer may be written while its DMA transfer is active.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include "gd32_spi.h"
+#include "spi/st7789.h"
+#include "test.h"
+
+namespace {
+constexpr uint32_t kWidth = 240;
+constexpr uint32_t kHeight = 240;
+constexpr uint32_t kMemoryRows = 320;
+constexpr uint32_t kShiftY = 80; ///< st7789::kRotation0ShiftY
+
+/**
+ * The ST7789 frame memory, written through the column and row address window, 16 bits per pixel MSB first
+ */
+class St7789Model final : public mock::spi::Device {
+   public:
+    void Write(const uint8_t* data, uint32_t length, bool is_data) override {
+        if (!is_data) {
+            for (uint32_t i = 0; i < length; i++) {
+                command_ = data[i];
+                arguments_ = 0;
+                commands++;
+                if (command_ == st77xx::cmd::kRamwr) {
+                    x_ = x0_;
+                    y_ = y0_;
+                    is_msb_ = true;
+                }
+            }
+            return;
+        }
+
+        for (uint32_t i = 0; i < length; i++) {
+            const auto kByte = data[i];
+
+            switch (command_) {
+                case st77xx::cmd::kCaSet:
+                    SetRange(kByte, x0_, x1_);
+                    break;
+                case st77xx::cmd::kRaset:
+                    SetRange(kByte, y0_, y1_);
+                    break;
+                case st77xx::cmd::kRamwr:
+                    WritePixel(kByte);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    uint16_t Pixel(uint32_t x, uint32_t y) const { return memory_[y + kShiftY][x]; }
+
+    uint32_t commands{0};
+
+   private:
+    void SetRange(uint8_t byte, uint32_t& start, uint32_t& end) {
+        switch (arguments_++) {
+            case 0:
+                start = static_cast<uint32_t>(byte) << 8;
+                break;
+            case 1:
+                start |= byte;
+                break;
+            case 2:
+                end = static_cast<uint32_t>(byte) << 8;
+                break;
+            case 3:
+                end |= byte;
+                break;
+            default:
+                break;
+        }
+    }
+
+    void WritePixel(uint8_t byte) {
+        if (is_msb_) {
+            msb_ = byte;
+            is_msb_ = false;
+            return;
+        }
+
+        is_msb_ = true;
+
+        if ((y_ < kMemoryRows) && (x_ < kWidth)) {
+            memory_[y_][x_] = static_cast<uint16_t>((msb_ << 8) | byte);
+        }
+
+        if (++x_ > x1_) {
+            x_ = x0_;
+            y_++;
+        }
+    }
+
+    uint16_t memory_[kMemoryRows][kWidth]{};
+    uint8_t command_{0};
+    uint32_t arguments_{0};
+    uint32_t x0_{0}, x1_{0}, y0_{0}, y1_{0};
+    uint32_t x_{0}, y_{0};
+    uint8_t msb_{0};
+    bool is_msb_{true};
+};
+
+St7789Model s_model;
+uint16_t s_expected[kHeight][kWidth];
+
+void ExpectFill(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1, uint16_t colour) {
+    for (auto y = y0; y <= y1; y++) {
+        for (auto x = x0; x <= x1; x++) {
+            s_expected[y][x] = colour;
+        }
+    }
+}
+
+/**
+ * The font tables: 8 wide in the low byte MSB first, less than 16 wide MSB first, 16 and wider LSB first
+ */
+bool IsSet(const sFONT* font, char c, uint32_t row, uint32_t column) {
+    const auto kLine = static_cast<uint32_t>(font->table[static_cast<uint32_t>(c - ' ') * font->kHeight + row]);
+
+    if (font->kWidth == 8) {
+        return (kLine & (0x80U >> column)) != 0;
+    }
+
+    if (font->kWidth < 16) {
+        return (kLine & (0x8000U >> column)) != 0;
+    }
+
+    return (kLine & (1U << column)) != 0;
+}
+
+void ExpectText(uint32_t x0, uint32_t y0, const char* text, uint32_t length, const sFONT* font, uint16_t background, uint16_t foreground) {
+    for (uint32_t i = 0; i < length; i++) {
+        for (uint32_t row = 0; row < font->kHeight; row++) {
+            for (uint32_t column = 0; column < font->kWidth; column++) {
+                s_expected[y0 + row][x0 + i * font->kWidth + column] = IsSet(font, text[i], row, column) ? foreground : background;
+            }
+        }
+    }
+}
+
+bool IsExpected() {
+    for (uint32_t y = 0; y < kHeight; y++) {
+        for (uint32_t x = 0; x < kWidth; x++) {
+            if (s_model.Pixel(x, y) != s_expected[y][x]) {
+                printf("(%u,%u) is 0x%.4x, expected 0x%.4x\n", x, y, s_model.Pixel(x, y), s_expected[y][x]);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void CheckBus() {
+    const auto& kStatistics = mock::spi::GetStatistics();
+    CHECK(kStatistics.torn == 0);
+    CHECK(kStatistics.collisions == 0);
+    CHECK(kStatistics.dc_changes == 0);
+    CHECK(!Gd32SpiDmaTxIsActive());
+}
+
+void TestFill(ST7789& lcd) {
+    mock::spi::ResetStatistics();
+    lcd.FillColour(st77xx::colour::kBlue);
+    ExpectFill(0, 0, kWidth - 1, kHeight - 1, st77xx::colour::kBlue);
+    CHECK(IsExpected());
+    CheckBus();
+
+    // The window, one strip and a part
+    lcd.Fill(10, 20, 209, 29, st77xx::colour::kRed);
+    ExpectFill(10, 20, 209, 29, st77xx::colour::kRed);
+    CHECK(IsExpected());
+
+    // Exactly one strip
+    lcd.Fill(0, 40, kWidth - 1, 44, st77xx::colour::kGreen);
+    ExpectFill(0, 40, kWidth - 1, 44, st77xx::colour::kGreen);
+    CHECK(IsExpected());
+
+    // Out of the screen, nothing is drawn
+    lcd.Fill(0, 0, kWidth, 10, st77xx::colour::kWhite);
+    CHECK(IsExpected());
+    CheckBus();
+}
+
+void TestText(ST7789& lcd) {
+    static constexpr char kText[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz !#%&()*+,-./:;<=>?@[]^_{|}~";
+    sFONT* const kFonts[] = {&Font16x24, &Font12x12, &Font8x16, &Font8x12, &Font8x8};
+
+    uint32_t y = 50;
+
+    for (auto* font : kFonts) {
+        const auto kColumns = kWidth / font->kWidth;
+
+        // Longer than the line, it is cut at the right edge
+        mock::spi::ResetStatistics();
+        lcd.DrawString(0, y, kText, sizeof(kText) - 1, font, st77xx::colour::kBlack, st77xx::colour::kYellow);
+        ExpectText(0, y, kText, kColumns, font, st77xx::colour::kBlack, st77xx::colour::kYellow);
+        CHECK(IsExpected());
+        CheckBus();
+
+        // A text line is one address window
+        CHECK(s_model.commands != 0);
+        y += font->kHeight;
+
+        // Not starting at the left edge
+        lcd.DrawString(font->kWidth + 3, y, &kText[7], 5, font, st77xx::colour::kDarkblue, st77xx::colour::kWhite);
+        ExpectText(font->kWidth + 3, y, &kText[7], 5, font, st77xx::colour::kDarkblue, st77xx::colour::kWhite);
+        CHECK(IsExpected());
+
+        // A character
+        lcd.DrawChar(kWidth - font->kWidth, y, '@', font, st77xx::colour::kMagenta, st77xx::colour::kCyan);
+        ExpectText(kWidth - font->kWidth, y, "@", 1, font, st77xx::colour::kMagenta, st77xx::colour::kCyan);
+        CHECK(IsExpected());
+        CheckBus();
+
+        y += font->kHeight;
+    }
+
+    // Below the screen, nothing is drawn
+    lcd.DrawString(0, kHeight - 4, kText, 4, &Font8x8, st77xx::colour::kBlack, st77xx::colour::kWhite);
+    CHECK(IsExpected());
+}
+
+void TestWindows(ST7789& lcd) {
+    static constexpr char kLine[] = "Universe 1 : 512";
+    const auto kLength = static_cast<uint32_t>(sizeof(kLine) - 1);
+
+    // A text line is one window: CASET, RASET and RAMWR
+    s_model.commands = 0;
+    lcd.DrawString(0, 0, kLine, kLength, &Font12x12, st77xx::colour::kBlack, st77xx::colour::kWhite);
+    CHECK(s_model.commands == 3);
+    ExpectText(0, 0, kLine, kLength, &Font12x12, st77xx::colour::kBlack, st77xx::colour::kWhite);
+    CHECK(IsExpected());
+
+#if defined(SPI_DMAx)
+    // 12 lines of 5 per strip: three DMA transfers, the data without blocking writes
+    mock::spi::ResetStatistics();
+    lcd.DrawString(0, 0, kLine, kLength, &Font12x12, st77xx::colour::kBlack, st77xx::colour::kWhite);
+    CHECK(mock::spi::GetStatistics().dma_transfers == 3);
+    CHECK(mock::spi::GetStatistics().transfers == 5);
+#endif
+    CheckBus();
+}
+
+void TestPixels(ST7789& lcd) {
+    lcd.DrawLine(0, 239, 239, 0, st77xx::colour::kOrange);
+
+    for (uint32_t x = 0; x < kWidth; x++) {
+        s_expected[239 - x][x] = st77xx::colour::kOrange;
+    }
+
+    lcd.DrawPixel(5, 5, st77xx::colour::kGray);
+    s_expected[5][5] = st77xx::colour::kGray;
+
+    CHECK(IsExpected());
+    CheckBus();
+}
+} // namespace
+
+int main() {
+    mock::spi::Attach(&s_model, SPI_LCD_DC_GPIO);
+
+    ST7789 lcd(0);
+    CHECK(lcd.GetWidth() == kWidth);
+    CHECK(lcd.GetHeight() == kHeight);
+
+    TestFill(lcd);
+    TestText(lcd);
+    TestWindows(lcd);
+    TestPixels(lcd);
+
+#if defined(SPI_DMAx)
+    return test::Result("spilcd_paint_test");
+#else
+    return test::Result("spilcd_paint_blocking_test");
+#endif
+}
@@ -0,0 +1,329 @@
+/**
+ * @file ssd1306_flush_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * lib-display Ssd1306 on the I2C0 model in mock/gd32f30x_i2c.cpp, with a model of the SSD1306 GDDRAM.
+ *
+ * The RDM responder screens are drawn with the calls DisplayUdf and Display (lib-display/include/i2c/display.h) make,
+ * with Run() called from the superloop. Per update the I2C transactions and bytes are reported,
+ * with the time the caller is blocked, and the GDDRAM is checked against the text.
+ *
+ * SSD1306_BEFORE builds the same screens on the driver before the framebuffer, see the Makefile.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+
+#include "i2c/ssd1306.h"
+#include "gd32_i2c.h"
+#include "gd32.h"
+#include "test.h"
+
+namespace {
+constexpr uint32_t kRows = 8;
+constexpr uint32_t kCols = 21;
+constexpr uint32_t kCharW = 6;
+constexpr uint32_t kPages = 8;
+constexpr uint32_t kColumns = 132;
+
+/**
+ * The SSD1306 in horizontal addressing mode, a command byte with an argument takes the next command byte.
+ */
+class Ssd1306Model final : public mock::i2c0::Target {
+   public:
+    bool Address(bool is_read) override {
+        transactions++;
+        is_control_ = !is_read;
+        return true;
+    }
+
+    bool Write(uint8_t data) override {
+        bytes++;
+
+        if (is_control_) {
+            is_control_ = false;
+            is_data_ = (data & 0x40) != 0;
+            return true;
+        }
+
+        if (is_data_) {
+            if (page_ < kPages && column_ < kColumns) {
+                gddram[page_][column_] = data;
+            }
+            if (++column_ == 128) {
+                column_ = 0;
+                page_ = (page_ + 1) % kPages;
+            }
+            return true;
+        }
+
+        if (arguments_ != 0) {
+            arguments_--;
+        } else if (data <= 0x0F) {
+            column_ = (column_ & 0xF0) | data;
+        } else if (data <= 0x1F) {
+            column_ = (column_ & 0x0F) | ((data & 0x0F) << 4);
+        } else if (data >= 0xB0 && data <= 0xB7) {
+            page_ = data & 0x07;
+        } else if (data == 0x20 || data == 0x81 || data == 0x8D || data == 0xA8 || data == 0xD3 || data == 0xD5 || data == 0xD9 || data == 0xDA || data == 0xDB) {
+            arguments_ = 1;
+        }
+
+        return true;
+    }
+
+    uint8_t Read() override { return 0; }
+
+    uint8_t gddram[kPages][kColumns];
+    uint32_t transactions{0};
+    uint32_t bytes{0};
+
+   private:
+    uint32_t page_{0};
+    uint32_t column_{0};
+    uint32_t arguments_{0};
+    bool is_control_{false};
+    bool is_data_{false};
+};
+
+Ssd1306Model s_model;
+char s_text[kRows][kCols];   ///< What the screen should show
+uint8_t s_font[128][kCharW]; ///< The glyphs, as the driver writes them
+uint32_t s_blocked_micros;
+
+/**
+ * Runs a driver call, the time it takes is the time the caller is blocked.
+ */
+void Blocking(const std::function<void()>& call) {
+    const auto kStart = mock::GetMicros();
+    call();
+    s_blocked_micros += static_cast<uint32_t>(mock::GetMicros() - kStart);
+}
+
+/**
+ * The text model of lib-display/include/i2c/display.h on the Ssd1306
+ */
+class Screen {
+   public:
+    explicit Screen(Ssd1306& display) : display_(display) {}
+
+    void ClearEndOfLine() {
+        display_.ClearEndOfLine();
+        is_clear_end_of_line_ = true;
+    }
+
+    void Write(uint32_t line, const char* text) { TextLine(line, text, static_cast<uint32_t>(strlen(text))); }
+
+    template <typename... Args> void Printf(uint32_t line, const char* format, Args... args) {
+        char buffer[32];
+        const auto kLength = snprintf(buffer, sizeof(buffer), format, args...);
+        TextLine(line, buffer, static_cast<uint32_t>(kLength));
+    }
+
+    void ClearLine(uint32_t line) {
+        Blocking([&] { display_.ClearLine(line); });
+        memset(s_text[line - 1], ' ', kCols);
+    }
+
+    void TextStatus(const char* text) {
+        Blocking([&] {
+            display_.SetCursorPos(0, kRows - 1);
+            for (uint32_t i = 0; i < kCols - 1; i++) {
+                display_.PutChar(' ');
+            }
+            display_.SetCursorPos(0, kRows - 1);
+        });
+        memset(s_text[kRows - 1], ' ', kCols - 1);
+        Write(kRows, text);
+    }
+
+   private:
+    void TextLine(uint32_t line, const char* text, uint32_t length) {
+        length = length > kCols ? kCols : length;
+        Blocking([&] { display_.TextLine(line, text, length); });
+        memcpy(s_text[line - 1], text, length);
+        if (is_clear_end_of_line_) {
+            is_clear_end_of_line_ = false;
+            memset(&s_text[line - 1][length], ' ', kCols - length);
+        }
+    }
+
+    Ssd1306& display_;
+    bool is_clear_end_of_line_{false};
+};
+
+bool IsShown() {
+    for (uint32_t row = 0; row < kRows; row++) {
+        for (uint32_t column = 0; column < kCols; column++) {
+            if (memcmp(&s_model.gddram[row][column * kCharW], s_font[static_cast<uint8_t>(s_text[row][column])], kCharW) != 0) {
+                printf("row %u column %u is not '%c'\n", row, column, s_text[row][column]);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * The glyphs are taken from the GDDRAM, so that the checks do not depend on the font table
+ */
+void LearnFont(Ssd1306& display) {
+    for (uint32_t c = ' '; c < 127; c += kCols) {
+        char line[kCols];
+        uint32_t length = 0;
+
+        for (; (length < kCols) && (c + length < 127); length++) {
+            line[length] = static_cast<char>(c + length);
+        }
+
+        display.TextLine(1, line, length);
+
+        for (uint32_t i = 0; i < length; i++) {
+            memcpy(s_font[c + i], &s_model.gddram[0][i * kCharW], kCharW);
+        }
+    }
+}
+
+struct Cost {
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t blocked_micros;
+};
+
+/**
+ * Draws an update, then runs the superloop for 100 ms, calling Run() every millisecond.
+ */
+Cost Update(Ssd1306& display, const char* name, const std::function<void()>& draw) {
+    s_model.transactions = 0;
+    s_model.bytes = 0;
+    s_blocked_micros = 0;
+
+    draw();
+
+    const auto kStart = mock::GetMicros();
+
+    while (mock::GetMicros() - kStart < 100000) {
+        Blocking([&] { display.Run(); });
+        mock::i2c0::Step(1000);
+    }
+
+    CHECK(IsShown());
+
+    printf(" %-24s %4u %6u %7u\n", name, s_model.transactions, s_model.bytes, s_blocked_micros);
+
+    return {s_model.transactions, s_model.bytes, s_blocked_micros};
+}
+} // namespace
+
+int main() {
+    mock::i2c0::Attach(OLED_I2C_ADDRESS_DEFAULT, &s_model);
+    i2c::Begin();
+
+    Ssd1306 display(OledPanel::k128x648Rows);
+    CHECK(display.Start());
+    CHECK(!display.IsSH1106());
+
+    LearnFont(display);
+    display.ClearLine(1);
+    memset(s_text, ' ', sizeof(s_text));
+
+    // The superloop is running
+    display.Run();
+
+    Screen screen(display);
+
+    // DisplayUdf::Show(), the labels as set by gd32_rdm_responder/firmware/main.cpp
+    const auto kShow = [&](uint32_t dmx_start_address) {
+        screen.ClearEndOfLine();
+        screen.Write(1, "RDM Responder Pixel 1");
+        screen.ClearEndOfLine();
+        screen.Printf(2, "Firmware V%.*s", 5, "1.0  ");
+        screen.ClearEndOfLine();
+        screen.Write(3, "GD32F303RC");
+        screen.Printf(6, "DMX S:%3u F:%3u", dmx_start_address, 24U);
+    };
+
+#if defined(SSD1306_BEFORE)
+    constexpr auto kName = "ssd1306_flush_before_bench";
+    printf("SSD1306 per update, the driver before the framebuffer\n");
+#elif defined(CONFIG_I2C_ASYNC)
+    constexpr auto kName = "ssd1306_flush_test";
+    printf("SSD1306 per update, the framebuffer flushed with the I2C transaction queue\n");
+#else
+    constexpr auto kName = "ssd1306_flush_blocking_test";
+    printf("SSD1306 per update, the framebuffer flushed blocking\n");
+#endif
+    printf(" %-24s %4s %6s %7s\n", "update", "xfer", "bytes", "blocked");
+
+    const auto kBoot = Update(display, "DisplayUdf::Show()", [&] { kShow(1); });
+
+    // gd32_rdm_responder/lib/dmxstartaddressupdate.cpp
+    const auto kAddress = Update(display, "DMX start address", [&] { kShow(2); });
+
+    const auto kSame = Update(display, "Unchanged", [&] { kShow(2); });
+
+    // gd32_rdm_responder/lib/display.cpp
+    const auto kPixel = Update(display, "Pixel type and pattern", [&] {
+        screen.Printf(6, "%-20s", "Rainbow cycle");
+        screen.Printf(7, "%-8s %-2d G%-2d %-5s", "WS2812B", 60, 1, "RGB");
+        screen.TextStatus("Programmed");
+    });
+
+    const auto kStatusCleared = Update(display, "Status line cleared", [&] { screen.ClearLine(8); });
+
+    // gd32_rdm_responder/lib/rdm_selftest.cpp
+    const auto kSelfTest = Update(display, "Self test", [&] {
+        screen.ClearLine(6);
+        screen.Printf(6, "%s:%u", "Fade", 3U);
+    });
+
+#if defined(SSD1306_BEFORE)
+    static_cast<void>(kBoot);
+    static_cast<void>(kPixel);
+    static_cast<void>(kStatusCleared);
+    static_cast<void>(kAddress);
+    static_cast<void>(kSame);
+    static_cast<void>(kSelfTest);
+#else
+    // A row is at most its GDDRAM address commands and one data transfer
+    CHECK(kBoot.transactions <= 2 * 4);
+    CHECK(kPixel.transactions <= 2 * 3);
+    CHECK(kStatusCleared.transactions <= 2);
+    CHECK(kSelfTest.transactions <= 2);
+    // The one character that changed
+    CHECK(kAddress.transactions == 2);
+    CHECK(kAddress.bytes == 4 + 1 + kCharW);
+    CHECK(kSame.transactions == 0);
+#if defined(CONFIG_I2C_ASYNC)
+    // Only the queue is filled, the bus is not waited for
+    CHECK(kBoot.blocked_micros < 1000);
+#endif
+#endif
+
+    return test::Result(kName);
+}
@@ -0,0 +1,88 @@
+/**
+ * @file thermistor_test.cpp
+ *
+ */
+/* Copyright (C) 2026 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cmath>
+
+#include "thermistor.h"
+#include "test.h"
+
+namespace thermistor = sensor::thermistor;
+
+static void TestExp() {
+    for (int32_t i = -1000; i <= 1000; i++) {
+        const auto kX = i / 100.0;
+        CHECK(fabs(thermistor::internal::Exp(kX) / exp(kX) - 1) < 1e-12);
+    }
+}
+
+static void TestTable() {
+    constexpr thermistor::Table<thermistor::Adafruit372> kTable;
+    // 25 degrees Celcius is entry (25 - -55) / 2
+    static_assert(kTable.resistor[40] == thermistor::kThermistorNominal);
+
+    for (uint32_t i = 1; i < kTable.kEntries; i++) {
+        CHECK(kTable.resistor[i] < kTable.resistor[i - 1]);
+    }
+}
+
+/**
+ * Within 0.1 degree of the floating point reference for -40..125 degrees Celcius
+ */
+static void TestAccuracy() {
+    for (uint32_t resistor = 300; resistor < 400000; resistor++) {
+        const auto kReference = thermistor::Temperature(resistor);
+
+        if ((kReference < -40) || (kReference > 125)) {
+            continue;
+        }
+
+        CHECK(fabs(thermistor::TemperatureDeci(resistor) - 10.0 * kReference) < 1.0);
+    }
+}
+
+static void TestClamp() {
+    CHECK(thermistor::TemperatureDeci(0) == thermistor::kRangeMax * 10);
+    CHECK(thermistor::TemperatureDeci(1) == thermistor::kRangeMax * 10);
+    CHECK(thermistor::TemperatureDeci(UINT32_MAX) == thermistor::kRangeMin * 10);
+
+    auto previous = thermistor::TemperatureDeci(0);
+
+    for (uint32_t resistor = 1; resistor < 2000000; resistor += 7) {
+        const auto kTemperature = thermistor::TemperatureDeci(resistor);
+        CHECK(kTemperature <= previous);
+        CHECK(kTemperature >= thermistor::kRangeMin * 10);
+        previous = kTemperature;
+    }
+}
+
+int main() {
+    TestExp();
+    TestTable();
+    TestAccuracy();
+    TestClamp();
+
+    return test::Result("thermistor_test");
+}